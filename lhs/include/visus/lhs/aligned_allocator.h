@@ -0,0 +1,196 @@
+﻿// <copyright file="aligned_allocator.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_ALIGNED_ALLOCATOR_H)
+#define _LHS_ALIGNED_ALLOCATOR_H
+#pragma once
+
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include "visus/lhs/api.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// An allocator that aligns all allocations to
+/// <typeparamref name="Alignment" /> bytes.
+/// </summary>
+/// <remarks>
+/// Using this allocator for a <see cref="matrix" /> also requests the rows
+/// (for <see cref="matrix_layout::row_major" />) or columns (for
+/// <see cref="matrix_layout::column_major" />) of the matrix to be padded to a
+/// multiple of <typeparamref name="Alignment" /> bytes, which makes every row
+/// or column start at an aligned address, respectively.
+/// </remarks>
+/// <typeparam name="TValue">The type of the objects to be allocated.
+/// </typeparam>
+/// <typeparam name="Alignment">The alignment of the allocations in bytes, which
+/// must be a power of two. This parameter defaults to 64 bytes, which is the
+/// size of a cache line and of an AVX-512 register.</typeparam>
+template<class TValue, std::size_t Alignment = 64>
+class aligned_allocator {
+    static_assert((Alignment & (Alignment - 1)) == 0, "The alignment must be "
+        "a power of two.");
+    static_assert(Alignment >= alignof(TValue), "The alignment must not be "
+        "less than the natural alignment of the type.");
+
+public:
+
+    /// <summary>
+    /// The type of the objects to be allocated.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Indicates that allocators are interchangable.
+    /// </summary>
+    typedef std::true_type is_always_equal;
+
+    /// <summary>
+    /// Rebinds the allocator to another type.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects to be allocated by
+    /// the rebound allocator.</typeparam>
+    template<class TOther> struct rebind final {
+        typedef aligned_allocator<TOther, Alignment> other;
+    };
+
+    /// <summary>
+    /// The alignment of the allocations in bytes.
+    /// </summary>
+    static constexpr const std::size_t alignment = Alignment;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    inline constexpr aligned_allocator(void) noexcept = default;
+
+    /// <summary>
+    /// Initialises a new instance from an allocator for another type.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects allocated by the other
+    /// allocator.</typeparam>
+    template<class TOther>
+    inline constexpr aligned_allocator(
+            _In_ const aligned_allocator<TOther, Alignment>&) noexcept { }
+
+    /// <summary>
+    /// Allocates storage for <paramref name="cnt" /> objects.
+    /// </summary>
+    /// <param name="cnt">The number of objects to allocate storage for.</param>
+    /// <returns>A pointer to the aligned storage.</returns>
+    /// <exception cref="std::bad_array_new_length">If the requested size
+    /// overflows.</exception>
+    /// <exception cref="std::bad_alloc">If the allocation failed.</exception>
+    inline TValue *allocate(_In_ const std::size_t cnt) {
+        if (cnt > (std::numeric_limits<std::size_t>::max)() / sizeof(TValue)) {
+            throw std::bad_array_new_length();
+        }
+
+        return static_cast<TValue *>(::operator new(cnt * sizeof(TValue),
+            std::align_val_t(Alignment)));
+    }
+
+    /// <summary>
+    /// Releases storage allocated by <see cref="allocate" />.
+    /// </summary>
+    /// <param name="ptr">The pointer returned by <see cref="allocate" />.
+    /// </param>
+    inline void deallocate(_In_ TValue *ptr,
+            _In_ const std::size_t) noexcept {
+        ::operator delete(ptr, std::align_val_t(Alignment));
+    }
+
+    /// <summary>
+    /// Test for equality.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects allocated by the other
+    /// allocator.</typeparam>
+    /// <returns><c>true</c>, because all instances are interchangable.
+    /// </returns>
+    template<class TOther>
+    inline constexpr bool operator ==(
+            _In_ const aligned_allocator<TOther, Alignment>&)
+            const noexcept {
+        return true;
+    }
+
+    /// <summary>
+    /// Test for inequality.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects allocated by the other
+    /// allocator.</typeparam>
+    /// <returns><c>false</c>, because all instances are interchangable.
+    /// </returns>
+    template<class TOther>
+    inline constexpr bool operator !=(
+            _In_ const aligned_allocator<TOther, Alignment>&)
+            const noexcept {
+        return false;
+    }
+};
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Determines the number of elements the leading dimension of a
+/// <see cref="matrix" /> using <typeparamref name="TAllocator" /> is padded to.
+/// </summary>
+/// <remarks>
+/// By default, matrices are not padded. Specialise this trait for custom
+/// allocators to request padding.
+/// </remarks>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+template<class TAllocator>
+struct padding : std::integral_constant<std::size_t, 1> { };
+
+/// <summary>
+/// Specialisation for <see cref="aligned_allocator" />, which pads to the
+/// alignment if an integral number of elements fits into it.
+/// </summary>
+/// <typeparam name="TValue">The type of the objects to be allocated.
+/// </typeparam>
+/// <typeparam name="Alignment">The alignment of the allocations in bytes.
+/// </typeparam>
+template<class TValue, std::size_t Alignment>
+struct padding<aligned_allocator<TValue, Alignment>>
+    : std::integral_constant<std::size_t, ((Alignment % sizeof(TValue)) == 0)
+        ? Alignment / sizeof(TValue)
+        : 1> { };
+
+/// <summary>
+/// Determines the number of elements the leading dimension of a
+/// <see cref="matrix" /> using <typeparamref name="TAllocator" /> is padded to.
+/// </summary>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+template<class TAllocator>
+constexpr std::size_t padding_v = padding<TAllocator>::value;
+
+/// <summary>
+/// Rounds <paramref name="value" /> up to the next multiple of
+/// <paramref name="multiple" />.
+/// </summary>
+/// <param name="value">The value to be rounded.</param>
+/// <param name="multiple">The multiple to round to, which must not be zero.
+/// </param>
+/// <returns>The smallest multiple of <paramref name="multiple" /> not less
+/// than <paramref name="value" />.</returns>
+inline constexpr std::size_t round_up(_In_ const std::size_t value,
+        _In_ const std::size_t multiple) noexcept {
+    return ((value + multiple - 1) / multiple) * multiple;
+}
+
+LHS_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_LHS_ALIGNED_ALLOCATOR_H) */
@@ -0,0 +1,381 @@
+﻿// <copyright file="categorical.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_CATEGORICAL_H)
+#define _LHS_CATEGORICAL_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "visus/lhs/api.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// A categorical parameter, which stores its expressions in an indexed
+/// dictionary.
+/// </summary>
+/// <remarks>
+/// <para>The expressions are copied once into contiguous storage when the
+/// parameter is created, so they can be looked up in constant time
+/// regardless of the container they originate from. When used as a
+/// parameter of <see cref="sample" />, the realised values are
+/// <c>std::reference_wrapper</c>s into the dictionary, so no expressions are
+/// copied while realising a sample. The parameter must therefore outlive the
+/// realised sample.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the expressions.</typeparam>
+template<class TValue> class categorical final {
+
+public:
+
+    /// <summary>
+    /// The iterator over the expressions.
+    /// </summary>
+    typedef typename std::vector<TValue>::const_iterator const_iterator;
+
+    /// <summary>
+    /// The type of the expressions.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance from the given range of expressions.
+    /// </summary>
+    /// <typeparam name="TIterator">The type of the iterator over the
+    /// expressions.</typeparam>
+    /// <param name="begin">The begin of the expressions.</param>
+    /// <param name="end">The end of the expressions.</param>
+    /// <exception cref="std::invalid_argument">If the range is empty.
+    /// </exception>
+    template<class TIterator>
+    categorical(_In_ const TIterator begin, _In_ const TIterator end)
+            : _expressions(begin, end) {
+        if (this->_expressions.empty()) {
+            throw std::invalid_argument("A categorical parameter must have at "
+                "least one expression.");
+        }
+    }
+
+    /// <summary>
+    /// Initialises a new instance from the given expressions.
+    /// </summary>
+    /// <param name="expressions">The expressions of the parameter.</param>
+    /// <exception cref="std::invalid_argument">If
+    /// <paramref name="expressions" /> is empty.</exception>
+    inline categorical(
+            _In_ const std::initializer_list<value_type> expressions)
+        : categorical(expressions.begin(), expressions.end()) { }
+
+    /// <summary>
+    /// Answer an iterator to the first expression.
+    /// </summary>
+    /// <returns>An iterator to the first expression.</returns>
+    inline const_iterator begin(void) const noexcept {
+        return this->_expressions.begin();
+    }
+
+    /// <summary>
+    /// Answer a pointer to the contiguous expressions.
+    /// </summary>
+    /// <returns>A pointer to the first expression.</returns>
+    inline const value_type *data(void) const noexcept {
+        return this->_expressions.data();
+    }
+
+    /// <summary>
+    /// Answer an iterator past the last expression.
+    /// </summary>
+    /// <returns>An iterator past the last expression.</returns>
+    inline const_iterator end(void) const noexcept {
+        return this->_expressions.end();
+    }
+
+    /// <summary>
+    /// Answer the zero-based index of an expression that has been obtained
+    /// from this parameter, for instance by realising a sample.
+    /// </summary>
+    /// <param name="expression">A reference to an expression stored in this
+    /// parameter.</param>
+    /// <returns>The index of <paramref name="expression" />.</returns>
+    inline std::size_t index_of(
+            _In_ const value_type& expression) const noexcept {
+        assert(&expression >= this->data());
+        assert(&expression < this->data() + this->size());
+        return static_cast<std::size_t>(&expression - this->data());
+    }
+
+    /// <summary>
+    /// Answer the number of expressions.
+    /// </summary>
+    /// <returns>The number of expressions, which is at least one.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_expressions.size();
+    }
+
+    /// <summary>
+    /// Answer the expression at the specified index.
+    /// </summary>
+    /// <param name="index">The zero-based index of the expression, which must
+    /// be less than <see cref="size" />.</param>
+    /// <returns>The expression at <paramref name="index" />.</returns>
+    inline const value_type& operator [](
+            _In_ const std::size_t index) const noexcept {
+        assert(index < this->size());
+        return this->_expressions[index];
+    }
+
+private:
+
+    std::vector<value_type> _expressions;
+};
+
+
+/// <summary>
+/// Creates a <see cref="categorical" /> parameter from the elements of an
+/// arbitrary container.
+/// </summary>
+/// <typeparam name="TContainer">The type of the container, which can be
+/// any iterable type like <c>std::set</c> or <c>std::list</c>.</typeparam>
+/// <param name="expressions">The expressions of the parameter.</param>
+/// <returns>The categorical parameter.</returns>
+/// <exception cref="std::invalid_argument">If
+/// <paramref name="expressions" /> is empty.</exception>
+template<class TContainer>
+inline categorical<typename TContainer::value_type> make_categorical(
+        _In_ const TContainer& expressions) {
+    return categorical<typename TContainer::value_type>(
+        std::begin(expressions), std::end(expressions));
+}
+
+
+/// <summary>
+/// A categorical parameter whose expressions are selected with given
+/// probabilities rather than being equiprobable.
+/// </summary>
+/// <remarks>
+/// <para>A sample value u within [0, 1] selects the first expression whose
+/// cumulative probability is greater than u, which maps the strata of a
+/// Latin hypercube sample to the expressions in proportion to their
+/// weights.</para>
+/// <para>In order to select an expression in constant time without
+/// searching the cumulative probabilities, the parameter precomputes a
+/// table of equally sized cells over [0, 1]. The number of cells is a power
+/// of two chosen such that each cell contains at most one boundary between
+/// the cumulative probabilities of two expressions. Each cell therefore
+/// stores the position of this boundary and the expressions on either side
+/// of it. The number of cells is in the order of the inverse of the smallest
+/// non-zero probability, but limited to <see cref="max_cells" />.</para>
+/// <para>Like <see cref="categorical{TValue}" />, the realised values are
+/// <c>std::reference_wrapper</c>s into the dictionary, so the parameter must
+/// outlive the realised sample.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the expressions.</typeparam>
+template<class TValue> class weighted_categorical final {
+
+public:
+
+    /// <summary>
+    /// The iterator over the expressions.
+    /// </summary>
+    typedef typename std::vector<TValue>::const_iterator const_iterator;
+
+    /// <summary>
+    /// The type of the expressions.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// The type of the weights and probabilities.
+    /// </summary>
+    typedef double weight_type;
+
+    /// <summary>
+    /// The maximum number of cells in the lookup table.
+    /// </summary>
+    static constexpr std::size_t max_cells = static_cast<std::size_t>(1)
+        << 20;
+
+    /// <summary>
+    /// Initialises a new instance from the given range of expressions and
+    /// their weights.
+    /// </summary>
+    /// <typeparam name="TIterator">The type of the iterator over the
+    /// expressions.</typeparam>
+    /// <typeparam name="TWeightIterator">The type of the iterator over the
+    /// weights.</typeparam>
+    /// <param name="begin">The begin of the expressions.</param>
+    /// <param name="end">The end of the expressions.</param>
+    /// <param name="weights">The begin of the non-negative weights, which
+    /// must provide one weight for each expression. The weights do not need
+    /// to be normalised.</param>
+    /// <exception cref="std::invalid_argument">If the range is empty, if a
+    /// weight is negative or not finite, if all weights are zero or if the
+    /// smallest non-zero weight is too small compared to the sum of the
+    /// weights to be represented by <see cref="max_cells" /> cells.
+    /// </exception>
+    template<class TIterator, class TWeightIterator>
+    weighted_categorical(_In_ const TIterator begin,
+        _In_ const TIterator end,
+        _In_ TWeightIterator weights);
+
+    /// <summary>
+    /// Initialises a new instance from the given pairs of expressions and
+    /// weights.
+    /// </summary>
+    /// <param name="expressions">The expressions of the parameter and their
+    /// weights.</param>
+    /// <exception cref="std::invalid_argument">If
+    /// <paramref name="expressions" /> is empty, if a weight is negative or
+    /// not finite, if all weights are zero or if the smallest non-zero weight
+    /// is too small compared to the sum of the weights.</exception>
+    weighted_categorical(_In_ const std::initializer_list<
+        std::pair<value_type, weight_type>> expressions);
+
+    /// <summary>
+    /// Answer an iterator to the first expression.
+    /// </summary>
+    /// <returns>An iterator to the first expression.</returns>
+    inline const_iterator begin(void) const noexcept {
+        return this->_expressions.begin();
+    }
+
+    /// <summary>
+    /// Answer the number of cells in the lookup table.
+    /// </summary>
+    /// <returns>The number of cells, which is a power of two.</returns>
+    inline std::size_t cells(void) const noexcept {
+        return this->_cells.size();
+    }
+
+    /// <summary>
+    /// Answer a pointer to the contiguous expressions.
+    /// </summary>
+    /// <returns>A pointer to the first expression.</returns>
+    inline const value_type *data(void) const noexcept {
+        return this->_expressions.data();
+    }
+
+    /// <summary>
+    /// Answer an iterator past the last expression.
+    /// </summary>
+    /// <returns>An iterator past the last expression.</returns>
+    inline const_iterator end(void) const noexcept {
+        return this->_expressions.end();
+    }
+
+    /// <summary>
+    /// Answer the zero-based index of an expression that has been obtained
+    /// from this parameter, for instance by realising a sample.
+    /// </summary>
+    /// <param name="expression">A reference to an expression stored in this
+    /// parameter.</param>
+    /// <returns>The index of <paramref name="expression" />.</returns>
+    inline std::size_t index_of(
+            _In_ const value_type& expression) const noexcept {
+        assert(&expression >= this->data());
+        assert(&expression < this->data() + this->size());
+        return static_cast<std::size_t>(&expression - this->data());
+    }
+
+    /// <summary>
+    /// Answer the probability of the expression at the specified index.
+    /// </summary>
+    /// <param name="index">The zero-based index of the expression, which must
+    /// be less than <see cref="size" />.</param>
+    /// <returns>The normalised weight of the expression.</returns>
+    inline weight_type probability(
+            _In_ const std::size_t index) const noexcept {
+        assert(index < this->size());
+        return (index > 0)
+            ? this->_cumulative[index] - this->_cumulative[index - 1]
+            : this->_cumulative[index];
+    }
+
+    /// <summary>
+    /// Answer the index of the expression selected by the given sample
+    /// value in constant time.
+    /// </summary>
+    /// <typeparam name="TUnit">The floating-point type of the sample value.
+    /// </typeparam>
+    /// <param name="value">The sample value within [0, 1].</param>
+    /// <returns>The zero-based index of the first expression whose cumulative
+    /// probability is greater than <paramref name="value" />, or the last
+    /// expression with a non-zero probability if <paramref name="value" /> is
+    /// one.</returns>
+    template<class TUnit>
+    inline std::enable_if_t<std::is_floating_point_v<TUnit>, std::size_t>
+    select(_In_ const TUnit value) const noexcept {
+        assert(value >= static_cast<TUnit>(0));
+        assert(value <= static_cast<TUnit>(1));
+        // Note: the number of cells is a power of two, so the multiplication
+        // is exact and the cell of 'u' is exactly the one its boundaries have
+        // been computed for.
+        const auto u = static_cast<weight_type>(value);
+        const auto n = this->_cells.size();
+        const auto i = (std::min)(static_cast<std::size_t>(
+            u * static_cast<weight_type>(n)), n - 1);
+        const auto& cell = this->_cells[i];
+        return (u < cell.boundary) ? cell.below : cell.above;
+    }
+
+    /// <summary>
+    /// Answer the number of expressions.
+    /// </summary>
+    /// <returns>The number of expressions, which is at least one.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_expressions.size();
+    }
+
+    /// <summary>
+    /// Answer the expression at the specified index.
+    /// </summary>
+    /// <param name="index">The zero-based index of the expression, which must
+    /// be less than <see cref="size" />.</param>
+    /// <returns>The expression at <paramref name="index" />.</returns>
+    inline const value_type& operator [](
+            _In_ const std::size_t index) const noexcept {
+        assert(index < this->size());
+        return this->_expressions[index];
+    }
+
+private:
+
+    /// <summary>
+    /// A cell of the lookup table, which contains at most one boundary
+    /// between two expressions.
+    /// </summary>
+    struct cell {
+        weight_type boundary;
+        std::size_t below;
+        std::size_t above;
+    };
+
+    /// <summary>
+    /// Normalises the weights in <see cref="_cumulative" /> and builds the
+    /// lookup table.
+    /// </summary>
+    void build(void);
+
+    std::vector<cell> _cells;
+    std::vector<weight_type> _cumulative;
+    std::vector<value_type> _expressions;
+};
+
+LHS_NAMESPACE_END
+
+#include "visus/lhs/categorical.inl"
+
+#endif /* !defined(_LHS_CATEGORICAL_H) */
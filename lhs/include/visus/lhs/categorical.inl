@@ -0,0 +1,138 @@
+﻿// <copyright file="categorical.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::weighted_categorical<TValue>::weighted_categorical
+ */
+template<class TValue>
+template<class TIterator, class TWeightIterator>
+LHS_NAMESPACE::weighted_categorical<TValue>::weighted_categorical(
+        _In_ const TIterator begin,
+        _In_ const TIterator end,
+        _In_ TWeightIterator weights)
+        : _expressions(begin, end) {
+    this->_cumulative.reserve(this->_expressions.size());
+    for (std::size_t i = 0; i < this->_expressions.size(); ++i, ++weights) {
+        this->_cumulative.push_back(static_cast<weight_type>(*weights));
+    }
+
+    this->build();
+}
+
+
+/*
+ * LHS_NAMESPACE::weighted_categorical<TValue>::weighted_categorical
+ */
+template<class TValue>
+LHS_NAMESPACE::weighted_categorical<TValue>::weighted_categorical(
+        _In_ const std::initializer_list<
+            std::pair<value_type, weight_type>> expressions) {
+    this->_cumulative.reserve(expressions.size());
+    this->_expressions.reserve(expressions.size());
+
+    for (auto& e : expressions) {
+        this->_expressions.push_back(e.first);
+        this->_cumulative.push_back(e.second);
+    }
+
+    this->build();
+}
+
+
+/*
+ * LHS_NAMESPACE::weighted_categorical<TValue>::build
+ */
+template<class TValue>
+void LHS_NAMESPACE::weighted_categorical<TValue>::build(void) {
+    static constexpr auto zero = static_cast<weight_type>(0);
+    static constexpr auto one = static_cast<weight_type>(1);
+    auto& cumulative = this->_cumulative;
+    const auto cnt = cumulative.size();
+
+    if (cnt == 0) {
+        throw std::invalid_argument("A categorical parameter must have at "
+            "least one expression.");
+    }
+
+    auto total = zero;
+    for (auto w : cumulative) {
+        if (!std::isfinite(w) || (w < zero)) {
+            throw std::invalid_argument("The weights of a categorical "
+                "parameter must be finite and non-negative.");
+        }
+        total += w;
+    }
+
+    if (!(total > zero)) {
+        throw std::invalid_argument("At least one expression of a categorical "
+            "parameter must have a non-zero weight.");
+    }
+
+    // Find the smallest probability and, for each expression, the next one
+    // with a non-zero probability, which is the expression beyond its upper
+    // boundary.
+    auto smallest = one;
+    std::vector<std::size_t> next(cnt, cnt);
+    for (std::size_t i = cnt, n = cnt; i-- > 0;) {
+        next[i] = n;
+        if (cumulative[i] > zero) {
+            smallest = (std::min)(smallest, cumulative[i] / total);
+            n = i;
+        }
+    }
+
+    const auto first = (cumulative[0] > zero) ? 0 : next[0];
+    auto last = first;
+    while (next[last] < cnt) {
+        last = next[last];
+    }
+
+    // Convert the weights into normalised cumulative probabilities. Make sure
+    // that the last expression that can be selected ends exactly at one.
+    auto sum = zero;
+    for (std::size_t i = 0; i < cnt; ++i) {
+        sum += cumulative[i];
+        cumulative[i] = (i < last) ? (std::min)(sum / total, one) : one;
+    }
+
+    // Start with the smallest power of two that makes each cell narrower than
+    // the smallest probability and refine if rounding put two boundaries into
+    // the same cell.
+    std::size_t cells = 1;
+    while ((cells <= max_cells)
+            && (static_cast<weight_type>(cells) * smallest < one)) {
+        cells <<= 1;
+    }
+
+    for (; cells <= max_cells; cells <<= 1) {
+        const auto width = one / static_cast<weight_type>(cells);
+        auto valid = true;
+        auto current = first;
+        this->_cells.resize(cells);
+
+        for (std::size_t c = 0; valid && (c < cells); ++c) {
+            const auto lower = static_cast<weight_type>(c) * width;
+            const auto upper = static_cast<weight_type>(c + 1) * width;
+
+            while (cumulative[current] <= lower) {
+                current = next[current];
+            }
+
+            const auto above = (current < last) ? next[current] : current;
+            valid = (cumulative[above] >= upper);
+            this->_cells[c] = cell { cumulative[current], current, above };
+        }
+
+        if (valid) {
+            return;
+        }
+    }
+
+    throw std::invalid_argument("The smallest non-zero weight of a "
+        "categorical parameter is too small compared to the sum of all "
+        "weights.");
+}
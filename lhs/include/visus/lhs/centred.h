@@ -9,6 +9,7 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
 #include <initializer_list>
 #include <iterator>
 #include <random>
@@ -17,16 +18,72 @@
 
 #include "visus/lhs/make_floating_point.h"
 #include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
 #include "visus/lhs/is_iterable.h"
 #include "visus/lhs/is_range.h"
 #include "visus/lhs/order.h"
 #include "visus/lhs/range.h"
+#include "visus/lhs/range_scaler.h"
 #include "visus/lhs/scale.h"
+#include "visus/lhs/static_matrix.h"
 #include "visus/lhs/valid.h"
 
 
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Implements the creation of a centred Latin Hypercube sample for a matrix
+/// whose size may be known at compile time.
+/// </summary>
+/// <remarks>
+/// If <typeparamref name="Rows" /> and <typeparamref name="Columns" /> are
+/// non-zero, they must match the size of <paramref name="result" /> and all
+/// working buffers are allocated on the stack. Zero designates a size that is
+/// only known at runtime.
+/// </remarks>
+template<std::size_t Rows, std::size_t Columns, class TValue,
+    matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix_view<TValue, Layout>>
+fill_centred(_In_ const matrix_view<TValue, Layout> result,
+    _In_ TRng& rng,
+    _In_ TDist& distribution);
+
+LHS_DETAIL_NAMESPACE_END
+
+
 LHS_NAMESPACE_BEGIN
 
+/// <summary>
+/// Fill the memory designated by <paramref name="result" /> with a
+/// (uniformly distributed) stratified sample from unit hypercube, placing the
+/// values in the centre of the intervals.
+/// </summary>
+/// <typeparam name="TValue">The type of values to be created, which must be a
+/// floating point type.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TRng">The type of the centred number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate centred
+/// numbers.</typeparam>
+/// <param name="result">The view of the memory to receive the Latin Hypercube
+/// sample. The values are ignored on entry. However, the number of rows
+/// represents the number of samples for each parameter whereas the number of
+/// columns represents the number of parameters.</param>
+/// <param name="rng">The centred number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns><paramref name="result" />.</returns>
+template<class TValue, matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix_view<TValue, Layout>>
+centred(_In_ const matrix_view<TValue, Layout> result,
+    _In_ TRng& rng,
+    _In_ TDist& distribution);
+
 /// <summary>
 /// Fill <paramref name="result" /> with a (uniformly distributed) stratified
 /// sample from unit hypercube, placing the values in the centre of the
@@ -37,6 +94,7 @@ LHS_NAMESPACE_BEGIN
 /// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
 /// to use row-major matrices here, because in this case, the parameter values
 /// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <typeparam name="TRng">The type of the centred number generator.</typeparam>
 /// <typeparam name="TDist">The type of the distribution used to generate centred
 /// numbers.</typeparam>
@@ -50,11 +108,56 @@ LHS_NAMESPACE_BEGIN
 /// typically is a uniform real distribution creating numbers within [0, 1].
 /// </param>
 /// <returns><paramref name="result" />.</returns>
-template<class TValue, matrix_layout Layout, class TRng, class TDist>
-std::enable_if_t<std::is_floating_point_v<TValue>, matrix<TValue, Layout>&>
-centred(_Inout_ matrix<TValue, Layout>& result,
-    _In_ TRng& rng,
-    _In_ TDist& distribution);
+template<class TValue,
+    matrix_layout Layout,
+    class TAllocator,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix<TValue, Layout, TAllocator>&>
+centred(_Inout_ matrix<TValue, Layout, TAllocator>& result,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    centred(matrix_view<TValue, Layout>(result), rng, distribution);
+    return result;
+}
+
+/// <summary>
+/// Fill the fixed-size matrix <paramref name="result" /> with a (uniformly
+/// distributed) stratified sample from unit hypercube, placing the values in
+/// the centre of the intervals, without allocating any memory on the heap.
+/// </summary>
+/// <typeparam name="TValue">The type of values to be created, which must be a
+/// floating point type.</typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate
+/// random numbers.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample.
+/// </param>
+/// <param name="rng">The random number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns><paramref name="result" />.</returns>
+template<class TValue,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<std::is_floating_point_v<TValue>,
+    static_matrix<TValue, Rows, Columns, Layout>&>
+centred(_Inout_ static_matrix<TValue, Rows, Columns, Layout>& result,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    detail::fill_centred<Rows, Columns>(matrix_view<TValue, Layout>(result),
+        rng, distribution);
+    return result;
+}
 
 /// <summary>
 /// Create a (uniformly distributed) stratified sample from unit hypercube,
@@ -143,6 +246,10 @@ centred(_In_ const std::size_t samples,
 /// a unit hypercube. Afterwards, the resulting values will be scaled to the
 /// specified parameter ranges. If the parameters are integral numbers, the
 /// results will be rounded to the nearest integer value.</para>
+/// <para>The parameters may also be
+/// <see cref="transformed_range{TValue, TTransform}" />s like logarithmic
+/// ranges, in which case the centres are equidistant in the transformed
+/// space.</para>
 /// </remarks>
 /// <typeparam name="TIterator">An iterator over the parameter
 /// <paramref name="range{TValue}" />s. The elements, which can be
@@ -186,6 +293,10 @@ centred(_In_ const std::size_t samples,
 /// a unit hypercube. Afterwards, the resulting values will be scaled to the
 /// specified parameter ranges. If the parameters are integral numbers, the
 /// results will be rounded to the nearest integer value.</para>
+/// <para>The parameters may also be
+/// <see cref="transformed_range{TValue, TTransform}" />s like logarithmic
+/// ranges, in which case the centres are equidistant in the transformed
+/// space.</para>
 /// </remarks>
 /// <typeparam name="TIterator">An iterator over the parameter
 /// <paramref name="range{TValue}" />s. The elements, which can be
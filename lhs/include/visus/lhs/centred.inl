@@ -8,44 +8,14 @@
 /*
  * LHS_NAMESPACE::centred
  */
-template<class TValue,
-    LHS_NAMESPACE::matrix_layout Layout,
-    class TRng,
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TRng,
     class TDist>
 std::enable_if_t<std::is_floating_point_v<TValue>,
-    LHS_NAMESPACE::matrix<TValue, Layout>&>
-LHS_NAMESPACE::centred(_Inout_ matrix<TValue, Layout>& result,
+    LHS_NAMESPACE::matrix_view<TValue, Layout>>
+LHS_NAMESPACE::centred(_In_ const matrix_view<TValue, Layout> result,
         _In_ TRng& rng,
         _In_ TDist& distribution) {
-    constexpr auto half = static_cast<TValue>(0.5);
-    // Derived from https://github.com/relf/egobox/blob/15a1225454f4d1c06df2301b9b5b69a9c900c788/crates/doe/src/lhs.rs#L253-L267
-    const auto n = result.rows();
-    const auto k = result.columns();
-    std::vector<std::size_t> indices(n);
-    std::vector<TValue> samples(n);
-    std::vector<TValue> values(n);
-
-    // Create the interval centres to select from.
-    const auto step = static_cast<TValue>(1) / static_cast<TValue>(n);
-    for (std::size_t i = 0; i < n; ++i) {
-        samples[i] = (i + half) * step;
-    }
-
-    // Create the samples from 'values'.
-    for (std::size_t c = 0; c < k; ++c) {
-        for (std::size_t r = 0; r < n; ++r) {
-            values[r] = static_cast<TValue>(distribution(rng));
-        }
-
-        detail::order(indices, values.begin(), values.end());
-
-        for (std::size_t r = 0; r < n; ++r) {
-            result(r, c) = samples[indices[r]];
-        }
-    }
-
-    ASSERT_VALID_LHS(result);
-    return result;
+    return detail::fill_centred<0, 0>(result, rng, distribution);
 }
 
 /*
@@ -65,6 +35,7 @@ LHS_NAMESPACE::centred(_In_ const std::size_t samples,
         _In_ TDist& distribution) {
     typedef typename std::iterator_traits<TIterator>::value_type range_type;
     typedef typename range_type::value_type value_type;
+    typedef detail::range_scaler<range_type, value_type> scaler_type;
 
     constexpr auto half = static_cast<value_type>(0.5);
     const auto k = std::distance(begin, end);
@@ -80,9 +51,13 @@ LHS_NAMESPACE::centred(_In_ const std::size_t samples,
 
         detail::order(indices, values.begin(), values.end());
 
-        auto step = it->distance() / static_cast<value_type>(samples);
+        // Note: the centres are equidistant in the space in which the range
+        // is sampled uniformly, which is where the transform of transformed
+        // ranges is inverted.
+        const scaler_type scaler(*it);
+        auto step = scaler.distance() / static_cast<value_type>(samples);
         for (std::size_t i = 0; i < samples; ++i) {
-            values[i] = (i + half) * step + it->begin();
+            values[i] = scaler.inverse((i + half) * step + scaler.offset());
         }
 
         for (std::size_t r = 0; r < samples; ++r) {
@@ -92,3 +67,47 @@ LHS_NAMESPACE::centred(_In_ const std::size_t samples,
 
     return retval;
 }
+
+/*
+ * LHS_DETAIL_NAMESPACE::fill_centred
+ */
+template<std::size_t Rows, std::size_t Columns, class TValue,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    LHS_NAMESPACE::matrix_view<TValue, Layout>>
+LHS_DETAIL_NAMESPACE::fill_centred(
+        _In_ const matrix_view<TValue, Layout> result,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    constexpr auto half = static_cast<TValue>(0.5);
+    // Derived from https://github.com/relf/egobox/blob/15a1225454f4d1c06df2301b9b5b69a9c900c788/crates/doe/src/lhs.rs#L253-L267
+    assert((Rows == 0) || (result.rows() == Rows));
+    assert((Columns == 0) || (result.columns() == Columns));
+    const auto n = (Rows != 0) ? Rows : result.rows();
+    const auto k = (Columns != 0) ? Columns : result.columns();
+    auto indices = make_buffer<std::size_t, Rows>(n);
+    auto samples = make_buffer<TValue, Rows>(n);
+    auto values = make_buffer<TValue, Rows>(n);
+
+    // Create the interval centres to select from.
+    const auto step = static_cast<TValue>(1) / static_cast<TValue>(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        samples[i] = (i + half) * step;
+    }
+
+    // Create the samples from 'values'.
+    for (std::size_t c = 0; c < k; ++c) {
+        for (std::size_t r = 0; r < n; ++r) {
+            values[r] = static_cast<TValue>(distribution(rng));
+        }
+
+        order_into(indices.begin(), values.begin(), values.end());
+
+        for (std::size_t r = 0; r < n; ++r) {
+            result(r, c) = samples[indices[r]];
+        }
+    }
+
+    ASSERT_VALID_LHS(result);
+    return result;
+}
@@ -0,0 +1,43 @@
+﻿// <copyright file="column_validity.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_COLUMN_VALIDITY_H)
+#define _LHS_COLUMN_VALIDITY_H
+#pragma once
+
+#include "visus/lhs/api.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Describes the result of validating a single column (parameter) of a Latin
+/// hypercube sample.
+/// </summary>
+enum class column_validity {
+
+    /// <summary>
+    /// The column is a permutation of the strata, i.e. every stratum has been
+    /// sampled exactly once.
+    /// </summary>
+    valid,
+
+    /// <summary>
+    /// At least one stratum has been sampled more than once, which implies
+    /// that another one has not been sampled at all.
+    /// </summary>
+    duplicate,
+
+    /// <summary>
+    /// At least one element of the column is not a valid index of a stratum,
+    /// or a floating-point element is not within the unit interval.
+    /// </summary>
+    out_of_range
+};
+
+LHS_NAMESPACE_END
+
+#endif /* !defined(_LHS_COLUMN_VALIDITY_H) */
@@ -0,0 +1,377 @@
+﻿// <copyright file="correlation.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_CORRELATION_H)
+#define _LHS_CORRELATION_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdlib>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/static_matrix.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Tracks the pairwise Pearson correlation between the columns (parameters)
+/// of a Latin hypercube sample.
+/// </summary>
+/// <remarks>
+/// <para>The tracker keeps the per-column sums, the sums of squares and the
+/// pairwise cross-products of the columns. Swapping two rows within a column
+/// does not change the sums and the sums of squares of the column, but only
+/// the cross-products with all other columns. Therefore, the statistics can be
+/// updated in O(k) for k parameters after such a swap, which is the elementary
+/// operation of the optimisers for Latin hypercube samples. Retrieving the
+/// correlation between two columns is O(1) and does not touch the sample.
+/// </para>
+/// <para>The tracker does not hold a reference to the sample it has been
+/// created for. Callers must make sure to pass the same sample to
+/// <see cref="evaluate" /> and <see cref="swap" /> and that the sample is not
+/// modified by other means.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the matrix elements, which can be
+/// integral indices or floating-point numbers.</typeparam>
+template<class TValue> class column_correlation final {
+    static_assert(std::is_arithmetic_v<TValue>, "The elements of the sample "
+        "must be numbers.");
+
+public:
+
+    /// <summary>
+    /// The type used to accumulate the statistics and to express the
+    /// correlation coefficients.
+    /// </summary>
+    /// <remarks>
+    /// Sums of integral indices are exact in this type as long as the sum of
+    /// the squares in a column does not exceed 2^53, which is the case for
+    /// samples with up to about 200,000 rows.
+    /// </remarks>
+    typedef double accumulator_type;
+
+    /// <summary>
+    /// The type of the matrix elements.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance from the given view of a sample, which costs
+    /// O(n * k * k) for n samples and k parameters.
+    /// </summary>
+    /// <typeparam name="T">The type of the elements of the view, which is
+    /// <typeparamref name="TValue" /> or its <c>const</c> version.</typeparam>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <param name="lhs">The Latin hypercube sample to compute the
+    /// correlations for.</param>
+    template<class T, matrix_layout Layout,
+        class = std::enable_if_t<std::is_same_v<std::remove_const_t<T>,
+            TValue>>>
+    explicit column_correlation(_In_ const matrix_view<T, Layout> lhs);
+
+    /// <summary>
+    /// Initialises a new instance from the given sample, which costs
+    /// O(n * k * k) for n samples and k parameters.
+    /// </summary>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+    /// <param name="lhs">The Latin hypercube sample to compute the
+    /// correlations for.</param>
+    template<matrix_layout Layout, class TAllocator>
+    inline explicit column_correlation(
+            _In_ const matrix<TValue, Layout, TAllocator>& lhs)
+        : column_correlation(matrix_view<const TValue, Layout>(lhs)) { }
+
+    /// <summary>
+    /// Initialises a new instance from the given fixed-size sample, which
+    /// costs O(n * k * k) for n samples and k parameters.
+    /// </summary>
+    /// <typeparam name="Rows">The number of rows in the matrix.</typeparam>
+    /// <typeparam name="Columns">The number of columns in the matrix.
+    /// </typeparam>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <param name="lhs">The Latin hypercube sample to compute the
+    /// correlations for.</param>
+    template<std::size_t Rows, std::size_t Columns, matrix_layout Layout>
+    inline explicit column_correlation(
+            _In_ const static_matrix<TValue, Rows, Columns, Layout>& lhs)
+        : column_correlation(matrix_view<const TValue, Layout>(lhs)) { }
+
+    /// <summary>
+    /// Answer the number of columns (parameters) tracked.
+    /// </summary>
+    /// <returns>The number of columns.</returns>
+    inline std::size_t columns(void) const noexcept {
+        return this->_sums.size();
+    }
+
+    /// <summary>
+    /// Answer the change of the maximum absolute correlation of
+    /// <paramref name="column" /> with any other column if rows
+    /// <paramref name="row1" /> and <paramref name="row2" /> were swapped.
+    /// </summary>
+    /// <remarks>
+    /// This method is the hook for optimisers: it allows for testing a
+    /// candidate swap in O(k) without modifying the sample or the tracker.
+    /// </remarks>
+    /// <typeparam name="T">The type of the elements of the view, which is
+    /// <typeparamref name="TValue" /> or its <c>const</c> version.</typeparam>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <param name="lhs">A view of the sample the tracker has been created
+    /// for.</param>
+    /// <param name="row1">The zero-based index of the first row to swap.
+    /// </param>
+    /// <param name="row2">The zero-based index of the second row to swap.
+    /// </param>
+    /// <param name="column">The zero-based index of the column in which the
+    /// rows would be swapped.</param>
+    /// <returns>The maximum absolute correlation of <paramref name="column" />
+    /// with any other column after the swap.</returns>
+    template<class T, matrix_layout Layout>
+    std::enable_if_t<std::is_same_v<std::remove_const_t<T>, TValue>,
+        accumulator_type>
+    evaluate(_In_ const matrix_view<T, Layout> lhs,
+        _In_ const std::size_t row1,
+        _In_ const std::size_t row2,
+        _In_ const std::size_t column) const;
+
+    /// <summary>
+    /// Answer the change of the maximum absolute correlation of
+    /// <paramref name="column" /> with any other column if rows
+    /// <paramref name="row1" /> and <paramref name="row2" /> were swapped.
+    /// </summary>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+    /// <param name="lhs">The sample the tracker has been created for.</param>
+    /// <param name="row1">The zero-based index of the first row to swap.
+    /// </param>
+    /// <param name="row2">The zero-based index of the second row to swap.
+    /// </param>
+    /// <param name="column">The zero-based index of the column in which the
+    /// rows would be swapped.</param>
+    /// <returns>The maximum absolute correlation of <paramref name="column" />
+    /// with any other column after the swap.</returns>
+    template<matrix_layout Layout, class TAllocator>
+    inline accumulator_type evaluate(
+            _In_ const matrix<TValue, Layout, TAllocator>& lhs,
+            _In_ const std::size_t row1,
+            _In_ const std::size_t row2,
+            _In_ const std::size_t column) const {
+        return this->evaluate(matrix_view<const TValue, Layout>(lhs),
+            row1, row2, column);
+    }
+
+    /// <summary>
+    /// Answer the change of the maximum absolute correlation of
+    /// <paramref name="column" /> with any other column if rows
+    /// <paramref name="row1" /> and <paramref name="row2" /> were swapped.
+    /// </summary>
+    /// <typeparam name="Rows">The number of rows in the matrix.</typeparam>
+    /// <typeparam name="Columns">The number of columns in the matrix.
+    /// </typeparam>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <param name="lhs">The sample the tracker has been created for.</param>
+    /// <param name="row1">The zero-based index of the first row to swap.
+    /// </param>
+    /// <param name="row2">The zero-based index of the second row to swap.
+    /// </param>
+    /// <param name="column">The zero-based index of the column in which the
+    /// rows would be swapped.</param>
+    /// <returns>The maximum absolute correlation of <paramref name="column" />
+    /// with any other column after the swap.</returns>
+    template<std::size_t Rows, std::size_t Columns, matrix_layout Layout>
+    inline accumulator_type evaluate(
+            _In_ const static_matrix<TValue, Rows, Columns, Layout>& lhs,
+            _In_ const std::size_t row1,
+            _In_ const std::size_t row2,
+            _In_ const std::size_t column) const {
+        return this->evaluate(matrix_view<const TValue, Layout>(lhs),
+            row1, row2, column);
+    }
+
+    /// <summary>
+    /// Answer the maximum absolute correlation between any two columns.
+    /// </summary>
+    /// <remarks>
+    /// This operation is O(k * k), but independent of the number of rows.
+    /// </remarks>
+    /// <returns>The maximum absolute pairwise correlation, which is zero if
+    /// there are less than two columns.</returns>
+    accumulator_type maximum(void) const noexcept;
+
+    /// <summary>
+    /// Answer the maximum absolute correlation between the given
+    /// <paramref name="column" /> and any other column in O(k).
+    /// </summary>
+    /// <param name="column">The zero-based index of the column to get the
+    /// correlation for.</param>
+    /// <returns>The maximum absolute correlation of the column.</returns>
+    accumulator_type maximum(_In_ const std::size_t column) const noexcept;
+
+    /// <summary>
+    /// Swaps the elements <paramref name="row1" /> and <paramref name="row2" />
+    /// in <paramref name="column" /> of <paramref name="lhs" /> and updates the
+    /// statistics in O(k).
+    /// </summary>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <param name="lhs">A view of the sample the tracker has been created
+    /// for.</param>
+    /// <param name="row1">The zero-based index of the first row to swap.
+    /// </param>
+    /// <param name="row2">The zero-based index of the second row to swap.
+    /// </param>
+    /// <param name="column">The zero-based index of the column in which the
+    /// rows are swapped.</param>
+    template<matrix_layout Layout>
+    void swap(_In_ const matrix_view<TValue, Layout> lhs,
+        _In_ const std::size_t row1,
+        _In_ const std::size_t row2,
+        _In_ const std::size_t column);
+
+    /// <summary>
+    /// Swaps the elements <paramref name="row1" /> and <paramref name="row2" />
+    /// in <paramref name="column" /> of <paramref name="lhs" /> and updates the
+    /// statistics in O(k).
+    /// </summary>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+    /// <param name="lhs">The sample the tracker has been created for.</param>
+    /// <param name="row1">The zero-based index of the first row to swap.
+    /// </param>
+    /// <param name="row2">The zero-based index of the second row to swap.
+    /// </param>
+    /// <param name="column">The zero-based index of the column in which the
+    /// rows are swapped.</param>
+    template<matrix_layout Layout, class TAllocator>
+    inline void swap(_Inout_ matrix<TValue, Layout, TAllocator>& lhs,
+            _In_ const std::size_t row1,
+            _In_ const std::size_t row2,
+            _In_ const std::size_t column) {
+        this->swap(matrix_view<TValue, Layout>(lhs), row1, row2, column);
+    }
+
+    /// <summary>
+    /// Swaps the elements <paramref name="row1" /> and <paramref name="row2" />
+    /// in <paramref name="column" /> of <paramref name="lhs" /> and updates the
+    /// statistics in O(k).
+    /// </summary>
+    /// <typeparam name="Rows">The number of rows in the matrix.</typeparam>
+    /// <typeparam name="Columns">The number of columns in the matrix.
+    /// </typeparam>
+    /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+    /// <param name="lhs">The sample the tracker has been created for.</param>
+    /// <param name="row1">The zero-based index of the first row to swap.
+    /// </param>
+    /// <param name="row2">The zero-based index of the second row to swap.
+    /// </param>
+    /// <param name="column">The zero-based index of the column in which the
+    /// rows are swapped.</param>
+    template<std::size_t Rows, std::size_t Columns, matrix_layout Layout>
+    inline void swap(
+            _Inout_ static_matrix<TValue, Rows, Columns, Layout>& lhs,
+            _In_ const std::size_t row1,
+            _In_ const std::size_t row2,
+            _In_ const std::size_t column) {
+        this->swap(matrix_view<TValue, Layout>(lhs), row1, row2, column);
+    }
+
+    /// <summary>
+    /// Answer the Pearson correlation between the given columns.
+    /// </summary>
+    /// <param name="column1">The zero-based index of the first column.</param>
+    /// <param name="column2">The zero-based index of the second column.</param>
+    /// <returns>The correlation coefficient within [-1, 1], or zero if one of
+    /// the columns has no variance.</returns>
+    inline accumulator_type operator ()(
+            _In_ const std::size_t column1,
+            _In_ const std::size_t column2) const noexcept {
+        return this->correlation(column1, column2,
+            this->_products(column1, column2));
+    }
+
+private:
+
+    /// <summary>
+    /// Computes the correlation between two columns assuming that the sum of
+    /// their element-wise products is <paramref name="product" />.
+    /// </summary>
+    accumulator_type correlation(_In_ const std::size_t column1,
+        _In_ const std::size_t column2,
+        _In_ const accumulator_type product) const noexcept;
+
+    matrix<accumulator_type> _products;
+    std::size_t _rows;
+    std::vector<accumulator_type> _squares;
+    std::vector<accumulator_type> _sums;
+};
+
+
+/// <summary>
+/// Computes the maximum absolute pairwise correlation between the columns
+/// of the sample viewed by <paramref name="lhs" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements, which may be
+/// <c>const</c>-qualified.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="lhs">A view of the Latin hypercube sample to be checked.
+/// </param>
+/// <returns>The maximum absolute correlation between any pair of parameters.
+/// </returns>
+template<class TValue, matrix_layout Layout>
+inline typename column_correlation<std::remove_const_t<TValue>>
+    ::accumulator_type max_correlation(
+        _In_ const matrix_view<TValue, Layout> lhs) {
+    return column_correlation<std::remove_const_t<TValue>>(lhs).maximum();
+}
+
+/// <summary>
+/// Computes the maximum absolute pairwise correlation between the columns
+/// of <paramref name="lhs" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="lhs">The Latin hypercube sample to be checked.</param>
+/// <returns>The maximum absolute correlation between any pair of parameters.
+/// </returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline typename column_correlation<TValue>::accumulator_type max_correlation(
+        _In_ const matrix<TValue, Layout, TAllocator>& lhs) {
+    return max_correlation(matrix_view<const TValue, Layout>(lhs));
+}
+
+/// <summary>
+/// Computes the maximum absolute pairwise correlation between the columns
+/// of the fixed-size sample <paramref name="lhs" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Rows">The number of rows in the matrix.</typeparam>
+/// <typeparam name="Columns">The number of columns in the matrix.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="lhs">The Latin hypercube sample to be checked.</param>
+/// <returns>The maximum absolute correlation between any pair of parameters.
+/// </returns>
+template<class TValue,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout>
+inline typename column_correlation<TValue>::accumulator_type max_correlation(
+        _In_ const static_matrix<TValue, Rows, Columns, Layout>& lhs) {
+    return max_correlation(matrix_view<const TValue, Layout>(lhs));
+}
+
+LHS_NAMESPACE_END
+
+#include "visus/lhs/correlation.inl"
+
+#endif /* !defined(_LHS_CORRELATION_H) */
@@ -0,0 +1,175 @@
+﻿// <copyright file="correlation.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::column_correlation<TValue>::column_correlation
+ */
+template<class TValue>
+template<class T, LHS_NAMESPACE::matrix_layout Layout, class>
+LHS_NAMESPACE::column_correlation<TValue>::column_correlation(
+        _In_ const matrix_view<T, Layout> lhs)
+    : _products(lhs.columns(), lhs.columns()),
+        _rows(lhs.rows()),
+        _squares(lhs.columns(), static_cast<accumulator_type>(0)),
+        _sums(lhs.columns(), static_cast<accumulator_type>(0)) {
+    const auto k = lhs.columns();
+
+    for (std::size_t r = 0; r < this->_rows; ++r) {
+        for (std::size_t c = 0; c < k; ++c) {
+            const auto v = static_cast<accumulator_type>(lhs(r, c));
+            this->_sums[c] += v;
+            this->_squares[c] += v * v;
+
+            for (std::size_t d = c + 1; d < k; ++d) {
+                this->_products(c, d) += v
+                    * static_cast<accumulator_type>(lhs(r, d));
+            }
+        }
+    }
+
+    // Mirror the upper triangle such that we do not need to care about the
+    // order of the columns when looking up the products.
+    for (std::size_t c = 0; c < k; ++c) {
+        this->_products(c, c) = this->_squares[c];
+        for (std::size_t d = c + 1; d < k; ++d) {
+            this->_products(d, c) = this->_products(c, d);
+        }
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::column_correlation<TValue>::evaluate
+ */
+template<class TValue>
+template<class T, LHS_NAMESPACE::matrix_layout Layout>
+std::enable_if_t<std::is_same_v<std::remove_const_t<T>, TValue>,
+    typename LHS_NAMESPACE::column_correlation<TValue>::accumulator_type>
+LHS_NAMESPACE::column_correlation<TValue>::evaluate(
+        _In_ const matrix_view<T, Layout> lhs,
+        _In_ const std::size_t row1,
+        _In_ const std::size_t row2,
+        _In_ const std::size_t column) const {
+    assert(lhs.rows() == this->_rows);
+    assert(lhs.columns() == this->columns());
+    assert(row1 < this->_rows);
+    assert(row2 < this->_rows);
+    assert(column < this->columns());
+    // Swapping a and b in 'column' changes the product with column d by
+    // (b - a) * x(row1, d) + (a - b) * x(row2, d).
+    const auto delta = static_cast<accumulator_type>(lhs(row2, column))
+        - static_cast<accumulator_type>(lhs(row1, column));
+    auto retval = static_cast<accumulator_type>(0);
+
+    for (std::size_t d = 0, k = this->columns(); d < k; ++d) {
+        if (d != column) {
+            const auto product = this->_products(column, d) + delta
+                * (static_cast<accumulator_type>(lhs(row1, d))
+                - static_cast<accumulator_type>(lhs(row2, d)));
+            const auto r = std::abs(this->correlation(column, d, product));
+            retval = (std::max)(retval, r);
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::column_correlation<TValue>::maximum
+ */
+template<class TValue>
+typename LHS_NAMESPACE::column_correlation<TValue>::accumulator_type
+LHS_NAMESPACE::column_correlation<TValue>::maximum(void) const noexcept {
+    auto retval = static_cast<accumulator_type>(0);
+
+    for (std::size_t c = 0, k = this->columns(); c < k; ++c) {
+        for (std::size_t d = c + 1; d < k; ++d) {
+            retval = (std::max)(retval, std::abs((*this)(c, d)));
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::column_correlation<TValue>::maximum
+ */
+template<class TValue>
+typename LHS_NAMESPACE::column_correlation<TValue>::accumulator_type
+LHS_NAMESPACE::column_correlation<TValue>::maximum(
+        _In_ const std::size_t column) const noexcept {
+    assert(column < this->columns());
+    auto retval = static_cast<accumulator_type>(0);
+
+    for (std::size_t d = 0, k = this->columns(); d < k; ++d) {
+        if (d != column) {
+            retval = (std::max)(retval, std::abs((*this)(column, d)));
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::column_correlation<TValue>::swap
+ */
+template<class TValue>
+template<LHS_NAMESPACE::matrix_layout Layout>
+void LHS_NAMESPACE::column_correlation<TValue>::swap(
+        _In_ const matrix_view<TValue, Layout> lhs,
+        _In_ const std::size_t row1,
+        _In_ const std::size_t row2,
+        _In_ const std::size_t column) {
+    assert(lhs.rows() == this->_rows);
+    assert(lhs.columns() == this->columns());
+    assert(row1 < this->_rows);
+    assert(row2 < this->_rows);
+    assert(column < this->columns());
+    const auto delta = static_cast<accumulator_type>(lhs(row2, column))
+        - static_cast<accumulator_type>(lhs(row1, column));
+
+    for (std::size_t d = 0, k = this->columns(); d < k; ++d) {
+        if (d != column) {
+            this->_products(column, d) += delta
+                * (static_cast<accumulator_type>(lhs(row1, d))
+                - static_cast<accumulator_type>(lhs(row2, d)));
+            this->_products(d, column) = this->_products(column, d);
+        }
+    }
+
+    std::swap(lhs(row1, column), lhs(row2, column));
+}
+
+
+/*
+ * LHS_NAMESPACE::column_correlation<TValue>::correlation
+ */
+template<class TValue>
+typename LHS_NAMESPACE::column_correlation<TValue>::accumulator_type
+LHS_NAMESPACE::column_correlation<TValue>::correlation(
+        _In_ const std::size_t column1,
+        _In_ const std::size_t column2,
+        _In_ const accumulator_type product) const noexcept {
+    static constexpr auto zero = static_cast<accumulator_type>(0);
+    const auto n = static_cast<accumulator_type>(this->_rows);
+    const auto s1 = this->_sums[column1];
+    const auto s2 = this->_sums[column2];
+
+    // Note: we use the uncentred formulation, because this is what allows us
+    // to update the statistics after a swap without touching the other rows.
+    const auto var1 = n * this->_squares[column1] - s1 * s1;
+    const auto var2 = n * this->_squares[column2] - s2 * s2;
+
+    if ((var1 <= zero) || (var2 <= zero)) {
+        return zero;
+    }
+
+    return (n * product - s1 * s2) / std::sqrt(var1 * var2);
+}
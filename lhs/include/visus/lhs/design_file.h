@@ -0,0 +1,282 @@
+﻿// <copyright file="design_file.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_DESIGN_FILE_H)
+#define _LHS_DESIGN_FILE_H
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "visus/lhs/aligned_allocator.h"
+#include "visus/lhs/mapped_file.h"
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/range.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Identifies the type of the elements stored in a design file.
+/// </summary>
+enum class element_type : std::uint32_t {
+    uint8 = 1,
+    uint16,
+    uint32,
+    uint64,
+    int8,
+    int16,
+    int32,
+    int64,
+    float32,
+    float64
+};
+
+
+/// <summary>
+/// Describes how a design stored in a file has been created.
+/// </summary>
+struct design_info final {
+
+    /// <summary>
+    /// The name of the generator that created the design, which must not be
+    /// longer than 63 characters.
+    /// </summary>
+    std::string generator;
+
+    /// <summary>
+    /// The seed of the random number generator used to create the design.
+    /// </summary>
+    std::uint64_t seed = 0;
+
+    /// <summary>
+    /// The parameter ranges the design has been scaled to, which may be empty
+    /// for designs in the unit hypercube or for designs of indices.
+    /// </summary>
+    std::vector<range<double>> parameters;
+};
+
+
+/// <summary>
+/// Writes <paramref name="design" /> into a binary design file that can be
+/// mapped using <see cref="mapped_design" />.
+/// </summary>
+/// <remarks>
+/// <para>The file starts with a header of 128 bytes holding the magic number
+/// &quot;VISUSLHS&quot;, the version of the format, a byte-order marker, the
+/// <see cref="element_type" />, the <see cref="matrix_layout" />, the number
+/// of rows and columns, the seed, the number of parameter ranges, the offset
+/// of the payload and the name of the generator. The parameter ranges follow
+/// as pairs of <c>double</c>s. The payload starts at the next multiple of 64
+/// bytes and holds the elements densely packed in the layout of the matrix.
+/// </para>
+/// <para>All numbers are stored in the byte order of the machine writing the
+/// file. Readers on machines with a different byte order will reject the
+/// file.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements, which must be an
+/// integral or a floating-point type with a size of up to eight bytes.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="path">The path to the file to be written. An existing file
+/// will be overwritten.</param>
+/// <param name="design">The design to be written.</param>
+/// <param name="info">Information about the design to be stored in the header.
+/// </param>
+/// <exception cref="std::invalid_argument">If the name of the generator is
+/// too long.</exception>
+/// <exception cref="std::ios_base::failure">If the file could not be
+/// written.</exception>
+template<class TValue, matrix_layout Layout>
+void save_design(_In_ const std::filesystem::path& path,
+    _In_ const matrix_view<TValue, Layout> design,
+    _In_ const design_info& info = design_info());
+
+/// <summary>
+/// Writes <paramref name="design" /> into a binary design file that can be
+/// mapped using <see cref="mapped_design" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements, which must be an
+/// integral or a floating-point type with a size of up to eight bytes.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="path">The path to the file to be written. An existing file
+/// will be overwritten.</param>
+/// <param name="design">The design to be written.</param>
+/// <param name="info">Information about the design to be stored in the header.
+/// </param>
+/// <exception cref="std::invalid_argument">If the name of the generator is
+/// too long.</exception>
+/// <exception cref="std::ios_base::failure">If the file could not be
+/// written.</exception>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline void save_design(_In_ const std::filesystem::path& path,
+        _In_ const matrix<TValue, Layout, TAllocator>& design,
+        _In_ const design_info& info = design_info()) {
+    save_design(path, matrix_view<const TValue, Layout>(design), info);
+}
+
+
+/// <summary>
+/// Provides zero-copy, read-only access to a design file written by
+/// <see cref="save_design" />.
+/// </summary>
+/// <remarks>
+/// The file is mapped into memory rather than being read, wherefore opening
+/// even large designs is instantaneous and the pages of the design can be
+/// shared between multiple processes opening the same file. The view of the
+/// design remains valid as long as the instance exists.
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements, which must match the
+/// type stored in the file.</typeparam>
+/// <typeparam name="Layout">The layout of the design, which must match the
+/// layout stored in the file.</typeparam>
+template<class TValue, matrix_layout Layout = matrix_layout::row_major>
+class mapped_design final {
+
+public:
+
+    /// <summary>
+    /// The type of the elements of the design.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// The type of the view of the design.
+    /// </summary>
+    typedef matrix_view<const TValue, Layout> view_type;
+
+    /// <summary>
+    /// Maps the design file at <paramref name="path" />.
+    /// </summary>
+    /// <param name="path">The path to the design file.</param>
+    /// <exception cref="std::system_error">If the file could not be mapped.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the file is not a valid
+    /// design file or if the type or the layout of the elements does not
+    /// match <typeparamref name="TValue" /> and
+    /// <typeparamref name="Layout" />.</exception>
+    explicit mapped_design(_In_ const std::filesystem::path& path);
+
+    /// <summary>
+    /// Answer the number of parameters in the design.
+    /// </summary>
+    /// <returns>The number of columns.</returns>
+    inline std::size_t columns(void) const noexcept {
+        return this->_view.columns();
+    }
+
+    /// <summary>
+    /// Answer the information stored along with the design.
+    /// </summary>
+    /// <returns>The information about the design.</returns>
+    inline const design_info& info(void) const noexcept {
+        return this->_info;
+    }
+
+    /// <summary>
+    /// Answer the number of samples in the design.
+    /// </summary>
+    /// <returns>The number of rows.</returns>
+    inline std::size_t rows(void) const noexcept {
+        return this->_view.rows();
+    }
+
+    /// <summary>
+    /// Answer a view of the mapped design.
+    /// </summary>
+    /// <returns>A read-only view of the design, which is valid as long as the
+    /// instance exists.</returns>
+    inline view_type view(void) const noexcept {
+        return this->_view;
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="row">The zero-based row of the element.</param>
+    /// <param name="column">The zero-based column of the element.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline const value_type& operator ()(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        return this->_view(row, column);
+    }
+
+private:
+
+    mapped_file _file;
+    design_info _info;
+    view_type _view;
+};
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The version of the design file format.
+/// </summary>
+constexpr const std::uint32_t design_file_version = 1;
+
+/// <summary>
+/// The alignment of the payload of a design file in bytes.
+/// </summary>
+constexpr const std::size_t design_file_alignment = 64;
+
+/// <summary>
+/// The in-memory representation of the header of a design file.
+/// </summary>
+struct design_header final {
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t byte_order;
+    std::uint32_t type;
+    std::uint32_t layout;
+    std::uint64_t rows;
+    std::uint64_t columns;
+    std::uint64_t seed;
+    std::uint64_t parameters;
+    std::uint64_t payload;
+    char generator[64];
+};
+
+static_assert(sizeof(design_header) == 128, "The header of a design file "
+    "must be 128 bytes.");
+
+/// <summary>
+/// Answer the magic number at the begin of a design file.
+/// </summary>
+/// <returns>The magic number, which is not zero-terminated.</returns>
+inline constexpr const char *design_file_magic(void) noexcept {
+    return "VISUSLHS";
+}
+
+/// <summary>
+/// Answer the <see cref="element_type" /> used to store elements of type
+/// <typeparamref name="TValue" /> in a design file.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements.</typeparam>
+/// <returns>The identifier of the element type.</returns>
+template<class TValue>
+constexpr element_type element_type_of(void) noexcept;
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/design_file.inl"
+
+#endif /* !defined(_LHS_DESIGN_FILE_H) */
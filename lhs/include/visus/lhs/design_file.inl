@@ -0,0 +1,176 @@
+﻿// <copyright file="design_file.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::save_design
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+void LHS_NAMESPACE::save_design(_In_ const std::filesystem::path& path,
+        _In_ const matrix_view<TValue, Layout> design,
+        _In_ const design_info& info) {
+    typedef std::remove_cv_t<TValue> value_type;
+    detail::design_header header { };
+
+    if (info.generator.size() >= sizeof(header.generator)) {
+        throw std::invalid_argument("The name of the generator must not be "
+            "longer than 63 characters.");
+    }
+
+    const auto parameters = info.parameters.size() * 2 * sizeof(double);
+    std::memcpy(header.magic, detail::design_file_magic(),
+        sizeof(header.magic));
+    header.version = detail::design_file_version;
+    header.byte_order = 0x01020304;
+    header.type = static_cast<std::uint32_t>(
+        detail::element_type_of<value_type>());
+    header.layout = static_cast<std::uint32_t>(Layout);
+    header.rows = design.rows();
+    header.columns = design.columns();
+    header.seed = info.seed;
+    header.parameters = info.parameters.size();
+    header.payload = detail::round_up(sizeof(header) + parameters,
+        detail::design_file_alignment);
+    std::copy(info.generator.begin(), info.generator.end(), header.generator);
+
+    std::ofstream stream;
+    stream.exceptions(std::ios::badbit | std::ios::failbit);
+    stream.open(path, std::ios::binary | std::ios::trunc);
+
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+    for (auto& p : info.parameters) {
+        const double range[] = { p.begin(), p.end() };
+        stream.write(reinterpret_cast<const char *>(range), sizeof(range));
+    }
+
+    {
+        const char padding[detail::design_file_alignment] = { 0 };
+        const auto size = header.payload - sizeof(header) - parameters;
+        stream.write(padding, size);
+    }
+
+    // Write the matrix line by line, which drops any padding of the lines.
+    const auto lines = design.row_major() ? design.rows() : design.columns();
+    const auto length = design.row_major() ? design.columns() : design.rows();
+    for (std::size_t l = 0; l < lines; ++l) {
+        stream.write(
+            reinterpret_cast<const char *>(design.data() + l * design.stride()),
+            length * sizeof(value_type));
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::mapped_design<TValue, Layout>::mapped_design
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+LHS_NAMESPACE::mapped_design<TValue, Layout>::mapped_design(
+        _In_ const std::filesystem::path& path) : _file(path) {
+    const auto data = static_cast<const char *>(this->_file.data());
+    const auto size = this->_file.size();
+    detail::design_header header;
+
+    if (size < sizeof(header)) {
+        throw std::invalid_argument("The file is too small to hold the "
+            "header of a design file.");
+    }
+
+    std::memcpy(&header, data, sizeof(header));
+
+    if (std::memcmp(header.magic, detail::design_file_magic(),
+            sizeof(header.magic)) != 0) {
+        throw std::invalid_argument("The file is not a design file.");
+    }
+    if (header.version != detail::design_file_version) {
+        throw std::invalid_argument("The version of the design file is not "
+            "supported.");
+    }
+    if (header.byte_order != 0x01020304) {
+        throw std::invalid_argument("The design file has been written on a "
+            "machine with a different byte order.");
+    }
+    if (header.type != static_cast<std::uint32_t>(
+            detail::element_type_of<TValue>())) {
+        throw std::invalid_argument("The type of the elements in the design "
+            "file does not match the requested type.");
+    }
+    if (header.layout != static_cast<std::uint32_t>(Layout)) {
+        throw std::invalid_argument("The layout of the design file does not "
+            "match the requested layout.");
+    }
+
+    // Check the sizes in a way that cannot overflow for malicious headers.
+    const auto max_parameters = (size - sizeof(header))
+        / (2 * sizeof(double));
+    if (header.parameters > max_parameters) {
+        throw std::invalid_argument("The design file is truncated.");
+    }
+    if ((header.payload < sizeof(header) + header.parameters * 2
+            * sizeof(double))
+            || (header.payload > size)
+            || (header.payload % detail::design_file_alignment != 0)) {
+        throw std::invalid_argument("The offset of the payload in the design "
+            "file is invalid.");
+    }
+
+    const auto max_elements = (size - header.payload) / sizeof(TValue);
+    if ((header.columns != 0)
+            && (header.rows > max_elements / header.columns)) {
+        throw std::invalid_argument("The design file is truncated.");
+    }
+
+    this->_info.seed = header.seed;
+    this->_info.generator.assign(header.generator,
+        std::find(header.generator,
+            header.generator + sizeof(header.generator),
+            '\0'));
+
+    this->_info.parameters.reserve(header.parameters);
+    for (std::size_t i = 0; i < header.parameters; ++i) {
+        double range[2];
+        std::memcpy(range, data + sizeof(header) + i * sizeof(range),
+            sizeof(range));
+        this->_info.parameters.emplace_back(range[0], range[1]);
+    }
+
+    this->_view = view_type(
+        reinterpret_cast<const TValue *>(data + header.payload),
+        static_cast<std::size_t>(header.rows),
+        static_cast<std::size_t>(header.columns));
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::element_type_of
+ */
+template<class TValue>
+constexpr LHS_NAMESPACE::element_type
+LHS_DETAIL_NAMESPACE::element_type_of(void) noexcept {
+    static_assert((std::is_integral_v<TValue>
+        && !std::is_same_v<TValue, bool>
+        && (sizeof(TValue) <= 8))
+        || (std::is_floating_point_v<TValue>
+        && ((sizeof(TValue) == 4) || (sizeof(TValue) == 8))),
+        "The type cannot be stored in a design file.");
+
+    if constexpr (std::is_floating_point_v<TValue>) {
+        return (sizeof(TValue) == 4)
+            ? element_type::float32
+            : element_type::float64;
+
+    } else {
+        // Note: the enumeration lists the types with increasing size.
+        const auto base = std::is_signed_v<TValue>
+            ? static_cast<std::uint32_t>(element_type::int8)
+            : static_cast<std::uint32_t>(element_type::uint8);
+        const auto offset = (sizeof(TValue) == 1) ? 0
+            : (sizeof(TValue) == 2) ? 1
+            : (sizeof(TValue) == 4) ? 2
+            : 3;
+        return static_cast<element_type>(base + offset);
+    }
+}
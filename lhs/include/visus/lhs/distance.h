@@ -15,7 +15,7 @@
 #include <type_traits>
 #include <vector>
 
-#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
 
 
 LHS_DETAIL_NAMESPACE_BEGIN
@@ -95,6 +95,25 @@ square_distance(
         square_difference<value_type>);
 }
 
+/// <summary>
+/// Computes the squared distance between two vectors, which typically are
+/// rows or columns of a matrix.
+/// </summary>
+/// <remarks>
+/// If both views are contiguous, the distance is computed on the raw memory,
+/// which allows the compiler to vectorise the computation.
+/// </remarks>
+/// <typeparam name="TValue">A numeric type that supports multiplication and
+/// addition, which may be <c>const</c>-qualified.</typeparam>
+/// <param name="lhs">The left-hand-side operand.</param>
+/// <param name="rhs">The right-hand-side operand.</param>
+/// <returns>The squared distance between the two operands.</returns>
+template<class TValue>
+std::enable_if_t<std::is_arithmetic_v<std::remove_const_t<TValue>>,
+    std::remove_const_t<TValue>>
+square_distance(_In_ const vector_view<TValue> lhs,
+    _In_ const vector_view<TValue> rhs) noexcept;
+
 /// <summary>
 /// Computes the squared distances between all pairs of rows in a matrix.
 /// </summary>
@@ -103,12 +122,32 @@ square_distance(
 /// <param name="result">Receives the distances, first from the first row to
 /// all subsequent ones, then from the second one to all subsequent ones, etc.
 /// This is effectively a triangular matrix omitting all duplicates.</param>
-/// <param name="mat">The matrix to compute the distances for.</param>
+/// <param name="mat">A view of the matrix to compute the distances for.
+/// </param>
 /// <returns><paramref name="result" />.</returns>
 template<class TValue, matrix_layout Layout>
 std::enable_if_t<std::is_arithmetic_v<TValue>, std::vector<TValue>&>
 square_row_distances(_Out_ std::vector<TValue>& result,
-    _In_ const matrix<TValue, Layout>& mat);
+    _In_ const matrix_view<const TValue, Layout> mat);
+
+/// <summary>
+/// Computes the squared distances between all pairs of rows in a matrix.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements in the matrix.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="result">Receives the distances, first from the first row to
+/// all subsequent ones, then from the second one to all subsequent ones, etc.
+/// This is effectively a triangular matrix omitting all duplicates.</param>
+/// <param name="mat">The matrix to compute the distances for.</param>
+/// <returns><paramref name="result" />.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline std::enable_if_t<std::is_arithmetic_v<TValue>, std::vector<TValue>&>
+square_row_distances(_Out_ std::vector<TValue>& result,
+        _In_ const matrix<TValue, Layout, TAllocator>& mat) {
+    return square_row_distances(result,
+        matrix_view<const TValue, Layout>(mat));
+}
 
 LHS_DETAIL_NAMESPACE_END
 
@@ -5,6 +5,32 @@
 // <author>Christoph Müller</author>
 
 
+/*
+ * LHS_DETAIL_NAMESPACE::square_distance
+ */
+template<class TValue>
+std::enable_if_t<std::is_arithmetic_v<std::remove_const_t<TValue>>,
+    std::remove_const_t<TValue>>
+LHS_DETAIL_NAMESPACE::square_distance(_In_ const vector_view<TValue> lhs,
+        _In_ const vector_view<TValue> rhs) noexcept {
+    typedef std::remove_const_t<TValue> value_type;
+    assert(lhs.size() == rhs.size());
+
+    if (lhs.contiguous() && rhs.contiguous()) {
+        return square_distance(lhs.data(),
+            lhs.data() + lhs.size(),
+            rhs.data());
+    } else {
+        return std::inner_product(lhs.begin(),
+            lhs.end(),
+            rhs.begin(),
+            static_cast<value_type>(0),
+            std::plus<value_type>(),
+            square_difference<value_type>);
+    }
+}
+
+
 /*
  * LHS_DETAIL_NAMESPACE::square_row_distances
  */
@@ -12,7 +38,7 @@ template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
 std::enable_if_t<std::is_arithmetic_v<TValue>,std::vector<TValue>&>
 LHS_DETAIL_NAMESPACE::square_row_distances(
         _Out_ std::vector<TValue>& result,
-        _In_ const matrix<TValue, Layout>& mat) {
+        _In_ const matrix_view<const TValue, Layout> mat) {
     constexpr auto one = static_cast<std::size_t>(1);
     const auto rows = mat.rows();
 
@@ -20,11 +46,10 @@ LHS_DETAIL_NAMESPACE::square_row_distances(
     result.reserve((rows * ((std::max)(one, rows) - one)) / 2);
 
     for (std::size_t i = 0; i + 1 < rows; ++i) {
+        const auto lhs = row_view(mat, i);
+
         for (std::size_t j = i + 1; j < rows; ++j) {
-            result.push_back(square_distance(
-                mat.begin_row(i),
-                mat.end_row(i),
-                mat.begin_row(j)));
+            result.push_back(square_distance(lhs, row_view(mat, j)));
         }
     }
 
@@ -0,0 +1,661 @@
+﻿// <copyright file="distributions.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_DISTRIBUTIONS_H)
+#define _LHS_DISTRIBUTIONS_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "visus/lhs/api.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// A normal distribution, which can be used to transform the values of a
+/// unit hypercube sample via its inverse cumulative distribution function.
+/// </summary>
+/// <remarks>
+/// <para>The quantile function uses algorithm AS 241 (PPND16) by Wichura,
+/// which has a relative error of about 1e-16. All computations are carried
+/// out in <c>double</c>.</para>
+/// <para>The probabilities 0 and 1 map to negative and positive infinity,
+/// respectively.</para>
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type of the values.
+/// </typeparam>
+template<class TValue> class normal_distribution final {
+    static_assert(std::is_floating_point_v<TValue>, "The values of a normal "
+        "distribution must be floating-point numbers.");
+
+public:
+
+    /// <summary>
+    /// The type of the values.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="mean">The mean of the distribution.</param>
+    /// <param name="stddev">The standard deviation of the distribution,
+    /// which must be positive.</param>
+    /// <exception cref="std::invalid_argument">If
+    /// <paramref name="stddev" /> is not positive.</exception>
+    normal_distribution(_In_ const value_type mean = static_cast<value_type>(0),
+        _In_ const value_type stddev = static_cast<value_type>(1));
+
+    /// <summary>
+    /// Answer the cumulative distribution function at
+    /// <paramref name="x" />.
+    /// </summary>
+    /// <param name="x">The value to evaluate the function at.</param>
+    /// <returns>The probability of a value being less than or equal to
+    /// <paramref name="x" />.</returns>
+    value_type cdf(_In_ const value_type x) const noexcept;
+
+    /// <summary>
+    /// Answer the mean of the distribution.
+    /// </summary>
+    /// <returns>The mean.</returns>
+    inline value_type mean(void) const noexcept {
+        return this->_mean;
+    }
+
+    /// <summary>
+    /// Answer the inverse of the cumulative distribution function at
+    /// <paramref name="p" />.
+    /// </summary>
+    /// <param name="p">A probability within [0, 1].</param>
+    /// <returns>The value whose cumulative probability is
+    /// <paramref name="p" />.</returns>
+    value_type quantile(_In_ const value_type p) const noexcept;
+
+    /// <summary>
+    /// Answer the standard deviation of the distribution.
+    /// </summary>
+    /// <returns>The standard deviation.</returns>
+    inline value_type stddev(void) const noexcept {
+        return this->_stddev;
+    }
+
+private:
+
+    value_type _mean;
+    value_type _stddev;
+};
+
+
+/// <summary>
+/// A log-normal distribution, i.e. a distribution whose logarithm is
+/// normally distributed.
+/// </summary>
+/// <remarks>
+/// The quantile function is the exponential of the one of
+/// <see cref="normal_distribution" /> and has the same relative accuracy.
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type of the values.
+/// </typeparam>
+template<class TValue> class lognormal_distribution final {
+    static_assert(std::is_floating_point_v<TValue>, "The values of a "
+        "log-normal distribution must be floating-point numbers.");
+
+public:
+
+    /// <summary>
+    /// The type of the values.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="m">The mean of the logarithm of the values.</param>
+    /// <param name="s">The standard deviation of the logarithm of the values,
+    /// which must be positive.</param>
+    /// <exception cref="std::invalid_argument">If <paramref name="s" /> is
+    /// not positive.</exception>
+    inline lognormal_distribution(
+            _In_ const value_type m = static_cast<value_type>(0),
+            _In_ const value_type s = static_cast<value_type>(1))
+        : _normal(m, s) { }
+
+    /// <summary>
+    /// Answer the cumulative distribution function at
+    /// <paramref name="x" />.
+    /// </summary>
+    /// <param name="x">The value to evaluate the function at.</param>
+    /// <returns>The probability of a value being less than or equal to
+    /// <paramref name="x" />.</returns>
+    inline value_type cdf(_In_ const value_type x) const noexcept {
+        return (x > static_cast<value_type>(0))
+            ? this->_normal.cdf(std::log(x))
+            : static_cast<value_type>(0);
+    }
+
+    /// <summary>
+    /// Answer the mean of the logarithm of the values.
+    /// </summary>
+    /// <returns>The mean of the underlying normal distribution.</returns>
+    inline value_type m(void) const noexcept {
+        return this->_normal.mean();
+    }
+
+    /// <summary>
+    /// Answer the inverse of the cumulative distribution function at
+    /// <paramref name="p" />.
+    /// </summary>
+    /// <param name="p">A probability within [0, 1].</param>
+    /// <returns>The value whose cumulative probability is
+    /// <paramref name="p" />.</returns>
+    inline value_type quantile(_In_ const value_type p) const noexcept {
+        return std::exp(this->_normal.quantile(p));
+    }
+
+    /// <summary>
+    /// Answer the standard deviation of the logarithm of the values.
+    /// </summary>
+    /// <returns>The standard deviation of the underlying normal
+    /// distribution.</returns>
+    inline value_type s(void) const noexcept {
+        return this->_normal.stddev();
+    }
+
+private:
+
+    normal_distribution<value_type> _normal;
+};
+
+
+/// <summary>
+/// A triangular distribution between a lower and an upper bound with a
+/// given mode.
+/// </summary>
+/// <remarks>
+/// The quantile function is computed in closed form.
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type of the values.
+/// </typeparam>
+template<class TValue> class triangular_distribution final {
+    static_assert(std::is_floating_point_v<TValue>, "The values of a "
+        "triangular distribution must be floating-point numbers.");
+
+public:
+
+    /// <summary>
+    /// The type of the values.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="lower">The lower bound of the values.</param>
+    /// <param name="mode">The most likely value.</param>
+    /// <param name="upper">The upper bound of the values.</param>
+    /// <exception cref="std::invalid_argument">If
+    /// <paramref name="mode" /> is not within the bounds or if the bounds are
+    /// the same.</exception>
+    triangular_distribution(_In_ const value_type lower,
+        _In_ const value_type mode,
+        _In_ const value_type upper);
+
+    /// <summary>
+    /// Answer the cumulative distribution function at
+    /// <paramref name="x" />.
+    /// </summary>
+    /// <param name="x">The value to evaluate the function at.</param>
+    /// <returns>The probability of a value being less than or equal to
+    /// <paramref name="x" />.</returns>
+    value_type cdf(_In_ const value_type x) const noexcept;
+
+    /// <summary>
+    /// Answer the lower bound of the values.
+    /// </summary>
+    /// <returns>The lower bound.</returns>
+    inline value_type lower(void) const noexcept {
+        return this->_lower;
+    }
+
+    /// <summary>
+    /// Answer the most likely value.
+    /// </summary>
+    /// <returns>The mode.</returns>
+    inline value_type mode(void) const noexcept {
+        return this->_mode;
+    }
+
+    /// <summary>
+    /// Answer the inverse of the cumulative distribution function at
+    /// <paramref name="p" />.
+    /// </summary>
+    /// <param name="p">A probability within [0, 1].</param>
+    /// <returns>The value whose cumulative probability is
+    /// <paramref name="p" />.</returns>
+    value_type quantile(_In_ const value_type p) const noexcept;
+
+    /// <summary>
+    /// Answer the upper bound of the values.
+    /// </summary>
+    /// <returns>The upper bound.</returns>
+    inline value_type upper(void) const noexcept {
+        return this->_upper;
+    }
+
+private:
+
+    value_type _lower;
+    value_type _mode;
+    value_type _upper;
+};
+
+
+/// <summary>
+/// A beta distribution on [0, 1].
+/// </summary>
+/// <remarks>
+/// <para>There is no closed form of the quantile function, so it inverts the
+/// regularised incomplete beta function using Newton's method, safeguarded
+/// by bisection, until the relative change of the result is within a few
+/// units of the machine precision. The incomplete beta function itself is
+/// evaluated using a continued fraction, which converges to a relative error
+/// of about 1e-15.</para>
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type of the values.
+/// </typeparam>
+template<class TValue> class beta_distribution final {
+    static_assert(std::is_floating_point_v<TValue>, "The values of a beta "
+        "distribution must be floating-point numbers.");
+
+public:
+
+    /// <summary>
+    /// The type of the values.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="alpha">The first shape parameter, which must be positive.
+    /// </param>
+    /// <param name="beta">The second shape parameter, which must be positive.
+    /// </param>
+    /// <exception cref="std::invalid_argument">If one of the shape parameters
+    /// is not positive.</exception>
+    beta_distribution(_In_ const value_type alpha, _In_ const value_type beta);
+
+    /// <summary>
+    /// Answer the first shape parameter.
+    /// </summary>
+    /// <returns>The first shape parameter.</returns>
+    inline value_type alpha(void) const noexcept {
+        return this->_alpha;
+    }
+
+    /// <summary>
+    /// Answer the second shape parameter.
+    /// </summary>
+    /// <returns>The second shape parameter.</returns>
+    inline value_type beta(void) const noexcept {
+        return this->_beta;
+    }
+
+    /// <summary>
+    /// Answer the cumulative distribution function at
+    /// <paramref name="x" />.
+    /// </summary>
+    /// <param name="x">The value to evaluate the function at.</param>
+    /// <returns>The probability of a value being less than or equal to
+    /// <paramref name="x" />.</returns>
+    value_type cdf(_In_ const value_type x) const noexcept;
+
+    /// <summary>
+    /// Answer the inverse of the cumulative distribution function at
+    /// <paramref name="p" />.
+    /// </summary>
+    /// <param name="p">A probability within [0, 1].</param>
+    /// <returns>The value whose cumulative probability is
+    /// <paramref name="p" />.</returns>
+    value_type quantile(_In_ const value_type p) const noexcept;
+
+private:
+
+    value_type _alpha;
+    value_type _beta;
+    double _log_beta;
+};
+
+
+/// <summary>
+/// An empirical distribution given by a dataset, for instance measurements
+/// of a parameter.
+/// </summary>
+/// <remarks>
+/// <para>The distribution keeps a table of quantiles at equidistant
+/// probabilities, which is built once from the sorted dataset. The table can
+/// optionally be down-sampled for very large datasets, which makes it small
+/// enough to stay in the cache. Between the entries of the table, the
+/// quantile function is linearly interpolated.</para>
+/// <para>As the entries of the table are equidistant in probability, the
+/// entry for a given probability is found by a multiplication rather than a
+/// search. Therefore, the quantile function has no data-dependent branches
+/// and can be vectorised by the compiler when transforming a whole column
+/// using <see cref="inverse_cdf" />.</para>
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type of the values.
+/// </typeparam>
+template<class TValue> class empirical_distribution final {
+    static_assert(std::is_floating_point_v<TValue>, "The values of an "
+        "empirical distribution must be floating-point numbers.");
+
+public:
+
+    /// <summary>
+    /// The type used to index the quantile table.
+    /// </summary>
+    typedef std::int32_t index_type;
+
+    /// <summary>
+    /// The type of the values.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// The maximum number of entries in the quantile table.
+    /// </summary>
+    static constexpr std::size_t max_size = static_cast<std::size_t>(
+        (std::numeric_limits<index_type>::max)());
+
+    /// <summary>
+    /// Initialises a new instance from the given dataset.
+    /// </summary>
+    /// <param name="data">The dataset, which will be sorted and possibly
+    /// down-sampled in place.</param>
+    /// <param name="size">The number of entries in the quantile table. If this
+    /// is zero, all values of the dataset will be retained.</param>
+    /// <exception cref="std::invalid_argument">If <paramref name="data" /> is
+    /// empty, if <paramref name="size" /> is one or if the quantile table
+    /// would exceed <see cref="max_size" /> entries.</exception>
+    explicit empirical_distribution(_In_ std::vector<value_type>&& data,
+        _In_ const std::size_t size = 0);
+
+    /// <summary>
+    /// Initialises a new instance from the given dataset.
+    /// </summary>
+    /// <typeparam name="TIterator">An iterator over numbers which can be
+    /// converted to <typeparamref name="TValue" />.</typeparam>
+    /// <param name="begin">The begin of the dataset.</param>
+    /// <param name="end">The end of the dataset.</param>
+    /// <param name="size">The number of entries in the quantile table. If this
+    /// is zero, all values of the dataset will be retained.</param>
+    /// <exception cref="std::invalid_argument">If the dataset is empty, if
+    /// <paramref name="size" /> is one or if the quantile table would exceed
+    /// <see cref="max_size" /> entries.</exception>
+    template<class TIterator>
+    inline empirical_distribution(_In_ const TIterator begin,
+            _In_ const TIterator end,
+            _In_ const std::size_t size = 0)
+        : empirical_distribution(std::vector<value_type>(begin, end), size) { }
+
+    /// <summary>
+    /// Answer the cumulative distribution function at
+    /// <paramref name="x" />.
+    /// </summary>
+    /// <remarks>
+    /// This function requires a binary search in the quantile table.
+    /// </remarks>
+    /// <param name="x">The value to evaluate the function at.</param>
+    /// <returns>The probability of a value being less than or equal to
+    /// <paramref name="x" />.</returns>
+    value_type cdf(_In_ const value_type x) const noexcept;
+
+    /// <summary>
+    /// Answer the sorted quantile table.
+    /// </summary>
+    /// <returns>The quantiles at equidistant probabilities from 0 to 1.
+    /// </returns>
+    inline const std::vector<value_type>& quantiles(void) const noexcept {
+        return this->_quantiles;
+    }
+
+    /// <summary>
+    /// Answer the inverse of the cumulative distribution function at
+    /// <paramref name="p" />.
+    /// </summary>
+    /// <param name="p">A probability within [0, 1].</param>
+    /// <returns>The value whose cumulative probability is
+    /// <paramref name="p" />.</returns>
+    value_type quantile(_In_ const value_type p) const noexcept;
+
+private:
+
+    std::vector<value_type> _quantiles;
+};
+
+
+/// <summary>
+/// Creates an <see cref="empirical_distribution{TValue}" /> from the values in
+/// <paramref name="data" />.
+/// </summary>
+/// <typeparam name="TValue">The floating-point type of the values.
+/// </typeparam>
+/// <typeparam name="TContainer">The type of the container holding the
+/// dataset.</typeparam>
+/// <param name="data">The dataset.</param>
+/// <param name="size">The number of entries in the quantile table. If this is
+/// zero, all values of the dataset will be retained.</param>
+/// <returns>The empirical distribution of the dataset.</returns>
+/// <exception cref="std::invalid_argument">If the dataset is empty, if
+/// <paramref name="size" /> is one or if the quantile table would exceed
+/// <see cref="empirical_distribution{TValue}::max_size" /> entries.
+/// </exception>
+template<class TValue = double, class TContainer>
+inline empirical_distribution<TValue> make_empirical(
+        _In_ const TContainer& data,
+        _In_ const std::size_t size = 0) {
+    using std::begin;
+    using std::end;
+    return empirical_distribution<TValue>(begin(data), end(data), size);
+}
+
+
+/// <summary>
+/// Restricts another distribution to the interval between a lower and an
+/// upper bound.
+/// </summary>
+/// <remarks>
+/// The quantile function maps the probability to the interval between the
+/// cumulative probabilities of the bounds and evaluates the quantile
+/// function of the underlying distribution. If the interval is very far in
+/// the tail of the underlying distribution, the accuracy is limited by the
+/// resolution of the cumulative probabilities there.
+/// </remarks>
+/// <typeparam name="TDistribution">The type of the underlying distribution,
+/// which must provide <c>cdf</c> and <c>quantile</c>.</typeparam>
+template<class TDistribution> class truncated_distribution final {
+
+public:
+
+    /// <summary>
+    /// The type of the underlying distribution.
+    /// </summary>
+    typedef TDistribution distribution_type;
+
+    /// <summary>
+    /// The type of the values.
+    /// </summary>
+    typedef typename TDistribution::value_type value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="distribution">The distribution to be truncated.</param>
+    /// <param name="lower">The lower bound of the values.</param>
+    /// <param name="upper">The upper bound of the values.</param>
+    /// <exception cref="std::invalid_argument">If
+    /// <paramref name="lower" /> is not less than <paramref name="upper" />
+    /// or if the probability of the interval is zero.</exception>
+    truncated_distribution(_In_ const distribution_type& distribution,
+        _In_ const value_type lower,
+        _In_ const value_type upper);
+
+    /// <summary>
+    /// Answer the cumulative distribution function at
+    /// <paramref name="x" />.
+    /// </summary>
+    /// <param name="x">The value to evaluate the function at.</param>
+    /// <returns>The probability of a value being less than or equal to
+    /// <paramref name="x" />.</returns>
+    value_type cdf(_In_ const value_type x) const noexcept;
+
+    /// <summary>
+    /// Answer the underlying distribution.
+    /// </summary>
+    /// <returns>The distribution that is truncated.</returns>
+    inline const distribution_type& distribution(void) const noexcept {
+        return this->_distribution;
+    }
+
+    /// <summary>
+    /// Answer the lower bound of the values.
+    /// </summary>
+    /// <returns>The lower bound.</returns>
+    inline value_type lower(void) const noexcept {
+        return this->_lower;
+    }
+
+    /// <summary>
+    /// Answer the inverse of the cumulative distribution function at
+    /// <paramref name="p" />.
+    /// </summary>
+    /// <param name="p">A probability within [0, 1].</param>
+    /// <returns>The value whose cumulative probability is
+    /// <paramref name="p" />, which is within the bounds.</returns>
+    value_type quantile(_In_ const value_type p) const noexcept;
+
+    /// <summary>
+    /// Answer the upper bound of the values.
+    /// </summary>
+    /// <returns>The upper bound.</returns>
+    inline value_type upper(void) const noexcept {
+        return this->_upper;
+    }
+
+private:
+
+    value_type _cdf_lower;
+    value_type _cdf_upper;
+    distribution_type _distribution;
+    value_type _lower;
+    value_type _upper;
+};
+
+
+/// <summary>
+/// Restricts <paramref name="distribution" /> to the interval between
+/// <paramref name="lower" /> and <paramref name="upper" />.
+/// </summary>
+/// <typeparam name="TDistribution">The type of the distribution.</typeparam>
+/// <param name="distribution">The distribution to be truncated.</param>
+/// <param name="lower">The lower bound of the values.</param>
+/// <param name="upper">The upper bound of the values.</param>
+/// <returns>The truncated distribution.</returns>
+/// <exception cref="std::invalid_argument">If <paramref name="lower" /> is
+/// not less than <paramref name="upper" /> or if the probability of the
+/// interval is zero.</exception>
+template<class TDistribution>
+inline truncated_distribution<TDistribution> truncate(
+        _In_ const TDistribution& distribution,
+        _In_ const typename TDistribution::value_type lower,
+        _In_ const typename TDistribution::value_type upper) {
+    return truncated_distribution<TDistribution>(distribution, lower, upper);
+}
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Computes the regularised incomplete beta function.
+/// </summary>
+/// <param name="a">The first shape parameter, which must be positive.
+/// </param>
+/// <param name="b">The second shape parameter, which must be positive.
+/// </param>
+/// <param name="log_beta">The logarithm of the complete beta function of
+/// <paramref name="a" /> and <paramref name="b" />.</param>
+/// <param name="x">The point to evaluate the function at.</param>
+/// <returns>The value of the regularised incomplete beta function.
+/// </returns>
+inline double incomplete_beta(_In_ const double a,
+    _In_ const double b,
+    _In_ const double log_beta,
+    _In_ const double x) noexcept;
+
+/// <summary>
+/// Evaluates the continued fraction of the incomplete beta function using
+/// the modified Lentz algorithm.
+/// </summary>
+inline double incomplete_beta_fraction(_In_ const double a,
+    _In_ const double b,
+    _In_ const double x) noexcept;
+
+/// <summary>
+/// Clamps the probability <paramref name="p" /> to the open interval ]0, 1[.
+/// </summary>
+/// <remarks>
+/// Unit samples may contain exactly zero or one, which would be mapped to
+/// infinity by unbounded distributions. Therefore, these values are moved to
+/// the smallest positive normalised number and to one minus the machine
+/// epsilon of <typeparamref name="TValue" />, respectively.
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type of the probability.
+/// </typeparam>
+/// <param name="p">A probability within [0, 1].</param>
+/// <returns>The probability within ]0, 1[.</returns>
+template<class TValue>
+inline constexpr TValue open_probability(_In_ const TValue p) noexcept;
+
+/// <summary>
+/// Computes the cumulative distribution function of the standard normal
+/// distribution.
+/// </summary>
+/// <param name="z">The value to evaluate the function at.</param>
+/// <returns>The probability of a value being less than or equal to
+/// <paramref name="z" />.</returns>
+inline double normal_cdf(_In_ const double z) noexcept;
+
+/// <summary>
+/// Computes the quantile function of the standard normal distribution
+/// using algorithm AS 241 (PPND16).
+/// </summary>
+/// <remarks>
+/// Wichura, M. J. (1988): Algorithm AS 241: The percentage points of the
+/// normal distribution. Applied Statistics 37(3), pp. 477-484.
+/// </remarks>
+/// <param name="p">A probability within [0, 1].</param>
+/// <returns>The value whose cumulative probability is <paramref name="p" />.
+/// </returns>
+inline double normal_quantile(_In_ const double p) noexcept;
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/distributions.inl"
+
+#endif /* !defined(_LHS_DISTRIBUTIONS_H) */
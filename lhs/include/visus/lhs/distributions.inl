@@ -0,0 +1,558 @@
+﻿// <copyright file="distributions.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::normal_distribution<TValue>::normal_distribution
+ */
+template<class TValue>
+LHS_NAMESPACE::normal_distribution<TValue>::normal_distribution(
+        _In_ const value_type mean, _In_ const value_type stddev)
+        : _mean(mean), _stddev(stddev) {
+    if (!(stddev > static_cast<value_type>(0))) {
+        throw std::invalid_argument("The standard deviation of a normal "
+            "distribution must be positive.");
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::normal_distribution<TValue>::cdf
+ */
+template<class TValue>
+typename LHS_NAMESPACE::normal_distribution<TValue>::value_type
+LHS_NAMESPACE::normal_distribution<TValue>::cdf(
+        _In_ const value_type x) const noexcept {
+    const auto z = (static_cast<double>(x) - this->_mean) / this->_stddev;
+    return static_cast<value_type>(detail::normal_cdf(z));
+}
+
+
+/*
+ * LHS_NAMESPACE::normal_distribution<TValue>::quantile
+ */
+template<class TValue>
+typename LHS_NAMESPACE::normal_distribution<TValue>::value_type
+LHS_NAMESPACE::normal_distribution<TValue>::quantile(
+        _In_ const value_type p) const noexcept {
+    const auto z = detail::normal_quantile(static_cast<double>(p));
+    return static_cast<value_type>(this->_mean + this->_stddev * z);
+}
+
+
+/*
+ * LHS_NAMESPACE::triangular_distribution<TValue>::triangular_distribution
+ */
+template<class TValue>
+LHS_NAMESPACE::triangular_distribution<TValue>::triangular_distribution(
+        _In_ const value_type lower,
+        _In_ const value_type mode,
+        _In_ const value_type upper)
+        : _lower(lower), _mode(mode), _upper(upper) {
+    if (!(lower < upper)) {
+        throw std::invalid_argument("The lower bound of a triangular "
+            "distribution must be less than its upper bound.");
+    }
+    if ((mode < lower) || (mode > upper)) {
+        throw std::invalid_argument("The mode of a triangular distribution "
+            "must be within its bounds.");
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::triangular_distribution<TValue>::cdf
+ */
+template<class TValue>
+typename LHS_NAMESPACE::triangular_distribution<TValue>::value_type
+LHS_NAMESPACE::triangular_distribution<TValue>::cdf(
+        _In_ const value_type x) const noexcept {
+    const double a = this->_lower;
+    const double b = this->_upper;
+    const double c = this->_mode;
+
+    if (x <= a) {
+        return static_cast<value_type>(0);
+
+    } else if (x >= b) {
+        return static_cast<value_type>(1);
+
+    } else if (x <= c) {
+        const auto d = x - a;
+        return static_cast<value_type>(d * d / ((b - a) * (c - a)));
+
+    } else {
+        const auto d = b - x;
+        return static_cast<value_type>(1.0 - d * d / ((b - a) * (b - c)));
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::triangular_distribution<TValue>::quantile
+ */
+template<class TValue>
+typename LHS_NAMESPACE::triangular_distribution<TValue>::value_type
+LHS_NAMESPACE::triangular_distribution<TValue>::quantile(
+        _In_ const value_type p) const noexcept {
+    assert(p >= static_cast<value_type>(0));
+    assert(p <= static_cast<value_type>(1));
+    const double a = this->_lower;
+    const double b = this->_upper;
+    const double c = this->_mode;
+    const double q = p;
+
+    // The probability of a value being left of the mode separates the two
+    // branches of the quantile function.
+    const auto pivot = (c - a) / (b - a);
+    const auto retval = (q < pivot)
+        ? a + std::sqrt(q * (b - a) * (c - a))
+        : b - std::sqrt((1.0 - q) * (b - a) * (b - c));
+
+    return static_cast<value_type>((std::min)((std::max)(retval, a), b));
+}
+
+
+/*
+ * LHS_NAMESPACE::beta_distribution<TValue>::beta_distribution
+ */
+template<class TValue>
+LHS_NAMESPACE::beta_distribution<TValue>::beta_distribution(
+        _In_ const value_type alpha, _In_ const value_type beta)
+        : _alpha(alpha), _beta(beta) {
+    if (!(alpha > static_cast<value_type>(0))
+            || !(beta > static_cast<value_type>(0))) {
+        throw std::invalid_argument("The shape parameters of a beta "
+            "distribution must be positive.");
+    }
+
+    // Note: we compute the complete beta function once here, because
+    // std::lgamma is not guaranteed to be thread-safe, but the quantile
+    // function is used from multiple threads.
+    const double a = alpha;
+    const double b = beta;
+    this->_log_beta = std::lgamma(a) + std::lgamma(b) - std::lgamma(a + b);
+}
+
+
+/*
+ * LHS_NAMESPACE::beta_distribution<TValue>::cdf
+ */
+template<class TValue>
+typename LHS_NAMESPACE::beta_distribution<TValue>::value_type
+LHS_NAMESPACE::beta_distribution<TValue>::cdf(
+        _In_ const value_type x) const noexcept {
+    return static_cast<value_type>(detail::incomplete_beta(this->_alpha,
+        this->_beta, this->_log_beta, x));
+}
+
+
+/*
+ * LHS_NAMESPACE::beta_distribution<TValue>::quantile
+ */
+template<class TValue>
+typename LHS_NAMESPACE::beta_distribution<TValue>::value_type
+LHS_NAMESPACE::beta_distribution<TValue>::quantile(
+        _In_ const value_type p) const noexcept {
+    static constexpr std::size_t max_iterations = 200;
+    static constexpr auto tolerance
+        = 4.0 * std::numeric_limits<double>::epsilon();
+    assert(p >= static_cast<value_type>(0));
+    assert(p <= static_cast<value_type>(1));
+    const double a = this->_alpha;
+    const double b = this->_beta;
+    const double q = p;
+
+    if (q <= 0.0) {
+        return static_cast<value_type>(0);
+    } else if (q >= 1.0) {
+        return static_cast<value_type>(1);
+    }
+
+    // Start at the mean and refine using Newton's method, falling back to
+    // bisection whenever the Newton step would leave the bracket that is known
+    // to contain the solution.
+    auto lower = 0.0;
+    auto upper = 1.0;
+    auto x = a / (a + b);
+
+    for (std::size_t i = 0; i < max_iterations; ++i) {
+        const auto f = detail::incomplete_beta(a, b, this->_log_beta, x) - q;
+        if (f < 0.0) {
+            lower = x;
+        } else {
+            upper = x;
+        }
+
+        const auto pdf = std::exp((a - 1.0) * std::log(x)
+            + (b - 1.0) * std::log1p(-x) - this->_log_beta);
+        auto next = x - f / pdf;
+        if (!(next > lower) || !(next < upper)) {
+            next = 0.5 * (lower + upper);
+        }
+
+        const auto delta = std::abs(next - x);
+        x = next;
+
+        // Note: the tolerance is relative, because the density might be
+        // extremely steep close to zero, where an absolute error of the
+        // result would translate into a large error of the probability.
+        if ((delta <= tolerance * x) || (upper - lower <= tolerance * x)) {
+            break;
+        }
+    }
+
+    return static_cast<value_type>(x);
+}
+
+
+/*
+ * LHS_NAMESPACE::empirical_distribution<TValue>::empirical_distribution
+ */
+template<class TValue>
+LHS_NAMESPACE::empirical_distribution<TValue>::empirical_distribution(
+        _In_ std::vector<value_type>&& data,
+        _In_ const std::size_t size)
+        : _quantiles(std::move(data)) {
+    if (this->_quantiles.empty()) {
+        throw std::invalid_argument("An empirical distribution requires at "
+            "least one value.");
+    }
+    if (size == 1) {
+        throw std::invalid_argument("The quantile table of an empirical "
+            "distribution must have at least two entries.");
+    }
+
+    {
+        const auto actual = (size != 0) ? size : this->_quantiles.size();
+        if (actual > max_size) {
+            throw std::invalid_argument("The quantile table of an empirical "
+                "distribution must not exceed max_size entries.");
+        }
+    }
+
+    std::sort(this->_quantiles.begin(), this->_quantiles.end());
+
+    if (this->_quantiles.size() == 1) {
+        // Make sure that we always have a segment to interpolate.
+        this->_quantiles.push_back(this->_quantiles.front());
+    }
+
+    if ((size != 0) && (size != this->_quantiles.size())) {
+        // Resample the table at 'size' equidistant probabilities, which
+        // interpolates linearly between the order statistics of the data.
+        const auto& src = this->_quantiles;
+        const auto scale = static_cast<double>(src.size() - 1)
+            / static_cast<double>(size - 1);
+        std::vector<value_type> table(size);
+
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto pos = static_cast<double>(i) * scale;
+            const auto j = (std::min)(static_cast<std::size_t>(pos),
+                src.size() - 2);
+            const auto f = static_cast<value_type>(pos - j);
+            table[i] = src[j] + f * (src[j + 1] - src[j]);
+        }
+
+        // Pin the extremes such that rounding cannot narrow the support.
+        table.front() = src.front();
+        table.back() = src.back();
+        this->_quantiles = std::move(table);
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::empirical_distribution<TValue>::cdf
+ */
+template<class TValue>
+typename LHS_NAMESPACE::empirical_distribution<TValue>::value_type
+LHS_NAMESPACE::empirical_distribution<TValue>::cdf(
+        _In_ const value_type x) const noexcept {
+    const auto& table = this->_quantiles;
+
+    if (x < table.front()) {
+        return static_cast<value_type>(0);
+    } else if (x >= table.back()) {
+        return static_cast<value_type>(1);
+    }
+
+    const auto it = std::upper_bound(table.begin(), table.end(), x);
+    const auto i = static_cast<std::size_t>(std::distance(table.begin(), it))
+        - 1;
+    const auto width = table[i + 1] - table[i];
+    const auto f = (width > static_cast<value_type>(0))
+        ? (x - table[i]) / width
+        : static_cast<value_type>(0);
+
+    return (static_cast<value_type>(i) + f)
+        / static_cast<value_type>(table.size() - 1);
+}
+
+
+/*
+ * LHS_NAMESPACE::empirical_distribution<TValue>::quantile
+ */
+template<class TValue>
+inline typename LHS_NAMESPACE::empirical_distribution<TValue>::value_type
+LHS_NAMESPACE::empirical_distribution<TValue>::quantile(
+        _In_ const value_type p) const noexcept {
+    assert(p >= static_cast<value_type>(0));
+    assert(p <= static_cast<value_type>(1));
+    const auto table = this->_quantiles.data();
+    const auto last = static_cast<index_type>(this->_quantiles.size() - 1);
+
+    // Note: the table is equidistant in probability, so the segment can be
+    // computed directly. Clamping the index handles p == 1 without a branch.
+    // The index is a 32-bit signed integer, because this is the widest type
+    // common vector instruction sets can convert floating-point numbers to.
+    const auto pos = p * static_cast<value_type>(last);
+    const auto i = (std::min)(static_cast<index_type>(pos), last - 1);
+    const auto f = pos - static_cast<value_type>(i);
+
+    return table[i] + f * (table[i + 1] - table[i]);
+}
+
+
+/*
+ * LHS_NAMESPACE::truncated_distribution<TDistribution>::truncated_distribution
+ */
+template<class TDistribution>
+LHS_NAMESPACE::truncated_distribution<TDistribution>::truncated_distribution(
+        _In_ const distribution_type& distribution,
+        _In_ const value_type lower,
+        _In_ const value_type upper)
+        : _cdf_lower(distribution.cdf(lower)),
+        _cdf_upper(distribution.cdf(upper)),
+        _distribution(distribution),
+        _lower(lower),
+        _upper(upper) {
+    if (!(lower < upper)) {
+        throw std::invalid_argument("The lower bound of a truncated "
+            "distribution must be less than its upper bound.");
+    }
+    if (!(this->_cdf_lower < this->_cdf_upper)) {
+        throw std::invalid_argument("The bounds of a truncated distribution "
+            "must enclose a non-zero probability.");
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::truncated_distribution<TDistribution>::cdf
+ */
+template<class TDistribution>
+typename LHS_NAMESPACE::truncated_distribution<TDistribution>::value_type
+LHS_NAMESPACE::truncated_distribution<TDistribution>::cdf(
+        _In_ const value_type x) const noexcept {
+    if (x <= this->_lower) {
+        return static_cast<value_type>(0);
+    } else if (x >= this->_upper) {
+        return static_cast<value_type>(1);
+    }
+
+    return (this->_distribution.cdf(x) - this->_cdf_lower)
+        / (this->_cdf_upper - this->_cdf_lower);
+}
+
+
+/*
+ * LHS_NAMESPACE::truncated_distribution<TDistribution>::quantile
+ */
+template<class TDistribution>
+typename LHS_NAMESPACE::truncated_distribution<TDistribution>::value_type
+LHS_NAMESPACE::truncated_distribution<TDistribution>::quantile(
+        _In_ const value_type p) const noexcept {
+    const auto q = this->_cdf_lower + p * (this->_cdf_upper - this->_cdf_lower);
+    const auto retval = this->_distribution.quantile(q);
+    // Rounding in the cumulative probabilities might yield values that are
+    // slightly out of bounds, which we do not want to leak.
+    return (std::min)((std::max)(retval, this->_lower), this->_upper);
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::incomplete_beta
+ */
+inline double LHS_DETAIL_NAMESPACE::incomplete_beta(_In_ const double a,
+        _In_ const double b,
+        _In_ const double log_beta,
+        _In_ const double x) noexcept {
+    if (x <= 0.0) {
+        return 0.0;
+    } else if (x >= 1.0) {
+        return 1.0;
+    }
+
+    const auto front = std::exp(a * std::log(x) + b * std::log1p(-x)
+        - log_beta);
+
+    // The continued fraction converges quickly only left of the mean, so we
+    // use the symmetry I_x(a, b) = 1 - I_{1-x}(b, a) on the right.
+    if (x < (a + 1.0) / (a + b + 2.0)) {
+        return front * incomplete_beta_fraction(a, b, x) / a;
+    } else {
+        return 1.0 - front * incomplete_beta_fraction(b, a, 1.0 - x) / b;
+    }
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::incomplete_beta_fraction
+ */
+inline double LHS_DETAIL_NAMESPACE::incomplete_beta_fraction(
+        _In_ const double a,
+        _In_ const double b,
+        _In_ const double x) noexcept {
+    static constexpr double epsilon = 1e-15;
+    static constexpr std::size_t max_iterations = 300;
+    static constexpr double tiny = 1e-300;
+
+    const auto avoid_zero = [](const double v) {
+        return (std::abs(v) < tiny) ? tiny : v;
+    };
+
+    const auto qab = a + b;
+    const auto qap = a + 1.0;
+    const auto qam = a - 1.0;
+    auto c = 1.0;
+    auto d = 1.0 / avoid_zero(1.0 - qab * x / qap);
+    auto retval = d;
+
+    for (std::size_t i = 1; i <= max_iterations; ++i) {
+        const auto m = static_cast<double>(i);
+        const auto m2 = 2.0 * m;
+
+        // Even step of the recurrence.
+        auto aa = m * (b - m) * x / ((qam + m2) * (a + m2));
+        d = 1.0 / avoid_zero(1.0 + aa * d);
+        c = avoid_zero(1.0 + aa / c);
+        retval *= d * c;
+
+        // Odd step of the recurrence.
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2));
+        d = 1.0 / avoid_zero(1.0 + aa * d);
+        c = avoid_zero(1.0 + aa / c);
+        const auto delta = d * c;
+        retval *= delta;
+
+        if (std::abs(delta - 1.0) < epsilon) {
+            break;
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::open_probability
+ */
+template<class TValue>
+inline constexpr TValue LHS_DETAIL_NAMESPACE::open_probability(
+        _In_ const TValue p) noexcept {
+    static_assert(std::is_floating_point_v<TValue>, "The probability must be "
+        "a floating-point number.");
+    constexpr auto lower = (std::numeric_limits<TValue>::min)();
+    constexpr auto upper = static_cast<TValue>(1)
+        - std::numeric_limits<TValue>::epsilon();
+    return (std::min)((std::max)(p, lower), upper);
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::normal_cdf
+ */
+inline double LHS_DETAIL_NAMESPACE::normal_cdf(
+        _In_ const double z) noexcept {
+    // erfc is accurate in the lower tail, where 1 + erf would cancel.
+    static const auto sqrt_half = std::sqrt(0.5);
+    return 0.5 * std::erfc(-z * sqrt_half);
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::normal_quantile
+ */
+inline double LHS_DETAIL_NAMESPACE::normal_quantile(
+        _In_ const double p) noexcept {
+    assert(p >= 0.0);
+    assert(p <= 1.0);
+    const auto q = p - 0.5;
+
+    if (std::abs(q) <= 0.425) {
+        // Central region, where we use a rational approximation in q^2.
+        const auto r = 0.180625 - q * q;
+        return q * (((((((r * 2.5090809287301226727e+3
+            + 3.3430575583588128105e+4) * r
+            + 6.7265770927008700853e+4) * r
+            + 4.5921953931549871457e+4) * r
+            + 1.3731693765509461125e+4) * r
+            + 1.9715909503065514427e+3) * r
+            + 1.3314166789178437745e+2) * r
+            + 3.3871328727963666080e+0)
+            / (((((((r * 5.2264952788528545610e+3
+            + 2.8729085735721942674e+4) * r
+            + 3.9307895800092710610e+4) * r
+            + 2.1213794301586595867e+4) * r
+            + 5.3941960214247511077e+3) * r
+            + 6.8718700749205790830e+2) * r
+            + 4.2313330701600911252e+1) * r
+            + 1.0);
+    }
+
+    // Tails, where we use rational approximations in sqrt(-log(r)).
+    auto r = (q < 0.0) ? p : 1.0 - p;
+    if (r <= 0.0) {
+        return (q < 0.0)
+            ? -std::numeric_limits<double>::infinity()
+            : std::numeric_limits<double>::infinity();
+    }
+
+    r = std::sqrt(-std::log(r));
+    double retval;
+
+    if (r <= 5.0) {
+        r -= 1.6;
+        retval = (((((((r * 7.74545014278341407640e-4
+            + 2.27238449892691845833e-2) * r
+            + 2.41780725177450611770e-1) * r
+            + 1.27045825245236838258e+0) * r
+            + 3.64784832476320460504e+0) * r
+            + 5.76949722146069140550e+0) * r
+            + 4.63033784615654529590e+0) * r
+            + 1.42343711074968357734e+0)
+            / (((((((r * 1.05075007164441684324e-9
+            + 5.47593808499534494600e-4) * r
+            + 1.51986665636164571966e-2) * r
+            + 1.48103976427480074590e-1) * r
+            + 6.89767334985100004550e-1) * r
+            + 1.67638483018380384940e+0) * r
+            + 2.05319162663775882187e+0) * r
+            + 1.0);
+
+    } else {
+        r -= 5.0;
+        retval = (((((((r * 2.01033439929228813265e-7
+            + 2.71155556874348757815e-5) * r
+            + 1.24266094738807843860e-3) * r
+            + 2.65321895265761230930e-2) * r
+            + 2.96560571828504891230e-1) * r
+            + 1.78482653991729133580e+0) * r
+            + 5.46378491116411436990e+0) * r
+            + 6.65790464350110377720e+0)
+            / (((((((r * 2.04426310338993978564e-15
+            + 1.42151175831644588870e-7) * r
+            + 1.84631831751005468180e-5) * r
+            + 7.86869131145613259100e-4) * r
+            + 1.48753612908506148525e-2) * r
+            + 1.36929880922735805310e-1) * r
+            + 5.99832206555887937690e-1) * r
+            + 1.0);
+    }
+
+    return (q < 0.0) ? -retval : retval;
+}
@@ -0,0 +1,144 @@
+﻿// <copyright file="index_type.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_INDEX_TYPE_H)
+#define _LHS_INDEX_TYPE_H
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "visus/lhs/api.h"
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Answer whether <typeparamref name="TType" /> can be used to store the
+/// indices of the strata of a Latin hypercube sample, which is the case for
+/// all unsigned integral types except for <c>bool</c>.
+/// </summary>
+/// <typeparam name="TType">The type to be tested.</typeparam>
+template<class TType> struct is_index final : std::integral_constant<bool,
+    std::is_integral_v<TType>
+    && std::is_unsigned_v<TType>
+    && !std::is_same_v<std::remove_cv_t<TType>, bool>> { };
+
+/// <summary>
+/// Answer whether <typeparamref name="TType" /> can be used to store the
+/// indices of the strata of a Latin hypercube sample.
+/// </summary>
+/// <typeparam name="TType">The type to be tested.</typeparam>
+template<class TType>
+constexpr bool is_index_v = is_index<TType>::value;
+
+/// <summary>
+/// Answer whether <typeparamref name="TIndex" /> can represent all indices
+/// of a sample with <paramref name="samples" /> strata.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices.</typeparam>
+/// <param name="samples">The number of samples, i.e. the number of strata.
+/// </param>
+/// <returns><c>true</c> if the largest index fits into
+/// <typeparamref name="TIndex" />, <c>false</c> otherwise.</returns>
+template<class TIndex>
+inline constexpr bool can_index(_In_ const std::size_t samples) noexcept {
+    static_assert(is_index_v<TIndex>, "The index type must be an unsigned "
+        "integral type.");
+    return (samples == 0) || (samples - 1
+        <= static_cast<std::size_t>((std::numeric_limits<TIndex>::max)()));
+}
+
+/// <summary>
+/// Makes sure that <typeparamref name="TIndex" /> can represent all indices of
+/// a sample with <paramref name="samples" /> strata.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices.</typeparam>
+/// <param name="samples">The number of samples, i.e. the number of strata.
+/// </param>
+/// <exception cref="std::invalid_argument">If the largest index does not fit
+/// into <typeparamref name="TIndex" />.</exception>
+template<class TIndex>
+inline void check_index(_In_ const std::size_t samples) {
+    if (!can_index<TIndex>(samples)) {
+        throw std::invalid_argument("The number of samples exceeds the range "
+            "of the index type.");
+    }
+}
+
+LHS_DETAIL_NAMESPACE_END
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// The narrowest index type that can represent all strata of a sample with
+/// <typeparamref name="Samples" /> samples.
+/// </summary>
+/// <typeparam name="Samples">The number of samples.</typeparam>
+template<std::size_t Samples>
+using index_type_t = std::conditional_t<
+    detail::can_index<std::uint16_t>(Samples),
+    std::uint16_t,
+    std::conditional_t<detail::can_index<std::uint32_t>(Samples),
+        std::uint32_t,
+        std::size_t>>;
+
+/// <summary>
+/// A tag that transports an index type to a generic lambda.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices.</typeparam>
+template<class TIndex> struct index_tag final {
+
+    /// <summary>
+    /// The type of the indices.
+    /// </summary>
+    typedef TIndex type;
+};
+
+/// <summary>
+/// Invokes <paramref name="functor" /> with an <see cref="index_tag" /> for
+/// the narrowest index type that can represent all strata of a sample with
+/// <paramref name="samples" /> samples.
+/// </summary>
+/// <remarks>
+/// <para>The index type of a sample determines its memory footprint. An index
+/// matrix of <c>std::uint16_t</c> is four times smaller than one of
+/// <c>std::size_t</c>, which is sufficient for up to 65,536 samples. As the
+/// number of samples is usually only known at runtime, this function allows for
+/// writing the code using the sample once as a generic lambda:</para>
+/// <code>
+/// with_index_type(n, [&amp;](auto tag) {
+///     typedef typename decltype(tag)::type index_type;
+///     auto lhs = visus::lhs::random&lt;index_type&gt;(n, k);
+///     // ...
+/// });
+/// </code>
+/// </remarks>
+/// <typeparam name="TFunctor">The type of the functor, which must accept an
+/// <see cref="index_tag" /> of any of the index types and return the same type
+/// for all of them.</typeparam>
+/// <param name="samples">The number of samples.</param>
+/// <param name="functor">The functor to be invoked.</param>
+/// <returns>The return value of <paramref name="functor" />.</returns>
+template<class TFunctor>
+inline decltype(auto) with_index_type(_In_ const std::size_t samples,
+        _In_ TFunctor&& functor) {
+    if (detail::can_index<std::uint16_t>(samples)) {
+        return functor(index_tag<std::uint16_t>());
+    } else if (detail::can_index<std::uint32_t>(samples)) {
+        return functor(index_tag<std::uint32_t>());
+    } else {
+        return functor(index_tag<std::size_t>());
+    }
+}
+
+LHS_NAMESPACE_END
+
+#endif /* !defined(_LHS_INDEX_TYPE_H) */
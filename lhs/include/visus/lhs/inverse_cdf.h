@@ -0,0 +1,119 @@
+﻿// <copyright file="inverse_cdf.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_INVERSE_CDF_H)
+#define _LHS_INVERSE_CDF_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+#include "visus/lhs/distributions.h"
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/parallel.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Transforms the values in <paramref name="column" /> of the unit hypercube
+/// sample <paramref name="lhs" /> in place by applying the inverse of the
+/// cumulative distribution function of <paramref name="distribution" />.
+/// </summary>
+/// <remarks>
+/// <para>Applying the quantile function of a distribution to the values of a
+/// stratified unit sample yields a sample that is stratified with respect to
+/// this distribution, i.e. each stratum of the unit interval is mapped to an
+/// interval of equal probability.</para>
+/// <para>The rows are processed in contiguous chunks on up to
+/// <paramref name="threads" /> threads. Chunks of contiguous columns are
+/// processed using a plain loop over the underlying memory.</para>
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type of the matrix elements.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TDistribution">The type of the distribution, which must
+/// provide a <c>quantile</c> function, like
+/// <see cref="normal_distribution{TValue}" />.</typeparam>
+/// <param name="lhs">A view of the unit hypercube sample to be transformed.
+/// </param>
+/// <param name="column">The zero-based index of the column to transform.
+/// </param>
+/// <param name="distribution">The distribution of the parameter in
+/// <paramref name="column" />.</param>
+/// <param name="threads">The number of threads to use. If this is zero, the
+/// number of hardware threads will be used.</param>
+/// <returns><paramref name="lhs" /> after the transformation.</returns>
+/// <exception cref="std::invalid_argument">If <paramref name="column" /> is
+/// not a valid column of <paramref name="lhs" />.</exception>
+template<class TValue, matrix_layout Layout, class TDistribution>
+std::enable_if_t<std::is_floating_point_v<TValue>, matrix_view<TValue, Layout>>
+inverse_cdf(_In_ const matrix_view<TValue, Layout> lhs,
+    _In_ const std::size_t column,
+    _In_ const TDistribution& distribution,
+    _In_ const std::size_t threads = 1);
+
+/// <summary>
+/// Transforms the values in <paramref name="column" /> of the unit hypercube
+/// sample <paramref name="lhs" /> in place by applying the inverse of the
+/// cumulative distribution function of <paramref name="distribution" />.
+/// </summary>
+/// <typeparam name="TValue">The floating-point type of the matrix elements.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <typeparam name="TDistribution">The type of the distribution, which must
+/// provide a <c>quantile</c> function, like
+/// <see cref="normal_distribution{TValue}" />.</typeparam>
+/// <param name="lhs">The unit hypercube sample to be transformed.</param>
+/// <param name="column">The zero-based index of the column to transform.
+/// </param>
+/// <param name="distribution">The distribution of the parameter in
+/// <paramref name="column" />.</param>
+/// <param name="threads">The number of threads to use. If this is zero, the
+/// number of hardware threads will be used.</param>
+/// <returns><paramref name="lhs" /> after the transformation.</returns>
+/// <exception cref="std::invalid_argument">If <paramref name="column" /> is
+/// not a valid column of <paramref name="lhs" />.</exception>
+template<class TValue, matrix_layout Layout, class TAllocator,
+    class TDistribution>
+inline std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix<TValue, Layout, TAllocator>&>
+inverse_cdf(_Inout_ matrix<TValue, Layout, TAllocator>& lhs,
+        _In_ const std::size_t column,
+        _In_ const TDistribution& distribution,
+        _In_ const std::size_t threads = 1) {
+    inverse_cdf(matrix_view<TValue, Layout>(lhs), column, distribution,
+        threads);
+    return lhs;
+}
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The number of values <see cref="inverse_cdf" /> transforms at once in a
+/// contiguous column.
+/// </summary>
+constexpr std::size_t inverse_cdf_block = 64;
+
+/// <summary>
+/// The minimum number of rows a thread transforms in
+/// <see cref="inverse_cdf" />.
+/// </summary>
+constexpr std::size_t inverse_cdf_grain = 1024;
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/inverse_cdf.inl"
+
+#endif /* !defined(_LHS_INVERSE_CDF_H) */
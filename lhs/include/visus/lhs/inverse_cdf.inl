@@ -0,0 +1,59 @@
+﻿// <copyright file="inverse_cdf.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::inverse_cdf
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout,
+    class TDistribution>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    LHS_NAMESPACE::matrix_view<TValue, Layout>>
+LHS_NAMESPACE::inverse_cdf(_In_ const matrix_view<TValue, Layout> lhs,
+        _In_ const std::size_t column,
+        _In_ const TDistribution& distribution,
+        _In_ const std::size_t threads) {
+    typedef typename TDistribution::value_type dist_type;
+
+    if (column >= lhs.columns()) {
+        throw std::invalid_argument("The column to be transformed must be "
+            "within the sample.");
+    }
+
+    const auto values = column_view(lhs, column);
+
+    detail::parallel_for(0, lhs.rows(),
+            [&distribution, &values](const std::size_t b, const std::size_t e) {
+        if (values.contiguous()) {
+            // This is the fast path for column-major samples, which does not
+            // need to compute any strides. Note that we transform into a local
+            // buffer, because otherwise, the compiler cannot prove that the
+            // output does not alias tables of the distribution and will not
+            // vectorise the loop.
+            TValue buffer[detail::inverse_cdf_block];
+            auto data = values.data();
+
+            for (std::size_t r = b; r < e; r += detail::inverse_cdf_block) {
+                const auto n = (std::min)(detail::inverse_cdf_block, e - r);
+                for (std::size_t i = 0; i < n; ++i) {
+                    buffer[i] = static_cast<TValue>(distribution.quantile(
+                        detail::open_probability(
+                        static_cast<dist_type>(data[r + i]))));
+                }
+                std::copy(buffer, buffer + n, data + r);
+            }
+
+        } else {
+            for (std::size_t r = b; r < e; ++r) {
+                values[r] = static_cast<TValue>(distribution.quantile(
+                    detail::open_probability(
+                    static_cast<dist_type>(values[r]))));
+            }
+        }
+    }, threads, detail::inverse_cdf_grain);
+
+    return lhs;
+}
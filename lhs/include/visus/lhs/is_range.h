@@ -11,6 +11,7 @@
 #include <type_traits>
 
 #include "visus/lhs/range.h"
+#include "visus/lhs/transformed_range.h"
 
 
 LHS_DETAIL_NAMESPACE_BEGIN
@@ -28,6 +29,10 @@ template<class TType> struct is_range final : std::false_type { };
 /// <typeparam name="TType">The numeric type of the range.</typeparam>
 template<class TType> struct is_range<range<TType>> final : std::true_type { };
 
+template<class TType, class TTransform>
+struct is_range<transformed_range<TType, TTransform>> final
+    : std::true_type { };
+
 /// <summary>
 /// Answer whether <paramref name="TType" /> is an instance of
 /// <see cref="range{TType}" />.
@@ -13,7 +13,7 @@
 
 /* Forward declarations. */
 LHS_NAMESPACE_BEGIN
-template<class, matrix_layout> class matrix;
+template<class, matrix_layout, class> class matrix;
 LHS_NAMESPACE_END;
 
 LHS_DETAIL_NAMESPACE_BEGIN
@@ -35,8 +35,9 @@ template<class TMatrix> struct layout final { };
 /// </summary>
 /// <typeparam name="TValue">The type of the elements in the matrix.</typeparam>
 /// <typeparamref name="Layout">The layout of the matrix.</typeparam>
-template<class TValue, matrix_layout Layout>
-struct layout<matrix<TValue, Layout>> final {
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+template<class TValue, matrix_layout Layout, class TAllocator>
+struct layout<matrix<TValue, Layout, TAllocator>> final {
     static constexpr const matrix_layout value = Layout;
 };
 
@@ -45,8 +46,9 @@ struct layout<matrix<TValue, Layout>> final {
 /// </summary>
 /// <typeparam name="TValue">The type of the elements in the matrix.</typeparam>
 /// <typeparamref name="Layout">The layout of the matrix.</typeparam>
-template<class TValue, matrix_layout Layout>
-struct layout<const matrix<TValue, Layout>> final {
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+template<class TValue, matrix_layout Layout, class TAllocator>
+struct layout<const matrix<TValue, Layout, TAllocator>> final {
     static constexpr const matrix_layout value = Layout;
 };
 
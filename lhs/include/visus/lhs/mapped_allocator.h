@@ -0,0 +1,169 @@
+﻿// <copyright file="mapped_allocator.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_MAPPED_ALLOCATOR_H)
+#define _LHS_MAPPED_ALLOCATOR_H
+#pragma once
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+#include "visus/lhs/mapped_file.h"
+#include "visus/lhs/matrix.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// An allocator that places all allocations in temporary files mapped into
+/// memory.
+/// </summary>
+/// <remarks>
+/// <para>Using this allocator for a <see cref="matrix" /> allows for creating
+/// designs that are larger than the physical memory, because the operating
+/// system writes pages that have not been used recently back to the file and
+/// evicts them. The files are created in the temporary directory and vanish
+/// once the storage is deallocated.</para>
+/// <para>Generators fill a sample column by column. If the matrix is stored
+/// in <see cref="matrix_layout::column_major" /> order, the generators
+/// stream through the file and only the current column needs to be resident.
+/// </para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the objects to be allocated.
+/// </typeparam>
+/// <typeparam name="Hints">Hints to the operating system about how the
+/// storage is accessed. This parameter defaults to sequential access.
+/// </typeparam>
+template<class TValue,
+    mapping_hints Hints = mapping_hints::sequential>
+class mapped_allocator {
+
+public:
+
+    /// <summary>
+    /// The type of the objects to be allocated.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Indicates that allocators are interchangable.
+    /// </summary>
+    typedef std::true_type is_always_equal;
+
+    /// <summary>
+    /// Rebinds the allocator to another type.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects to be allocated by
+    /// the rebound allocator.</typeparam>
+    template<class TOther> struct rebind final {
+        typedef mapped_allocator<TOther, Hints> other;
+    };
+
+    /// <summary>
+    /// The hints passed to the operating system for each allocation.
+    /// </summary>
+    static constexpr const mapping_hints hints = Hints;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    inline constexpr mapped_allocator(void) noexcept = default;
+
+    /// <summary>
+    /// Initialises a new instance from an allocator for another type.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects allocated by the other
+    /// allocator.</typeparam>
+    template<class TOther>
+    inline constexpr mapped_allocator(
+            _In_ const mapped_allocator<TOther, Hints>&) noexcept { }
+
+    /// <summary>
+    /// Allocates storage for <paramref name="cnt" /> objects in a temporary
+    /// file.
+    /// </summary>
+    /// <param name="cnt">The number of objects to allocate storage for.</param>
+    /// <returns>A pointer to the zero-initialised storage, which is aligned to
+    /// the page size.</returns>
+    /// <exception cref="std::bad_array_new_length">If the requested size
+    /// overflows.</exception>
+    /// <exception cref="std::system_error">If the file could not be created
+    /// or mapped.</exception>
+    inline TValue *allocate(_In_ const std::size_t cnt) {
+        if (cnt > (std::numeric_limits<std::size_t>::max)() / sizeof(TValue)) {
+            throw std::bad_array_new_length();
+        }
+
+        return (cnt > 0)
+            ? static_cast<TValue *>(detail::map_temporary(
+                cnt * sizeof(TValue), Hints))
+            : nullptr;
+    }
+
+    /// <summary>
+    /// Releases storage allocated by <see cref="allocate" />, which deletes
+    /// the temporary file.
+    /// </summary>
+    /// <param name="ptr">The pointer returned by <see cref="allocate" />.
+    /// </param>
+    /// <param name="cnt">The number of objects passed to
+    /// <see cref="allocate" />.</param>
+    inline void deallocate(_In_ TValue *ptr,
+            _In_ const std::size_t cnt) noexcept {
+        detail::unmap(ptr, cnt * sizeof(TValue));
+    }
+
+    /// <summary>
+    /// Test for equality.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects allocated by the other
+    /// allocator.</typeparam>
+    /// <returns><c>true</c>, because all instances are interchangable.
+    /// </returns>
+    template<class TOther>
+    inline constexpr bool operator ==(
+            _In_ const mapped_allocator<TOther, Hints>&)
+            const noexcept {
+        return true;
+    }
+
+    /// <summary>
+    /// Test for inequality.
+    /// </summary>
+    /// <typeparam name="TOther">The type of the objects allocated by the other
+    /// allocator.</typeparam>
+    /// <returns><c>false</c>, because all instances are interchangable.
+    /// </returns>
+    template<class TOther>
+    inline constexpr bool operator !=(
+            _In_ const mapped_allocator<TOther, Hints>&)
+            const noexcept {
+        return false;
+    }
+};
+
+
+/// <summary>
+/// A matrix that is stored in a temporary file mapped into memory.
+/// </summary>
+/// <remarks>
+/// The layout defaults to column-major, which is the order in which the
+/// generators write samples.
+/// </remarks>
+/// <typeparam name="TValue">The type used to store a scalar.</typeparam>
+/// <typeparam name="Layout">The memory layout used by the matrix.</typeparam>
+/// <typeparam name="Hints">Hints to the operating system about how the
+/// storage is accessed.</typeparam>
+template<class TValue,
+    matrix_layout Layout = matrix_layout::column_major,
+    mapping_hints Hints = mapping_hints::sequential>
+using mapped_matrix = matrix<TValue, Layout, mapped_allocator<TValue, Hints>>;
+
+LHS_NAMESPACE_END
+
+#endif /* !defined(_LHS_MAPPED_ALLOCATOR_H) */
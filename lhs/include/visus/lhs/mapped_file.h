@@ -0,0 +1,262 @@
+﻿// <copyright file="mapped_file.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_MAPPED_FILE_H)
+#define _LHS_MAPPED_FILE_H
+#pragma once
+
+#include <cassert>
+#include <cerrno>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+// Note: this is a public header, so we must not leak the min/max macros or
+// the RPC declarations pulled in by Windows.h to our users.
+#if !defined(WIN32_LEAN_AND_MEAN)
+#define WIN32_LEAN_AND_MEAN
+#define _LHS_UNDEF_WIN32_LEAN_AND_MEAN
+#endif /* !defined(WIN32_LEAN_AND_MEAN) */
+#if !defined(NOMINMAX)
+#define NOMINMAX
+#define _LHS_UNDEF_NOMINMAX
+#endif /* !defined(NOMINMAX) */
+#include <Windows.h>
+#if defined(_LHS_UNDEF_WIN32_LEAN_AND_MEAN)
+#undef WIN32_LEAN_AND_MEAN
+#undef _LHS_UNDEF_WIN32_LEAN_AND_MEAN
+#endif /* defined(_LHS_UNDEF_WIN32_LEAN_AND_MEAN) */
+#if defined(_LHS_UNDEF_NOMINMAX)
+#undef NOMINMAX
+#undef _LHS_UNDEF_NOMINMAX
+#endif /* defined(_LHS_UNDEF_NOMINMAX) */
+#else /* defined(_WIN32) */
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif /* defined(_WIN32) */
+
+#include "visus/lhs/api.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Possible hints to the operating system about how a mapping will be
+/// accessed, which can be combined.
+/// </summary>
+/// <remarks>
+/// The hints are only advisory. They are ignored on platforms that do not
+/// support them.
+/// </remarks>
+enum class mapping_hints : unsigned int {
+
+    /// <summary>
+    /// No hints are given.
+    /// </summary>
+    none = 0x0000,
+
+    /// <summary>
+    /// The mapping will be accessed sequentially, which allows the operating
+    /// system to read ahead aggressively and to evict pages that have already
+    /// been accessed.
+    /// </summary>
+    sequential = 0x0001,
+
+    /// <summary>
+    /// The mapping should be backed by huge pages if possible.
+    /// </summary>
+    huge_pages = 0x0002,
+
+    /// <summary>
+    /// The whole mapping will be accessed soon, wherefore it should be
+    /// prefetched.
+    /// </summary>
+    will_need = 0x0004
+};
+
+/// <summary>
+/// Combines two <see cref="mapping_hints" />.
+/// </summary>
+/// <param name="lhs">The left-hand side operand.</param>
+/// <param name="rhs">The right-hand side operand.</param>
+/// <returns>The union of the hints.</returns>
+inline constexpr mapping_hints operator |(_In_ const mapping_hints lhs,
+        _In_ const mapping_hints rhs) noexcept {
+    return static_cast<mapping_hints>(static_cast<unsigned int>(lhs)
+        | static_cast<unsigned int>(rhs));
+}
+
+/// <summary>
+/// Intersects two <see cref="mapping_hints" />.
+/// </summary>
+/// <param name="lhs">The left-hand side operand.</param>
+/// <param name="rhs">The right-hand side operand.</param>
+/// <returns>The intersection of the hints.</returns>
+inline constexpr mapping_hints operator &(_In_ const mapping_hints lhs,
+        _In_ const mapping_hints rhs) noexcept {
+    return static_cast<mapping_hints>(static_cast<unsigned int>(lhs)
+        & static_cast<unsigned int>(rhs));
+}
+
+
+/// <summary>
+/// A read-only view of a whole file that has been mapped into the address
+/// space of the process.
+/// </summary>
+/// <remarks>
+/// <para>The pages of the file are loaded on demand by the operating system
+/// and can be shared with other processes mapping the same file, wherefore
+/// opening even large files is instantaneous.</para>
+/// <para>The mapping is owned by the instance and released when it is
+/// destroyed. The instance can be moved, but not copied.</para>
+/// </remarks>
+class mapped_file final {
+
+public:
+
+    /// <summary>
+    /// Initialises a new instance that does not map anything.
+    /// </summary>
+    inline mapped_file(void) noexcept : _data(nullptr), _size(0) { }
+
+    /// <summary>
+    /// Maps the file at <paramref name="path" /> for reading.
+    /// </summary>
+    /// <param name="path">The path to the file to be mapped.</param>
+    /// <exception cref="std::system_error">If the file could not be opened or
+    /// mapped.</exception>
+    inline explicit mapped_file(_In_ const std::filesystem::path& path);
+
+    mapped_file(const mapped_file&) = delete;
+
+    /// <summary>
+    /// Move <paramref name="rhs" /> into a new instance.
+    /// </summary>
+    /// <param name="rhs">The object to be moved.</param>
+    inline mapped_file(_Inout_ mapped_file&& rhs) noexcept
+            : _data(rhs._data), _size(rhs._size) {
+        rhs._data = nullptr;
+        rhs._size = 0;
+    }
+
+    /// <summary>
+    /// Finalises the instance.
+    /// </summary>
+    inline ~mapped_file(void) noexcept {
+        this->close();
+    }
+
+    /// <summary>
+    /// Releases the mapping, if any.
+    /// </summary>
+    inline void close(void) noexcept;
+
+    /// <summary>
+    /// Answer the begin of the mapped file.
+    /// </summary>
+    /// <returns>A pointer to the first byte of the file, which is
+    /// <c>nullptr</c> if nothing is mapped.</returns>
+    inline const void *data(void) const noexcept {
+        return this->_data;
+    }
+
+    /// <summary>
+    /// Answer whether nothing is mapped.
+    /// </summary>
+    /// <returns><c>true</c> if the instance does not map any data,
+    /// <c>false</c> otherwise.</returns>
+    inline bool empty(void) const noexcept {
+        return (this->_size == 0);
+    }
+
+    /// <summary>
+    /// Answer the size of the mapping in bytes.
+    /// </summary>
+    /// <returns>The size of the mapped file.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_size;
+    }
+
+    mapped_file& operator =(const mapped_file&) = delete;
+
+    /// <summary>
+    /// Move assignment.
+    /// </summary>
+    /// <param name="rhs">The right-hand side operand.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline mapped_file& operator =(_Inout_ mapped_file&& rhs) noexcept {
+        if (this != std::addressof(rhs)) {
+            this->close();
+            this->_data = rhs._data;
+            this->_size = rhs._size;
+            rhs._data = nullptr;
+            rhs._size = 0;
+        }
+
+        return *this;
+    }
+
+private:
+
+    void *_data;
+    std::size_t _size;
+};
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Passes the given <paramref name="hints" /> for the mapping at
+/// <paramref name="data" /> to the operating system.
+/// </summary>
+/// <param name="data">The begin of the mapping.</param>
+/// <param name="size">The size of the mapping in bytes.</param>
+/// <param name="hints">The hints to be applied.</param>
+inline void advise(_In_ void *data,
+    _In_ const std::size_t size,
+    _In_ const mapping_hints hints) noexcept;
+
+/// <summary>
+/// Creates a temporary file of <paramref name="size" /> bytes and maps it
+/// into memory for reading and writing.
+/// </summary>
+/// <remarks>
+/// The file is created in the temporary directory and is deleted
+/// automatically once it has been unmapped. The operating system can write
+/// the pages of the mapping back to the file and evict them, wherefore the
+/// mapping may be larger than the physical memory. The content of the
+/// mapping is initially zero.
+/// </remarks>
+/// <param name="size">The size of the mapping in bytes, which must not be
+/// zero.</param>
+/// <param name="hints">Hints about how the mapping will be used.</param>
+/// <returns>The begin of the mapping.</returns>
+/// <exception cref="std::system_error">If the file could not be created or
+/// mapped.</exception>
+inline void *map_temporary(_In_ const std::size_t size,
+    _In_ const mapping_hints hints);
+
+/// <summary>
+/// Releases a mapping created by <see cref="map_temporary" /> or by
+/// <see cref="mapped_file" />.
+/// </summary>
+/// <param name="data">The begin of the mapping. It is safe to pass
+/// <c>nullptr</c>.</param>
+/// <param name="size">The size of the mapping in bytes.</param>
+inline void unmap(_In_opt_ void *data, _In_ const std::size_t size) noexcept;
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/mapped_file.inl"
+
+#endif /* !defined(_LHS_MAPPED_FILE_H) */
@@ -0,0 +1,231 @@
+﻿// <copyright file="mapped_file.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::mapped_file::mapped_file
+ */
+inline LHS_NAMESPACE::mapped_file::mapped_file(
+        _In_ const std::filesystem::path& path)
+        : _data(nullptr), _size(0) {
+#if defined(_WIN32)
+    auto file = ::CreateFileW(path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::system_error(::GetLastError(), std::system_category(),
+            "The file to be mapped could not be opened.");
+    }
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size)) {
+        const auto error = ::GetLastError();
+        ::CloseHandle(file);
+        throw std::system_error(error, std::system_category(),
+            "The size of the file to be mapped could not be determined.");
+    }
+
+    if (size.QuadPart > 0) {
+        // Note: the view keeps the mapping alive, wherefore we can close the
+        // handles once the view has been created.
+        auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0,
+            nullptr);
+        const auto error = ::GetLastError();
+        ::CloseHandle(file);
+        if (mapping == NULL) {
+            throw std::system_error(error, std::system_category(),
+                "The file could not be mapped.");
+        }
+
+        this->_data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        const auto error2 = ::GetLastError();
+        ::CloseHandle(mapping);
+        if (this->_data == nullptr) {
+            throw std::system_error(error2, std::system_category(),
+                "The view of the file could not be mapped.");
+        }
+
+        this->_size = static_cast<std::size_t>(size.QuadPart);
+
+    } else {
+        ::CloseHandle(file);
+    }
+
+#else /* defined(_WIN32) */
+    const auto file = ::open(path.c_str(), O_RDONLY);
+    if (file == -1) {
+        throw std::system_error(errno, std::system_category(),
+            "The file to be mapped could not be opened.");
+    }
+
+    struct stat info;
+    if (::fstat(file, &info) == -1) {
+        const auto error = errno;
+        ::close(file);
+        throw std::system_error(error, std::system_category(),
+            "The size of the file to be mapped could not be determined.");
+    }
+
+    if (info.st_size > 0) {
+        const auto size = static_cast<std::size_t>(info.st_size);
+        // Note: the mapping remains valid after the descriptor was closed.
+        auto data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+        const auto error = errno;
+        ::close(file);
+        if (data == MAP_FAILED) {
+            throw std::system_error(error, std::system_category(),
+                "The file could not be mapped.");
+        }
+
+        this->_data = data;
+        this->_size = size;
+
+    } else {
+        ::close(file);
+    }
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * LHS_NAMESPACE::mapped_file::close
+ */
+inline void LHS_NAMESPACE::mapped_file::close(void) noexcept {
+    detail::unmap(this->_data, this->_size);
+    this->_data = nullptr;
+    this->_size = 0;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::advise
+ */
+inline void LHS_DETAIL_NAMESPACE::advise(_In_ void *data,
+        _In_ const std::size_t size,
+        _In_ const mapping_hints hints) noexcept {
+#if defined(_WIN32)
+    // Windows has no equivalent of madvise for file mappings.
+    (void) data;
+    (void) size;
+    (void) hints;
+
+#else /* defined(_WIN32) */
+    // Note: errors are ignored, because the hints are only advisory.
+    if ((hints & mapping_hints::sequential) != mapping_hints::none) {
+        ::madvise(data, size, MADV_SEQUENTIAL);
+    }
+#if defined(MADV_HUGEPAGE)
+    if ((hints & mapping_hints::huge_pages) != mapping_hints::none) {
+        ::madvise(data, size, MADV_HUGEPAGE);
+    }
+#endif /* defined(MADV_HUGEPAGE) */
+    if ((hints & mapping_hints::will_need) != mapping_hints::none) {
+        ::madvise(data, size, MADV_WILLNEED);
+    }
+#endif /* defined(_WIN32) */
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::map_temporary
+ */
+inline void *LHS_DETAIL_NAMESPACE::map_temporary(_In_ const std::size_t size,
+        _In_ const mapping_hints hints) {
+    assert(size > 0);
+    const auto directory = std::filesystem::temp_directory_path();
+
+#if defined(_WIN32)
+    wchar_t path[MAX_PATH];
+    if (::GetTempFileNameW(directory.c_str(), L"lhs", 0, path) == 0) {
+        throw std::system_error(::GetLastError(), std::system_category(),
+            "The name of the temporary file could not be created.");
+    }
+
+    // Note: the file is deleted once the last handle to it, including the one
+    // held by the view, has been closed.
+    auto file = ::CreateFileW(path,
+        GENERIC_READ | GENERIC_WRITE,
+        0,
+        nullptr,
+        CREATE_ALWAYS,
+        FILE_ATTRIBUTE_TEMPORARY | FILE_FLAG_DELETE_ON_CLOSE,
+        NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::system_error(::GetLastError(), std::system_category(),
+            "The temporary file could not be created.");
+    }
+
+    LARGE_INTEGER s;
+    s.QuadPart = static_cast<LONGLONG>(size);
+    auto mapping = ::CreateFileMappingW(file, nullptr, PAGE_READWRITE,
+        static_cast<DWORD>(s.HighPart), s.LowPart, nullptr);
+    const auto error = ::GetLastError();
+    ::CloseHandle(file);
+    if (mapping == NULL) {
+        throw std::system_error(error, std::system_category(),
+            "The temporary file could not be mapped.");
+    }
+
+    auto retval = ::MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, size);
+    const auto error2 = ::GetLastError();
+    ::CloseHandle(mapping);
+    if (retval == nullptr) {
+        throw std::system_error(error2, std::system_category(),
+            "The view of the temporary file could not be mapped.");
+    }
+
+#else /* defined(_WIN32) */
+    auto name = (directory / "lhsXXXXXX").string();
+    const auto file = ::mkstemp(name.data());
+    if (file == -1) {
+        throw std::system_error(errno, std::system_category(),
+            "The temporary file could not be created.");
+    }
+
+    // Unlink the file right away such that it vanishes once it is unmapped,
+    // even if the process crashes.
+    ::unlink(name.c_str());
+
+    if (::ftruncate(file, static_cast<off_t>(size)) == -1) {
+        const auto error = errno;
+        ::close(file);
+        throw std::system_error(error, std::system_category(),
+            "The temporary file could not be resized.");
+    }
+
+    auto retval = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+        file, 0);
+    const auto error = errno;
+    ::close(file);
+    if (retval == MAP_FAILED) {
+        throw std::system_error(error, std::system_category(),
+            "The temporary file could not be mapped.");
+    }
+#endif /* defined(_WIN32) */
+
+    advise(retval, size, hints);
+    return retval;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::unmap
+ */
+inline void LHS_DETAIL_NAMESPACE::unmap(_In_opt_ void *data,
+        _In_ const std::size_t size) noexcept {
+    if (data != nullptr) {
+#if defined(_WIN32)
+        (void) size;
+        ::UnmapViewOfFile(data);
+#else /* defined(_WIN32) */
+        ::munmap(data, size);
+#endif /* defined(_WIN32) */
+    }
+}
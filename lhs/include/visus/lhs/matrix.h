@@ -8,16 +8,21 @@
 #define _LHS_MATRIX_H
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
 #include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "visus/lhs/aligned_allocator.h"
 #include "visus/lhs/matrix_iterator.h"
 #include "visus/lhs/iteration_order.h"
+#include "visus/lhs/transpose.h"
+#include "visus/lhs/vector_view.h"
 
 
 LHS_NAMESPACE_BEGIN
@@ -33,11 +38,23 @@ LHS_NAMESPACE_BEGIN
 /// </remarks>
 /// <typeparam name="TValue">The type used to store a scalar.</typeparam>
 /// <typeparam name="Layout">The memory layout used by the matrix</typeparam>
-template<class TValue, matrix_layout Layout = matrix_layout::row_major>
+/// <typeparam name="TAllocator">The allocator used for the storage of the
+/// matrix. If <see cref="detail::padding" /> requests padding for this
+/// allocator, the rows or columns (depending on <typeparamref name="Layout" />)
+/// are padded such that each one starts at a multiple of the padding.
+/// </typeparam>
+template<class TValue,
+    matrix_layout Layout = matrix_layout::row_major,
+    class TAllocator = std::allocator<TValue>>
 class matrix final {
 
 public:
 
+    /// <summary>
+    /// The allocator used for the storage of the matrix.
+    /// </summary>
+    typedef TAllocator allocator_type;
+
     /// <summary>
     /// An iterator over the columns of a matrix.
     /// </summary>
@@ -112,8 +129,10 @@ public:
     inline matrix(_In_ const std::size_t rows = 0,
             _In_ const std::size_t columns = 0,
             _In_ value_type value = static_cast<value_type>(0))
-        : _stride((Layout == matrix_layout::row_major) ? columns : rows),
-            _elements(rows * columns, value) { }
+        : _columns(columns),
+            _elements(allocation(rows, columns), value),
+            _rows(rows),
+            _stride(leading_dimension(rows, columns)) { }
 
     /// <summary>
     /// Initialises a new instance
@@ -130,11 +149,29 @@ public:
             _In_ const std::enable_if_t<!std::is_same_v<TGenerator, TValue>,
                 std::size_t> columns,
             _In_ TGenerator&& generator)
-        : _stride((Layout == matrix_layout::row_major) ? columns : rows),
-            _elements(rows * columns) {
+        : _columns(columns),
+            _elements(allocation(rows, columns)),
+            _rows(rows),
+            _stride(leading_dimension(rows, columns)) {
         this->fill(std::forward<TGenerator>(generator));
     }
 
+    /// <summary>
+    /// Initialises a new instance holding a copy of a matrix with a different
+    /// layout or allocator.
+    /// </summary>
+    /// <remarks>
+    /// If the layouts differ, the elements are transposed in cache-sized tiles,
+    /// which is much faster than copying element by element for large
+    /// matrices.
+    /// </remarks>
+    /// <typeparam name="L">The layout of <paramref name="rhs" />.</typeparam>
+    /// <typeparam name="A">The allocator of <paramref name="rhs" />.
+    /// </typeparam>
+    /// <param name="rhs">The matrix to be copied.</param>
+    template<matrix_layout L, class A>
+    explicit matrix(_In_ const matrix<TValue, L, A>& rhs);
+
     /// <summary>
     /// Gets a column-order iterator for the begin of the specified column.
     /// </summary>
@@ -145,7 +182,7 @@ public:
     inline column_iterator begin_column(
             _In_ const std::size_t column) noexcept {
         assert(column < this->columns());
-        return column_iterator(*this, this->index(0, column));
+        return column_iterator(*this, column * this->rows());
     }
 
     /// <summary>
@@ -158,7 +195,7 @@ public:
     inline const_column_iterator begin_column(
             _In_ const std::size_t column) const noexcept {
         assert(column < this->columns());
-        return const_column_iterator(*this, this->index(0, column));
+        return const_column_iterator(*this, column * this->rows());
     }
 
     /// <summary>
@@ -188,7 +225,7 @@ public:
     /// which will enumerate the elements in row-major order.</returns>
     inline row_iterator begin_row(_In_ const std::size_t row) noexcept {
         assert(row < this->rows());
-        return row_iterator(*this, this->index(row, 0));
+        return row_iterator(*this, row * this->columns());
     }
 
     /// <summary>
@@ -201,7 +238,7 @@ public:
     inline const_row_iterator begin_row(
             _In_ const std::size_t row) const noexcept {
         assert(row < this->rows());
-        return const_row_iterator(*this, this->index(row, 0));
+        return const_row_iterator(*this, row * this->columns());
     }
 
     /// <summary>
@@ -226,12 +263,14 @@ public:
     /// Extracts a column from the matrix.
     /// </summary>
     /// <typeparam name="L">The layout of <paramref name="dst" />.</typeparam>
+    /// <typeparam name="A">The allocator of <paramref name="dst" />.
+    /// </typeparam>
     /// <param name="dst">The matrix to receive the single column.</param>
     /// <param name="column">The zero-based index of the column to be extracted.
     /// </param>
     /// <returns><paramref name="dst" />.</returns>
-    template<matrix_layout L> matrix<TValue, L>& column(
-        _Inout_ matrix<TValue, L>& dst,
+    template<matrix_layout L, class A> matrix<TValue, L, A>& column(
+        _Inout_ matrix<TValue, L, A>& dst,
         _In_ const std::size_t column) const;
 
     /// <summary>
@@ -250,10 +289,7 @@ public:
     /// </summary>
     /// <returns>The number of columns in the matrix.</returns>
     inline std::size_t columns(void) const noexcept {
-        assert((this->_elements.size() % this->_stride) == 0);
-        return this->row_major()
-            ? this->_stride
-            : this->_elements.size() / this->_stride;
+        return this->_columns;
     }
 
     /// <summary>
@@ -271,7 +307,31 @@ public:
     /// <returns><c>true</c> if the matrix has no elements,
     /// <c>false</c> otherwise.</returns>
     inline bool empty(void) const noexcept {
-        return this->_elements.empty();
+        return (this->size() == 0);
+    }
+
+    /// <summary>
+    /// Answer the in-memory representation of the matrix.
+    /// </summary>
+    /// <remarks>
+    /// The rows or columns of the matrix are <see cref="stride" /> elements
+    /// apart, which might include padding.
+    /// </remarks>
+    /// <returns>A pointer to the first element of the matrix.</returns>
+    inline value_type *data(void) noexcept {
+        return this->_elements.data();
+    }
+
+    /// <summary>
+    /// Answer the in-memory representation of the matrix.
+    /// </summary>
+    /// <remarks>
+    /// The rows or columns of the matrix are <see cref="stride" /> elements
+    /// apart, which might include padding.
+    /// </remarks>
+    /// <returns>A pointer to the first element of the matrix.</returns>
+    inline const value_type *data(void) const noexcept {
+        return this->_elements.data();
     }
 
     /// <summary>
@@ -283,9 +343,7 @@ public:
     /// </returns>
     inline column_iterator end_column(_In_ const std::size_t column) noexcept {
         assert(column < this->columns());
-        const auto row = this->rows() - 1;
-        column_iterator retval(*this, this->index(row, column));
-        return ++retval;
+        return column_iterator(*this, (column + 1) * this->rows());
     }
 
     /// <summary>
@@ -298,9 +356,7 @@ public:
     inline const const_column_iterator end_column(
             _In_ const std::size_t column) const noexcept {
         assert(column < this->columns());
-        const auto row = this->rows() - 1;
-        const_column_iterator retval(*this, this->index(row, column));
-        return ++retval;
+        return const_column_iterator(*this, (column + 1) * this->rows());
     }
 
     /// <summary>
@@ -312,9 +368,7 @@ public:
     /// </returns>
     inline row_iterator end_row(_In_ const std::size_t row) noexcept {
         assert(row < this->rows());
-        const auto column = this->columns() - 1;
-        row_iterator retval(*this, this->index(row, column));
-        return ++retval;
+        return row_iterator(*this, (row + 1) * this->columns());
     }
 
     /// <summary>
@@ -327,9 +381,7 @@ public:
     inline const_row_iterator end_row(
             _In_ const std::size_t row) const noexcept {
         assert(row < this->rows());
-        const auto column = this->columns() - 1;
-        const_row_iterator  retval(*this, this->index(row, column));
-        return ++retval;
+        return const_row_iterator(*this, (row + 1) * this->columns());
     }
 
     /// <summary>
@@ -337,8 +389,7 @@ public:
     /// </summary>
     /// <returns>An iterator past the last element in the matrix.</returns>
     inline column_iterator end_columns(void) noexcept {
-        const auto step = this->step<column_iterator>();
-        return column_iterator(*this, this->size() * step);
+        return column_iterator(*this, this->size());
     }
 
     /// <summary>
@@ -346,8 +397,7 @@ public:
     /// </summary>
     /// <returns>An iterator past the last element in the matrix.</returns>
     inline const const_column_iterator end_columns(void) const noexcept {
-        const auto step = this->step<const_column_iterator>();
-        return const_column_iterator(*this, this->size() * step);
+        return const_column_iterator(*this, this->size());
     }
 
     /// <summary>
@@ -355,8 +405,7 @@ public:
     /// </summary>
     /// <returns>An iterator past the last element in the matrix.</returns>
     inline row_iterator end_rows(void) noexcept {
-        const auto step = this->step<row_iterator>();
-        return row_iterator(*this, this->size() * step);
+        return row_iterator(*this, this->size());
     }
 
     /// <summary>
@@ -364,8 +413,7 @@ public:
     /// </summary>
     /// <returns>An iterator past the last element in the matrix.</returns>
     inline const const_row_iterator end_rows(void) const noexcept {
-        const auto step = this->step<const_row_iterator>();
-        return const_row_iterator(*this, this->size() * step);
+        return const_row_iterator(*this, this->size());
     }
 
     /// <summary>
@@ -389,24 +437,26 @@ public:
     void fill(_In_ const TGenerator& generator);
 
     /// <summary>
-    /// Answer the index of the given <paramref name="row" /> and
-    /// <paramref name="column" /> in the in-memory representation of the
-    /// matrix.
+    /// Answer the flattened index of the given <paramref name="row" /> and
+    /// <paramref name="column" />.
     /// </summary>
+    /// <remarks>
+    /// Unless the matrix is padded, the flattened index is the index in the
+    /// in-memory representation of the matrix.
+    /// </remarks>
     /// <param name="row">The zero-based row to get the index of. The parameter
     /// is not checked for validity.</param>
     /// <param name="column">The zero-based column to get the index of. The
     /// parameter is not checked for validity.</param>
-    /// <returns>The index of the matrix element in the in-memory representation
-    /// of the matrix.</returns>
+    /// <returns>The flattened index of the matrix element.</returns>
     inline std::size_t index(
             _In_ const std::size_t row,
             _In_ const std::size_t column) const noexcept {
         assert(row < this->rows());
         assert(column < this->columns());
         return (Layout == matrix_layout::row_major)
-            ? (row * this->_stride + column)
-            : (column * this->_stride + row);
+            ? (row * this->_columns + column)
+            : (column * this->_rows + row);
     }
 
     /// <summary>
@@ -448,12 +498,14 @@ public:
     /// Extracts a row from the matrix.
     /// </summary>
     /// <typeparam name="L">The layout of <paramref name="dst" />.</typeparam>
+    /// <typeparam name="A">The allocator of <paramref name="dst" />.
+    /// </typeparam>
     /// <param name="dst">The matrix to receive the single row.</param>
     /// <param name="row">The zero-based index of the row to be extracted.
     /// </param>
     /// <returns><paramref name="dst" />.</returns>
-    template<matrix_layout L> matrix<TValue, L>& row(
-        _Inout_ matrix<TValue, L>& dst,
+    template<matrix_layout L, class A> matrix<TValue, L, A>& row(
+        _Inout_ matrix<TValue, L, A>& dst,
         _In_ const std::size_t row) const;
 
     /// <summary>
@@ -474,10 +526,7 @@ public:
     /// </summary>
     /// <returns>The number of rows in the matrix.</returns>
     inline std::size_t rows(void) const noexcept {
-        assert((this->_elements.size() % this->_stride) == 0);
-        return (Layout == matrix_layout::row_major)
-            ? this->_elements.size() / this->_stride
-            : this->_stride;
+        return this->_rows;
     }
 
     /// <summary>
@@ -494,19 +543,35 @@ public:
     /// </summary>
     /// <returns>The number of elements in the matrix.</returns>
     inline std::size_t size(void) const noexcept {
-        return this->_elements.size();
+        return this->_rows * this->_columns;
     }
 
     /// <summary>
-    /// Answer the number of consecutively stored elements. The layout of the
-    /// matrix determines whether this is the number of rows or the number of
-    /// columns.
+    /// Answer the distance between the begin of two consecutive rows (for
+    /// row-major matrices) or columns (for column-major matrices) in memory.
     /// </summary>
-    /// <returns>The number of consecutively stored elements.</returns>
+    /// <remarks>
+    /// This is the number of columns or rows, respectively, plus the padding
+    /// requested by <typeparamref name="TAllocator" />.
+    /// </remarks>
+    /// <returns>The number of elements between two consecutive rows or
+    /// columns.</returns>
     inline std::size_t stride(void) const noexcept {
         return this->_stride;
     }
 
+    /// <summary>
+    /// Transposes the matrix while preserving its layout.
+    /// </summary>
+    /// <remarks>
+    /// Square matrices are transposed in place without allocating any memory.
+    /// Otherwise, the elements must move to different lines, wherefore the
+    /// matrix is transposed into a new buffer that replaces the current one.
+    /// In both cases, the elements are processed in cache-sized tiles.
+    /// </remarks>
+    /// <returns><c>*this</c>.</returns>
+    matrix& transpose(void);
+
     /// <summary>
     /// Test for equality.
     /// </summary>
@@ -534,7 +599,7 @@ public:
     inline const_return_value_type operator ()(
             _In_ const std::size_t row,
             _In_ const std::size_t column) const noexcept {
-        return this->_elements[this->index(row, column)];
+        return this->_elements[this->offset(row, column)];
     }
 
     /// <summary>
@@ -546,7 +611,7 @@ public:
     inline return_value_type operator ()(
             _In_ const std::size_t row,
             _In_ const std::size_t column) noexcept {
-        return this->_elements[this->index(row, column)];
+        return this->_elements[this->offset(row, column)];
     }
 
     /// <summary>
@@ -557,7 +622,7 @@ public:
     inline const_return_value_type operator [](
             _In_ const std::size_t index) const noexcept {
         assert(index < this->size());
-        return this->_elements[index];
+        return this->_elements[this->offset(index)];
     }
 
     /// <summary>
@@ -568,28 +633,78 @@ public:
     inline return_value_type operator [](
             _In_ const std::size_t index) noexcept {
         assert(index < this->size());
-        return this->_elements[index];
+        return this->_elements[this->offset(index)];
     }
 
     /// <summary>
     /// Answer the flat in-memory representation of the matrix.
     /// </summary>
     /// <returns>The elements in the matrix. The order of the return value
-    /// depends on the layout of the matrix.</returns>
-    inline operator const std::vector<value_type>&(void) const noexcept {
+    /// depends on the layout of the matrix, and it includes the padding if the
+    /// matrix is padded.</returns>
+    inline operator const std::vector<value_type, allocator_type>&(
+            void) const noexcept {
         return this->_elements;
     }
 
 private:
 
-    template<class TIterator>
-    inline constexpr std::size_t step(void) const noexcept {
-        return (detail::layout_v<TIterator> == Layout)
-            ? static_cast<std::size_t>(1)
-            : this->stride();
+    /// <summary>
+    /// Computes the number of elements to allocate for a matrix of the given
+    /// dimensions.
+    /// </summary>
+    static inline constexpr std::size_t allocation(
+            _In_ const std::size_t rows,
+            _In_ const std::size_t columns) noexcept {
+        return ((Layout == matrix_layout::row_major) ? rows : columns)
+            * leading_dimension(rows, columns);
+    }
+
+    /// <summary>
+    /// Computes the stride of a matrix of the given dimensions.
+    /// </summary>
+    static inline constexpr std::size_t leading_dimension(
+            _In_ const std::size_t rows,
+            _In_ const std::size_t columns) noexcept {
+        return detail::round_up((Layout == matrix_layout::row_major)
+            ? columns
+            : rows, detail::padding_v<allocator_type>);
+    }
+
+    /// <summary>
+    /// Answer the position of the given <paramref name="row" /> and
+    /// <paramref name="column" /> in <see cref="_elements" />.
+    /// </summary>
+    inline std::size_t offset(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        assert(row < this->rows());
+        assert(column < this->columns());
+        return (Layout == matrix_layout::row_major)
+            ? (row * this->_stride + column)
+            : (column * this->_stride + row);
+    }
+
+    /// <summary>
+    /// Answer the position of the element with the given flattened index in
+    /// <see cref="_elements" />.
+    /// </summary>
+    inline std::size_t offset(_In_ const std::size_t index) const noexcept {
+        if constexpr (detail::padding_v<allocator_type> == 1) {
+            return index;
+        } else {
+            const auto minor = (Layout == matrix_layout::row_major)
+                ? this->_columns
+                : this->_rows;
+            return (minor == this->_stride)
+                ? index
+                : (index / minor) * this->_stride + (index % minor);
+        }
     }
 
-    std::vector<value_type> _elements;
+    std::size_t _columns;
+    std::vector<value_type, allocator_type> _elements;
+    std::size_t _rows;
     std::size_t _stride;
 
 public:
@@ -598,19 +713,40 @@ public:
     /// Gets an iterator for the begin of elements. The order of the elements
     /// depends of the layout of the matrix.
     /// </summary>
+    /// <remarks>
+    /// If the matrix is not padded, this is an iterator over the in-memory
+    /// representation of the matrix. Otherwise, the iterator skips the
+    /// padding.
+    /// </remarks>
     /// <returns>An iterator for the begin of the elements.</returns>
-    inline auto begin(void) noexcept -> decltype(this->_elements.begin()) {
-        return this->_elements.begin();
+    inline auto begin(void) noexcept {
+        if constexpr (detail::padding_v<allocator_type> == 1) {
+            return this->_elements.begin();
+        } else if constexpr (Layout == matrix_layout::row_major) {
+            return this->begin_rows();
+        } else {
+            return this->begin_columns();
+        }
     }
 
     /// <summary>
     /// Gets an iterator for the begin of elements. The order of the elements
     /// depends of the layout of the matrix.
     /// </summary>
+    /// <remarks>
+    /// If the matrix is not padded, this is an iterator over the in-memory
+    /// representation of the matrix. Otherwise, the iterator skips the
+    /// padding.
+    /// </remarks>
     /// <returns>An iterator for the begin of the elements.</returns>
-    inline auto begin(void) const noexcept
-            -> decltype(this->_elements.begin()) {
-        return this->_elements.begin();
+    inline auto begin(void) const noexcept {
+        if constexpr (detail::padding_v<allocator_type> == 1) {
+            return this->_elements.begin();
+        } else if constexpr (Layout == matrix_layout::row_major) {
+            return this->begin_rows();
+        } else {
+            return this->begin_columns();
+        }
     }
 
     /// <summary>
@@ -618,8 +754,14 @@ public:
     /// depends of the layout of the matrix.
     /// </summary>
     /// <returns>An iterator for the end of the elements.</returns>
-    inline auto end(void) noexcept -> decltype(this->_elements.end()) {
-        return this->_elements.end();
+    inline auto end(void) noexcept {
+        if constexpr (detail::padding_v<allocator_type> == 1) {
+            return this->_elements.end();
+        } else if constexpr (Layout == matrix_layout::row_major) {
+            return this->end_rows();
+        } else {
+            return this->end_columns();
+        }
     }
 
     /// <summary>
@@ -627,11 +769,17 @@ public:
     /// depends of the layout of the matrix.
     /// </summary>
     /// <returns>An iterator for the end of the elements.</returns>
-    inline auto end(void) const noexcept -> decltype(this->_elements.end()) {
-        return this->_elements.end();
+    inline auto end(void) const noexcept {
+        if constexpr (detail::padding_v<allocator_type> == 1) {
+            return this->_elements.end();
+        } else if constexpr (Layout == matrix_layout::row_major) {
+            return this->end_rows();
+        } else {
+            return this->end_columns();
+        }
     }
 
-    template<class, matrix_layout> friend class matrix;
+    template<class, matrix_layout, class> friend class matrix;
 };
 
 LHS_NAMESPACE_END
@@ -1,139 +1,206 @@
-﻿// <copyright file="matrix.inl" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
-// Licensed under the MIT licence. See LICENCE file for details.
-// </copyright>
-// <author>Christoph Müller</author>
-
-
-/*
- * matrix<TValue, Layout>::diagonal
- */
-template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
-constexpr LHS_NAMESPACE::matrix<TValue, Layout>
-LHS_NAMESPACE::matrix<TValue, Layout>::diagonal(
-        _In_ const std::size_t size,
-        _In_ const value_type value) {
-    matrix retval(size, size, static_cast<value_type>(0));
-
-    for (std::size_t i = 0; i < size; ++i) {
-        retval(i, i) = value;
-    }
-
-    return retval;
-}
-
-
-/*
- * LHS_NAMESPACE::matrix<TValue, Layout>::column
- */
-template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
-template<LHS_NAMESPACE::matrix_layout L>
-LHS_NAMESPACE::matrix<TValue, L>&
-LHS_NAMESPACE::matrix<TValue, Layout>::column(
-        _Inout_ matrix<TValue, L>& dst,
-        _In_ const std::size_t column) const {
-    assert(dst.columns() == 1);
-    assert(dst.rows() == this->rows());
-    assert(column < this->columns());
-
-
-    if ((Layout == matrix_layout::column_major)
-            && (L == matrix_layout::column_major)) {
-        std::copy(this->_elements.begin() + this->index(0, column),
-            this->_elements.begin() + this->index(0, column + 1),
-            dst._elements.begin());
-    } else {
-        for (std::size_t r = 0; r < this->rows(); ++r) {
-            dst._elements[r] = (*this)(r, column);
-        }
-    }
-
-    return dst;
-}
-
-
-/*
- * LHS_NAMESPACE::matrix<TValue, Layout>::fill
- */
-template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
-template<class TGenerator>
-void LHS_NAMESPACE::matrix<TValue, Layout>::fill(
-        _In_ const TGenerator& generator) {
-    for (std::size_t r = 0, R = this->rows(); r < R; ++r) {
-        for (std::size_t c = 0, C = this->columns(); c < C; ++c) {
-            this->_elements[this->index(r, c)] = generator(r, c);
-        }
-    }
-}
-
-
-/*
- * LHS_NAMESPACE::matrix<TValue, Layout>::index
- */
-template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
-bool LHS_NAMESPACE::matrix<TValue, Layout>::index(
-        _Out_ std::size_t& row,
-        _Out_ std::size_t& column,
-        _In_ const std::size_t index) const noexcept {
-    const auto cols = this->columns();
-    const auto rows = this->rows();
-
-    if (this->layout() == matrix_layout::row_major) {
-        row = index / cols;
-        column = index % cols;
-    } else {
-        column = index / rows;
-        row = index % rows;
-    }
-
-    return ((row < rows) && (column < cols));
-}
-
-
-/*
- * LHS_NAMESPACE::matrix<TValue, Layout>::row
- */
-template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
-template<LHS_NAMESPACE::matrix_layout L>
-LHS_NAMESPACE::matrix<TValue, L>&
-LHS_NAMESPACE::matrix<TValue, Layout>::row(
-        _Inout_ matrix<TValue, L>& dst,
-        _In_ const std::size_t row) const {
-    assert(dst.rows() == 1);
-    assert(dst.columns() == this->columns());
-    assert(row < this->rows());
-
-    if ((Layout == matrix_layout::row_major)
-            && (L == matrix_layout::row_major)) {
-        std::copy(this->_elements.begin() + index(row, 0),
-            this->_elements.begin() + index(row + 1, 0),
-            dst._elements.begin());
-    } else {
-        for (std::size_t c = 0; c < this->columns(); ++c) {
-            dst._elements[c] = (*this)(row, c);
-        }
-    }
-
-    return dst;
-}
-
-
-/*
- * LHS_NAMESPACE::matrix<TValue, Layout>::operator ==
- */
-template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
-bool LHS_NAMESPACE::matrix<TValue, Layout>::operator ==(
-        _In_ const matrix& rhs) const noexcept {
-    if (this->size() != rhs.size()) {
-        return false;
-    }
-
-    if (this->_stride != rhs._stride) {
-        return false;
-    }
-
-    return (std::memcmp(this->_elements.data(),
-        rhs._elements.data(),
-        this->_elements.size() * sizeof(value_type))
-        == 0);
-}
+﻿// <copyright file="matrix.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * matrix<TValue, Layout, TAllocator>::diagonal
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+constexpr LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>
+LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::diagonal(
+        _In_ const std::size_t size,
+        _In_ const value_type value) {
+    matrix retval(size, size, static_cast<value_type>(0));
+
+    for (std::size_t i = 0; i < size; ++i) {
+        retval(i, i) = value;
+    }
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::column
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+template<LHS_NAMESPACE::matrix_layout L, class A>
+LHS_NAMESPACE::matrix<TValue, L, A>&
+LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::column(
+        _Inout_ matrix<TValue, L, A>& dst,
+        _In_ const std::size_t column) const {
+    assert(dst.columns() == 1);
+    assert(dst.rows() == this->rows());
+    assert(column < this->columns());
+    const auto n = this->rows();
+
+    // Note: the columns of row-major matrices are strided. In case of 'dst',
+    // the stride is the padding of a row, which is one if unpadded.
+    detail::copy(vector_view<TValue>(dst.data(), n,
+            (L == matrix_layout::row_major) ? dst.stride() : 1),
+        vector_view<const TValue>(this->data() + this->offset(0, column), n,
+            (Layout == matrix_layout::row_major) ? this->_stride : 1));
+
+    return dst;
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::fill
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+template<class TGenerator>
+void LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::fill(
+        _In_ const TGenerator& generator) {
+    for (std::size_t r = 0, R = this->rows(); r < R; ++r) {
+        for (std::size_t c = 0, C = this->columns(); c < C; ++c) {
+            (*this)(r, c) = generator(r, c);
+        }
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::index
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+bool LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::index(
+        _Out_ std::size_t& row,
+        _Out_ std::size_t& column,
+        _In_ const std::size_t index) const noexcept {
+    const auto cols = this->columns();
+    const auto rows = this->rows();
+
+    if (this->layout() == matrix_layout::row_major) {
+        row = index / cols;
+        column = index % cols;
+    } else {
+        column = index / rows;
+        row = index % rows;
+    }
+
+    return ((row < rows) && (column < cols));
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::row
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+template<LHS_NAMESPACE::matrix_layout L, class A>
+LHS_NAMESPACE::matrix<TValue, L, A>&
+LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::row(
+        _Inout_ matrix<TValue, L, A>& dst,
+        _In_ const std::size_t row) const {
+    assert(dst.rows() == 1);
+    assert(dst.columns() == this->columns());
+    assert(row < this->rows());
+    const auto n = this->columns();
+
+    // Note: the rows of column-major matrices are strided. In case of 'dst',
+    // the stride is the padding of a column, which is one if unpadded.
+    detail::copy(vector_view<TValue>(dst.data(), n,
+            (L == matrix_layout::column_major) ? dst.stride() : 1),
+        vector_view<const TValue>(this->data() + this->offset(row, 0), n,
+            (Layout == matrix_layout::column_major) ? this->_stride : 1));
+
+    return dst;
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::operator ==
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+bool LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::operator ==(
+        _In_ const matrix& rhs) const noexcept {
+    if ((this->_rows != rhs._rows) || (this->_columns != rhs._columns)) {
+        return false;
+    }
+
+    // Note: we cannot compare the whole in-memory representation of padded
+    // matrices, because the padding is not guaranteed to be initialised
+    // equally. Therefore, we compare each row or column bitwise.
+    const auto lines = this->row_major() ? this->_rows : this->_columns;
+    const auto minor = this->row_major() ? this->_columns : this->_rows;
+
+    if ((this->_stride == minor) && (rhs._stride == minor)) {
+        return (std::memcmp(this->_elements.data(),
+            rhs._elements.data(),
+            lines * minor * sizeof(value_type))
+            == 0);
+    }
+
+    for (std::size_t l = 0; l < lines; ++l) {
+        if (std::memcmp(this->_elements.data() + l * this->_stride,
+                rhs._elements.data() + l * rhs._stride,
+                minor * sizeof(value_type)) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::matrix
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+template<LHS_NAMESPACE::matrix_layout L, class A>
+LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::matrix(
+        _In_ const matrix<TValue, L, A>& rhs)
+    : _columns(rhs.columns()),
+        _elements(allocation(rhs.rows(), rhs.columns())),
+        _rows(rhs.rows()),
+        _stride(leading_dimension(rhs.rows(), rhs.columns())) {
+    // Note: 'lines' is the number of rows or columns in 'rhs', 'minor' the
+    // number of elements in each of them.
+    const auto lines = rhs.row_major() ? rhs.rows() : rhs.columns();
+    const auto minor = rhs.row_major() ? rhs.columns() : rhs.rows();
+
+    if constexpr (L == Layout) {
+        for (std::size_t l = 0; l < lines; ++l) {
+            const auto src = rhs.data() + l * rhs.stride();
+            std::copy(src, src + minor, this->data() + l * this->_stride);
+        }
+
+    } else {
+        detail::transpose(this->data(), this->_stride,
+            rhs.data(), rhs.stride(),
+            lines, minor);
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::transpose
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>&
+LHS_NAMESPACE::matrix<TValue, Layout, TAllocator>::transpose(void) {
+    if (this->_rows == this->_columns) {
+        detail::transpose(this->data(), this->_stride, this->_rows);
+
+    } else {
+        const auto lines = this->row_major() ? this->_rows : this->_columns;
+        const auto minor = this->row_major() ? this->_columns : this->_rows;
+        const auto stride = leading_dimension(this->_columns, this->_rows);
+        std::vector<value_type, allocator_type> elements(
+            allocation(this->_columns, this->_rows),
+            this->_elements.get_allocator());
+
+        detail::transpose(elements.data(), stride,
+            this->data(), this->_stride,
+            lines, minor);
+
+        this->_elements = std::move(elements);
+        std::swap(this->_rows, this->_columns);
+        this->_stride = stride;
+    }
+
+    return *this;
+}
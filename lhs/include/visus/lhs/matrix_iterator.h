@@ -9,9 +9,9 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
 #include <cstdlib>
 #include <iterator>
-#include <memory>
 #include <type_traits>
 
 #include "visus/lhs/layout.h"
@@ -20,59 +20,195 @@
 LHS_DETAIL_NAMESPACE_BEGIN
 
 /// <summary>
-/// An iterator for the elements of a matrix.
+/// A random-access iterator for the elements of a matrix.
 /// </summary>
+/// <remarks>
+/// <para>The iterator enumerates the matrix line by line, i.e. row by row or
+/// column by column depending on <typeparamref name="Order" />. It carries a
+/// pointer to the current element and the strides within and between the
+/// lines, so dereferencing it does not involve any index computations and
+/// advancing it by one element is a pointer increment, which only needs to be
+/// corrected at the end of a line. Only moving the iterator by an arbitrary
+/// offset requires a division.</para>
+/// <para>If <typeparamref name="Order" /> matches the layout of the matrix,
+/// the elements within a line are contiguous in memory. Use
+/// <see cref="row_view" /> or <see cref="column_view" /> to process such
+/// lines as plain memory.</para>
+/// </remarks>
 /// <typeparam name="TMatrix">The type of the matrix to be iterated over.
 /// </typeparam>
 /// <typeparam name="Order">Determines the order in which the elements should
 /// be enumerated. If this is <see cref="matrix_layout::row_major" />, the
 /// elements are enumerated row by row.</typeparam>
-template<class TMatrix, matrix_layout Order>
-class matrix_iterator final : public std::iterator<std::forward_iterator_tag,
-        typename TMatrix::value_type> {
+template<class TMatrix, matrix_layout Order> class matrix_iterator final {
 
 public:
 
+    /// <summary>
+    /// The type to express the distance between two iterators.
+    /// </summary>
+    typedef std::ptrdiff_t difference_type;
+
+    /// <summary>
+    /// The category of the iterator.
+    /// </summary>
+    typedef std::random_access_iterator_tag iterator_category;
+
     /// <summary>
     /// The type of the matrix to be iterated over.
     /// </summary>
     typedef TMatrix matrix_type;
 
+    /// <summary>
+    /// The type of the elements.
+    /// </summary>
+    typedef typename TMatrix::value_type value_type;
+
+    /// <summary>
+    /// A pointer to an element.
+    /// </summary>
+    typedef std::conditional_t<std::is_const_v<TMatrix>,
+        const value_type, value_type> *pointer;
+
+    /// <summary>
+    /// A reference to an element.
+    /// </summary>
+    typedef std::conditional_t<std::is_const_v<TMatrix>,
+        const value_type, value_type>& reference;
+
+    /// <summary>
+    /// Initialises a new instance that does not iterate any matrix.
+    /// </summary>
+    inline matrix_iterator(void) noexcept
+        : _current(nullptr), _data(nullptr), _inner(0), _length(0),
+            _minor(0), _outer(0), _position(0) { }
+
     /// <summary>
     /// Initialises a new instance.
     /// </summary>
     /// <param name="matrix">The matrix to be iterated.</param>
-    /// <param name="position">The zero-based initial position of the iterator.
-    /// </param>
-    inline explicit matrix_iterator(
-            _In_ matrix_type& matrix,
-            _In_ const std::size_t position = 0) noexcept
-        : _matrix(matrix), _position(position) { }
+    /// <param name="position">The zero-based initial position of the iterator
+    /// in the enumeration order.</param>
+    explicit matrix_iterator(_In_ matrix_type& matrix,
+        _In_ const std::size_t position = 0) noexcept;
+
+    /// <summary>
+    /// Gets the current element.
+    /// </summary>
+    /// <returns>The current element.</returns>
+    inline reference operator *(void) const noexcept {
+        return *this->_current;
+    }
 
     /// <summary>
     /// Gets a pointer to the current element.
     /// </summary>
     /// <returns>A pointer to the current element.</returns>
-    inline pointer operator ->(void) {
-        return std::addressof(*this);
+    inline pointer operator ->(void) const noexcept {
+        return this->_current;
+    }
+
+    /// <summary>
+    /// Gets the element <paramref name="offset" /> positions away from the
+    /// current one.
+    /// </summary>
+    /// <param name="offset">The offset in number of elements.</param>
+    /// <returns>The element at the specified offset.</returns>
+    inline reference operator [](
+            _In_ const difference_type offset) const noexcept {
+        return *(*this + offset);
     }
 
     /// <summary>
     /// Prefix increment.
     /// </summary>
     /// <returns>The iterator after it has been advanced.</returns>
-    matrix_iterator& operator ++(void);
+    matrix_iterator& operator ++(void) noexcept;
 
     /// <summary>
     /// Postfix increment.
     /// </summary>
     /// <returns>The iterator before it has been advanced.</returns>
-    inline matrix_iterator operator ++(int) {
+    inline matrix_iterator operator ++(int) noexcept {
         auto retval = *this;
         ++(*this);
         return retval;
     }
 
+    /// <summary>
+    /// Prefix decrement.
+    /// </summary>
+    /// <returns>The iterator after it has been moved back.</returns>
+    matrix_iterator& operator --(void) noexcept;
+
+    /// <summary>
+    /// Postfix decrement.
+    /// </summary>
+    /// <returns>The iterator before it has been moved back.</returns>
+    inline matrix_iterator operator --(int) noexcept {
+        auto retval = *this;
+        --(*this);
+        return retval;
+    }
+
+    /// <summary>
+    /// Advances the iterator by <paramref name="offset" /> elements.
+    /// </summary>
+    /// <param name="offset">The number of elements to advance.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline matrix_iterator& operator +=(
+            _In_ const difference_type offset) noexcept {
+        this->seek(this->_position + offset);
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the iterator back by <paramref name="offset" /> elements.
+    /// </summary>
+    /// <param name="offset">The number of elements to move back.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline matrix_iterator& operator -=(
+            _In_ const difference_type offset) noexcept {
+        this->seek(this->_position - offset);
+        return *this;
+    }
+
+    /// <summary>
+    /// Answer an iterator <paramref name="offset" /> elements ahead.
+    /// </summary>
+    /// <param name="offset">The number of elements to advance.</param>
+    /// <returns>The advanced iterator.</returns>
+    inline matrix_iterator operator +(
+            _In_ const difference_type offset) const noexcept {
+        auto retval = *this;
+        return (retval += offset);
+    }
+
+    /// <summary>
+    /// Answer an iterator <paramref name="offset" /> elements back.
+    /// </summary>
+    /// <param name="offset">The number of elements to move back.</param>
+    /// <returns>The moved iterator.</returns>
+    inline matrix_iterator operator -(
+            _In_ const difference_type offset) const noexcept {
+        auto retval = *this;
+        return (retval -= offset);
+    }
+
+    /// <summary>
+    /// Answer the number of elements between <paramref name="rhs" /> and this
+    /// iterator.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand, which must iterate the
+    /// same matrix.</param>
+    /// <returns>The distance between the iterators in elements.</returns>
+    inline difference_type operator -(
+            _In_ const matrix_iterator& rhs) const noexcept {
+        assert(this->_data == rhs._data);
+        return static_cast<difference_type>(this->_position)
+            - static_cast<difference_type>(rhs._position);
+    }
+
     /// <summary>
     /// Test for equality.
     /// </summary>
@@ -80,7 +216,7 @@ public:
     /// <returns><c>true</c> if this iterator and <paramref name="rhs" />
     /// designate the same matrix element, <c>false</c> otherwise.</returns>
     inline bool operator ==(_In_ const matrix_iterator& rhs) const noexcept {
-        assert(std::addressof(this->_matrix) == std::addressof(rhs._matrix));
+        assert(this->_data == rhs._data);
         return (this->_position == rhs._position);
     }
 
@@ -94,33 +230,82 @@ public:
         return !(*this == rhs);
     }
 
-private:
-
     /// <summary>
-    /// Answer how many elements to skip to get to the next row or column.
+    /// Answer whether this iterator is before <paramref name="rhs" />.
     /// </summary>
-    inline constexpr std::size_t step(void) const noexcept {
-        return (Order == layout_v<matrix_type>)
-            ? static_cast<std::size_t>(1)
-            : this->_matrix.stride();
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is before
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator <(_In_ const matrix_iterator& rhs) const noexcept {
+        assert(this->_data == rhs._data);
+        return (this->_position < rhs._position);
     }
 
-    matrix_type& _matrix;
-    std::size_t _position;
+    /// <summary>
+    /// Answer whether this iterator is before or at <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is not after
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator <=(_In_ const matrix_iterator& rhs) const noexcept {
+        return !(rhs < *this);
+    }
 
-public:
+    /// <summary>
+    /// Answer whether this iterator is after <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is after
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator >(_In_ const matrix_iterator& rhs) const noexcept {
+        return (rhs < *this);
+    }
 
     /// <summary>
-    /// Gets the current element.
+    /// Answer whether this iterator is after or at <paramref name="rhs" />.
     /// </summary>
-    /// <returns>The current element.</returns>
-    inline auto operator *(void) -> decltype(this->_matrix[0]) {
-        const auto q = this->_position / this->_matrix.size();
-        const auto r = this->_position % this->_matrix.size();
-        return this->_matrix[q + r];
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is not before
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator >=(_In_ const matrix_iterator& rhs) const noexcept {
+        return !(*this < rhs);
     }
+
+private:
+
+    /// <summary>
+    /// Moves the iterator to the given position in the enumeration order.
+    /// </summary>
+    void seek(_In_ const std::size_t position) noexcept;
+
+    pointer _current;
+    pointer _data;
+    difference_type _inner;
+    std::size_t _length;
+    std::size_t _minor;
+    difference_type _outer;
+    std::size_t _position;
 };
 
+
+/// <summary>
+/// Answer an iterator <paramref name="offset" /> elements ahead of
+/// <paramref name="it" />.
+/// </summary>
+/// <typeparam name="TMatrix">The type of the matrix to be iterated over.
+/// </typeparam>
+/// <typeparam name="Order">The enumeration order of the iterator.</typeparam>
+/// <param name="offset">The number of elements to advance.</param>
+/// <param name="it">The iterator to be advanced.</param>
+/// <returns>The advanced iterator.</returns>
+template<class TMatrix, matrix_layout Order>
+inline matrix_iterator<TMatrix, Order> operator +(
+        _In_ const typename matrix_iterator<TMatrix, Order>::difference_type
+            offset,
+        _In_ const matrix_iterator<TMatrix, Order>& it) noexcept {
+    return (it + offset);
+}
+
 LHS_DETAIL_NAMESPACE_END
 
 #include "visus/lhs/matrix_iterator.inl"
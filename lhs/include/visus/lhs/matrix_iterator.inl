@@ -5,12 +5,96 @@
 // <author>Christoph Müller</author>
 
 
+/*
+ * LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::matrix_iterator
+ */
+template<class TMatrix, LHS_NAMESPACE::matrix_layout Order>
+LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::matrix_iterator(
+        _In_ matrix_type& matrix,
+        _In_ const std::size_t position) noexcept
+    : _current(matrix.data()),
+        _data(matrix.data()),
+        _length((Order == matrix_layout::row_major)
+            ? matrix.columns()
+            : matrix.rows()),
+        _minor(0),
+        _position(0) {
+    const auto stride = static_cast<difference_type>(matrix.stride());
+
+    // If we enumerate in the order of the layout, the elements of a line are
+    // contiguous and the lines are the stride apart. Otherwise, the elements
+    // of a line are the stride apart and the lines are adjacent.
+    if (Order == layout_v<matrix_type>) {
+        this->_inner = 1;
+        this->_outer = stride;
+    } else {
+        this->_inner = stride;
+        this->_outer = 1;
+    }
+
+    this->seek(position);
+}
+
+
 /*
  * LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::operator ++
  */
 template<class TMatrix, LHS_NAMESPACE::matrix_layout Order>
 LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>&
-LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::operator ++(void) {
-    this->_position += this->step();
+LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::operator ++(
+        void) noexcept {
+    ++this->_position;
+
+    if (++this->_minor < this->_length) {
+        this->_current += this->_inner;
+    } else {
+        // Wrap around to the begin of the next line.
+        this->_current += this->_outer
+            - static_cast<difference_type>(this->_length - 1) * this->_inner;
+        this->_minor = 0;
+    }
+
     return *this;
 }
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::operator --
+ */
+template<class TMatrix, LHS_NAMESPACE::matrix_layout Order>
+LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>&
+LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::operator --(
+        void) noexcept {
+    assert(this->_position > 0);
+    --this->_position;
+
+    if (this->_minor > 0) {
+        this->_current -= this->_inner;
+        --this->_minor;
+    } else {
+        // Wrap around to the end of the previous line.
+        this->_minor = this->_length - 1;
+        this->_current -= this->_outer
+            - static_cast<difference_type>(this->_minor) * this->_inner;
+    }
+
+    return *this;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::seek
+ */
+template<class TMatrix, LHS_NAMESPACE::matrix_layout Order>
+void LHS_DETAIL_NAMESPACE::matrix_iterator<TMatrix, Order>::seek(
+        _In_ const std::size_t position) noexcept {
+    this->_position = position;
+
+    if (this->_length > 0) {
+        const auto line = static_cast<difference_type>(position
+            / this->_length);
+        this->_minor = position % this->_length;
+        this->_current = this->_data + line * this->_outer
+            + static_cast<difference_type>(this->_minor) * this->_inner;
+    }
+}
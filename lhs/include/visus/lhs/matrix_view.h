@@ -0,0 +1,375 @@
+﻿// <copyright file="matrix_view.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_MATRIX_VIEW_H)
+#define _LHS_MATRIX_VIEW_H
+#pragma once
+
+#include <cassert>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/vector_view.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// A non-owning view of a 2D matrix stored in memory owned by someone else.
+/// </summary>
+/// <remarks>
+/// <para>The view allows for writing Latin hypercube samples directly into
+/// external buffers, for instance memory-mapped files or buffers shared with
+/// other libraries, without copying them from a <see cref="matrix" />. All
+/// generators accept a view as their output.</para>
+/// <para>Views are lightweight and should be passed by value. Like a pointer,
+/// the constness of the view does not propagate to the elements. Use a view
+/// of <c>const TValue</c> for read-only access.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type used to store a scalar, which may be
+/// <c>const</c>-qualified.</typeparam>
+/// <typeparam name="Layout">The memory layout used by the matrix.</typeparam>
+template<class TValue, matrix_layout Layout = matrix_layout::row_major>
+class matrix_view final {
+
+public:
+
+    /// <summary>
+    /// The return type of an accessor to a matrix element.
+    /// </summary>
+    typedef TValue& return_value_type;
+
+    /// <summary>
+    /// The type used to store a scalar.
+    /// </summary>
+    typedef std::remove_const_t<TValue> value_type;
+
+    /// <summary>
+    /// Initialises a new, empty instance.
+    /// </summary>
+    inline matrix_view(void) noexcept
+        : _columns(0), _data(nullptr), _rows(0), _stride(0) { }
+
+    /// <summary>
+    /// Initialises a new instance for the given memory.
+    /// </summary>
+    /// <param name="data">A pointer to the first element of the matrix. The
+    /// caller must ensure that the memory lives as long as the view.</param>
+    /// <param name="rows">The number of rows in the matrix.</param>
+    /// <param name="columns">The number of columns in the matrix.</param>
+    /// <param name="stride">The distance between the begin of two consecutive
+    /// rows (for row-major matrices) or columns (for column-major matrices)
+    /// in elements. If zero, the matrix is assumed to be densely packed.
+    /// </param>
+    /// <exception cref="std::invalid_argument">If <paramref name="data" /> is
+    /// <c>nullptr</c> for a non-empty matrix or if the stride is too small to
+    /// hold a row or column, respectively.</exception>
+    matrix_view(_In_ TValue *data,
+        _In_ const std::size_t rows,
+        _In_ const std::size_t columns,
+        _In_ const std::size_t stride = 0);
+
+    /// <summary>
+    /// Initialises a new instance viewing the given matrix.
+    /// </summary>
+    /// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+    /// <param name="matrix">The matrix to be viewed. The view is invalidated
+    /// if the matrix is destroyed or resized.</param>
+    template<class TAllocator>
+    inline matrix_view(
+            _In_ matrix<value_type, Layout, TAllocator>& matrix) noexcept
+        : _columns(matrix.columns()),
+            _data(matrix.data()),
+            _rows(matrix.rows()),
+            _stride(matrix.stride()) { }
+
+    /// <summary>
+    /// Initialises a new read-only instance viewing the given matrix.
+    /// </summary>
+    /// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+    /// <param name="matrix">The matrix to be viewed. The view is invalidated
+    /// if the matrix is destroyed or resized.</param>
+    template<class TAllocator,
+        class T = TValue,
+        class = std::enable_if_t<std::is_const_v<T>>>
+    inline matrix_view(
+            _In_ const matrix<value_type, Layout, TAllocator>& matrix) noexcept
+        : _columns(matrix.columns()),
+            _data(matrix.data()),
+            _rows(matrix.rows()),
+            _stride(matrix.stride()) { }
+
+    /// <summary>
+    /// Converts a writable view into a read-only one.
+    /// </summary>
+    /// <typeparam name="T">The type of the elements of the writable view.
+    /// </typeparam>
+    /// <param name="view">The view to be converted.</param>
+    template<class T, class = std::enable_if_t<std::is_const_v<TValue>
+        && std::is_same_v<const T, TValue>>>
+    inline matrix_view(_In_ const matrix_view<T, Layout>& view) noexcept
+        : _columns(view.columns()),
+            _data(view.data()),
+            _rows(view.rows()),
+            _stride(view.stride()) { }
+
+    /// <summary>
+    /// Answer the number of columns in the matrix.
+    /// </summary>
+    /// <returns>The number of columns in the matrix.</returns>
+    inline std::size_t columns(void) const noexcept {
+        return this->_columns;
+    }
+
+    /// <summary>
+    /// Answer whether the matrix is stored in column-major order.
+    /// </summary>
+    /// <returns><c>true</c> if the matrix is a column-major matrix,
+    /// <c>false</c> if it is a row-major matrix.</returns>
+    inline constexpr bool column_major(void) const noexcept {
+        return (Layout == matrix_layout::column_major);
+    }
+
+    /// <summary>
+    /// Answer the memory the view is referring to.
+    /// </summary>
+    /// <returns>A pointer to the first element of the matrix.</returns>
+    inline TValue *data(void) const noexcept {
+        return this->_data;
+    }
+
+    /// <summary>
+    /// Answer whether the matrix has no elements.
+    /// </summary>
+    /// <returns><c>true</c> if the matrix has no elements,
+    /// <c>false</c> otherwise.</returns>
+    inline bool empty(void) const noexcept {
+        return (this->size() == 0);
+    }
+
+    /// <summary>
+    /// Answer the flattened index of the given <paramref name="row" /> and
+    /// <paramref name="column" />.
+    /// </summary>
+    /// <param name="row">The zero-based row to get the index of.</param>
+    /// <param name="column">The zero-based column to get the index of.</param>
+    /// <returns>The flattened index of the matrix element.</returns>
+    inline std::size_t index(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        assert(row < this->rows());
+        assert(column < this->columns());
+        return (Layout == matrix_layout::row_major)
+            ? (row * this->_columns + column)
+            : (column * this->_rows + row);
+    }
+
+    /// <summary>
+    /// Answer the memory layout of the matrix.
+    /// </summary>
+    /// <returns>The memory layout of the matrix.</returns>
+    inline constexpr matrix_layout layout(void) const noexcept {
+        return Layout;
+    }
+
+    /// <summary>
+    /// Answer the number of rows in the matrix.
+    /// </summary>
+    /// <returns>The number of rows in the matrix.</returns>
+    inline std::size_t rows(void) const noexcept {
+        return this->_rows;
+    }
+
+    /// <summary>
+    /// Answer whether the matrix is stored in row-major order.
+    /// </summary>
+    /// <returns><c>true</c> if the matrix is a row-major matrix,
+    /// <c>false</c> if it is a column-major matrix.</returns>
+    inline constexpr bool row_major(void) const noexcept {
+        return (Layout == matrix_layout::row_major);
+    }
+
+    /// <summary>
+    /// Answer the number of elements in the matrix.
+    /// </summary>
+    /// <returns>The number of elements in the matrix.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_rows * this->_columns;
+    }
+
+    /// <summary>
+    /// Answer the distance between the begin of two consecutive rows (for
+    /// row-major matrices) or columns (for column-major matrices) in memory.
+    /// </summary>
+    /// <returns>The number of elements between two consecutive rows or
+    /// columns.</returns>
+    inline std::size_t stride(void) const noexcept {
+        return this->_stride;
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="row">The zero-based row index.</param>
+    /// <param name="column">The zero-based column index.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline return_value_type operator ()(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        assert(row < this->rows());
+        assert(column < this->columns());
+        return (Layout == matrix_layout::row_major)
+            ? this->_data[row * this->_stride + column]
+            : this->_data[column * this->_stride + row];
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="index">The flattened index of the matrix element.</param>
+    /// <returns>The element at the specified position.</returns>
+    return_value_type operator [](_In_ const std::size_t index) const noexcept;
+
+private:
+
+    std::size_t _columns;
+    TValue *_data;
+    std::size_t _rows;
+    std::size_t _stride;
+};
+
+
+/// <summary>
+/// Gets a view of the specified column of <paramref name="matrix" /> without
+/// copying it.
+/// </summary>
+/// <remarks>
+/// The view is <see cref="vector_view::contiguous" /> for column-major
+/// matrices. For row-major matrices, the elements are the stride of the
+/// matrix apart.
+/// </remarks>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="matrix">A view of the matrix.</param>
+/// <param name="column">The zero-based index of the column.</param>
+/// <returns>A view of the column.</returns>
+template<class TValue, matrix_layout Layout>
+inline vector_view<TValue> column_view(
+        _In_ const matrix_view<TValue, Layout> matrix,
+        _In_ const std::size_t column) noexcept {
+    assert(column < matrix.columns());
+    return (Layout == matrix_layout::row_major)
+        ? vector_view<TValue>(matrix.data() + column, matrix.rows(),
+            matrix.stride())
+        : vector_view<TValue>(matrix.data() + column * matrix.stride(),
+            matrix.rows());
+}
+
+/// <summary>
+/// Gets a view of the specified column of <paramref name="matrix" /> without
+/// copying it.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="matrix">The matrix. The view is invalidated if the matrix is
+/// destroyed or resized.</param>
+/// <param name="column">The zero-based index of the column.</param>
+/// <returns>A view of the column.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline vector_view<TValue> column_view(
+        _In_ matrix<TValue, Layout, TAllocator>& matrix,
+        _In_ const std::size_t column) noexcept {
+    return column_view(matrix_view<TValue, Layout>(matrix), column);
+}
+
+/// <summary>
+/// Gets a read-only view of the specified column of
+/// <paramref name="matrix" /> without copying it.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="matrix">The matrix. The view is invalidated if the matrix is
+/// destroyed or resized.</param>
+/// <param name="column">The zero-based index of the column.</param>
+/// <returns>A view of the column.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline vector_view<const TValue> column_view(
+        _In_ const matrix<TValue, Layout, TAllocator>& matrix,
+        _In_ const std::size_t column) noexcept {
+    return column_view(matrix_view<const TValue, Layout>(matrix), column);
+}
+
+/// <summary>
+/// Gets a view of the specified row of <paramref name="matrix" /> without
+/// copying it.
+/// </summary>
+/// <remarks>
+/// The view is <see cref="vector_view::contiguous" /> for row-major
+/// matrices. For column-major matrices, the elements are the stride of the
+/// matrix apart.
+/// </remarks>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="matrix">A view of the matrix.</param>
+/// <param name="row">The zero-based index of the row.</param>
+/// <returns>A view of the row.</returns>
+template<class TValue, matrix_layout Layout>
+inline vector_view<TValue> row_view(
+        _In_ const matrix_view<TValue, Layout> matrix,
+        _In_ const std::size_t row) noexcept {
+    assert(row < matrix.rows());
+    return (Layout == matrix_layout::row_major)
+        ? vector_view<TValue>(matrix.data() + row * matrix.stride(),
+            matrix.columns())
+        : vector_view<TValue>(matrix.data() + row, matrix.columns(),
+            matrix.stride());
+}
+
+/// <summary>
+/// Gets a view of the specified row of <paramref name="matrix" /> without
+/// copying it.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="matrix">The matrix. The view is invalidated if the matrix is
+/// destroyed or resized.</param>
+/// <param name="row">The zero-based index of the row.</param>
+/// <returns>A view of the row.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline vector_view<TValue> row_view(
+        _In_ matrix<TValue, Layout, TAllocator>& matrix,
+        _In_ const std::size_t row) noexcept {
+    return row_view(matrix_view<TValue, Layout>(matrix), row);
+}
+
+/// <summary>
+/// Gets a read-only view of the specified row of <paramref name="matrix" />
+/// without copying it.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="matrix">The matrix. The view is invalidated if the matrix is
+/// destroyed or resized.</param>
+/// <param name="row">The zero-based index of the row.</param>
+/// <returns>A view of the row.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline vector_view<const TValue> row_view(
+        _In_ const matrix<TValue, Layout, TAllocator>& matrix,
+        _In_ const std::size_t row) noexcept {
+    return row_view(matrix_view<const TValue, Layout>(matrix), row);
+}
+
+LHS_NAMESPACE_END
+
+#include "visus/lhs/matrix_view.inl"
+
+#endif /* !defined(_LHS_MATRIX_VIEW_H) */
@@ -0,0 +1,51 @@
+﻿// <copyright file="matrix_view.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::matrix_view<TValue, Layout>::matrix_view
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+LHS_NAMESPACE::matrix_view<TValue, Layout>::matrix_view(
+        _In_ TValue *data,
+        _In_ const std::size_t rows,
+        _In_ const std::size_t columns,
+        _In_ const std::size_t stride)
+    : _columns(columns), _data(data), _rows(rows), _stride(stride) {
+    const auto minor = (Layout == matrix_layout::row_major) ? columns : rows;
+
+    if (this->_stride == 0) {
+        this->_stride = minor;
+    }
+
+    if ((this->_data == nullptr) && (rows * columns > 0)) {
+        throw std::invalid_argument("The memory of a non-empty matrix view "
+            "must not be nullptr.");
+    }
+
+    if (this->_stride < minor) {
+        throw std::invalid_argument("The stride of a matrix view must not be "
+            "less than the number of elements in a row (row-major) or in a "
+            "column (column-major).");
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::matrix_view<TValue, Layout>::operator []
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+typename LHS_NAMESPACE::matrix_view<TValue, Layout>::return_value_type
+LHS_NAMESPACE::matrix_view<TValue, Layout>::operator [](
+        _In_ const std::size_t index) const noexcept {
+    assert(index < this->size());
+    const auto minor = (Layout == matrix_layout::row_major)
+        ? this->_columns
+        : this->_rows;
+    return (minor == this->_stride)
+        ? this->_data[index]
+        : this->_data[(index / minor) * this->_stride + (index % minor)];
+}
@@ -1,208 +1,373 @@
-﻿// <copyright file="maximin.h" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
-// Licensed under the MIT licence. See LICENCE file for details.
-// </copyright>
-// <author>Christoph Müller</author>
-
-#if !defined(_LHS_MAXIMIN_H)
-#define _LHS_MAXIMIN_H
-#pragma once
-
-#include <algorithm>
-#include <array>
-#include <iterator>
-#include <numeric>
-#include <random>
-#include <stdexcept>
-#include <type_traits>
-
-#include "visus/lhs/distance.h"
-#include "visus/lhs/matrix.h"
-#include "visus/lhs/order.h"
-#include "visus/lhs/valid.h"
-
-
-LHS_NAMESPACE_BEGIN
-
-/// <summary>
-/// Optimises an exisiting Latin Hypercube sample by maximising the minimum
-/// distance between the rows (samples).
-/// </summary>
-/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
-/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
-/// to use row-major matrices here, because in this case, the parameter values
-/// for a sample are laid out contiguously in memory.</typeparam>
-/// <param name="lhs">The sample to be optimised in place.</param>
-/// <param name="epsilon">The minimum improvement that needs to be achieved in
-/// each iteration in order to continue.</param>
-/// <param name="iterations">The maximum number of iterations.</param>
-/// <returns><paramref name="lhs" />.</returns>
-template<class TValue, matrix_layout Layout>
-std::enable_if_t<std::is_arithmetic_v<TValue>, matrix<TValue, Layout>&>
-maximin(_Inout_ matrix<TValue, Layout>& lhs,
-    _In_ const TValue epsilon = static_cast<TValue>(0.05),
-    _In_ const std::size_t iterations = 128);
-
-/// <summary>
-/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
-/// </summary>
-/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
-/// to use row-major matrices here, because in this case, the parameter values
-/// for a sample are laid out contiguously in memory.</typeparam>
-/// <typeparam name="TRng">The type of the random number generator.</typeparam>
-/// <typeparam name="TDist">The type of the distribution used to generate random
-/// numbers.</typeparam>
-/// <param name="result">The matrix to receive the Latin Hypercube sample. The
-/// values are ignored on entry. However, the number of rows represents the
-/// number of samples for each parameter whereas the number of columns
-/// represents the number of parameters.</param>
-/// <param name="duplication">The duplication factor which affects the number of
-/// points that the optimisation algorithm has to choose from.</param>
-/// <param name="rng">The maximin number generator used to sample the given
-/// <paramref name="distribution" />.</param>
-/// <param name="distribution">The distribution to draw samples from, which
-/// typically is a uniform real distribution creating numbers within [0, 1].
-/// </param>
-/// <returns><paramref name="result" />.</returns>
-template<matrix_layout Layout, class TRng, class TDist>
-matrix<std::size_t, Layout> maximin(
-    _Inout_ matrix<std::size_t, Layout>& result,
-    _In_ const std::size_t duplication,
-    _In_ TRng& rng,
-    _In_ TDist& distribution);
-
-/// <summary>
-/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
-/// </summary>
-/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
-/// to use row-major matrices here, because in this case, the parameter values
-/// for a sample are laid out contiguously in memory.</typeparam>
-/// <typeparam name="TRng">The type of the random number generator.</typeparam>
-/// <param name="result">The matrix to receive the Latin Hypercube sample. The
-/// values are ignored on entry. However, the number of rows represents the
-/// number of samples for each parameter whereas the number of columns
-/// represents the number of parameters.</param>
-/// <param name="duplication">The duplication factor which affects the number of
-/// points that the optimisation algorithm has to choose from.</param>
-/// <param name="rng">The maximin number generator used to sample a uniform
-/// real distribution within [0, 1].</param>
-/// <returns><paramref name="result" />.</returns>
-template<matrix_layout Layout, class TRng>
-inline matrix<std::size_t, Layout> maximin(
-        _Inout_ matrix<std::size_t, Layout>& result,
-        _In_ const std::size_t duplication,
-        _In_ TRng& rng) {
-    return maximin(result, duplication, rng,
-        std::uniform_real_distribution<float>());
-}
-
-/// <summary>
-/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
-/// </summary>
-/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
-/// to use row-major matrices here, because in this case, the parameter values
-/// for a sample are laid out contiguously in memory.</typeparam>
-/// <param name="result">The matrix to receive the Latin Hypercube sample. The
-/// values are ignored on entry. However, the number of rows represents the
-/// number of samples for each parameter whereas the number of columns
-/// represents the number of parameters.</param>
-/// <param name="duplication">The duplication factor which affects the number of
-/// points that the optimisation algorithm has to choose from.</param>
-/// <returns><paramref name="result" />.</returns>
-template<matrix_layout Layout, class TRng>
-inline matrix<std::size_t, Layout> maximin(
-        _Inout_ matrix<std::size_t, Layout>& result,
-        _In_ const std::size_t duplication) {
-    std::random_device rd;
-    std::mt19937 rng(rd());
-    return maximin(result, duplication, rng);
-}
-
-/// <summary>
-/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
-/// </summary>
-/// <typeparam name="TRng">The type of the random number generator.</typeparam>
-/// <typeparam name="TDist">The type of the distribution used to generate random
-/// numbers.</typeparam>
-/// <param name="samples">The number of samples per parameter (rows) of the
-/// Latin hypercube sample.</param>
-/// <param name="parameters">The number of parameters (columns) in the
-/// Latin hypercube sample.</param>
-/// <param name="duplication">The duplication factor which affects the number of
-/// points that the optimisation algorithm has to choose from.</param>
-/// <param name="rng">The maximin number generator used to sample the given
-/// <paramref name="distribution" />.</param>
-/// <param name="distribution">The distribution to draw samples from, which
-/// typically is a uniform real distribution creating numbers within [0, 1].
-/// </param>
-/// <returns>The hypercube sample.</returns>
-template<class TRng, class TDist>
-inline matrix<std::size_t> maximin(_In_ const std::size_t samples,
-        _In_ const std::size_t parameters,
-        _In_ const std::size_t duplication,
-        _In_ TRng& rng,
-        _In_ TDist& distribution) {
-    matrix<std::size_t> result(samples, parameters);
-    return maximin(result, duplication, rng, distribution);
-}
-
-/// <summary>
-/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
-/// </summary>
-/// <typeparam name="TRng">The type of the random number generator.</typeparam>
-/// <param name="samples">The number of samples per parameter (rows) of the
-/// Latin hypercube sample.</param>
-/// <param name="parameters">The number of parameters (columns) in the
-/// Latin hypercube sample.</param>
-/// <param name="duplication">The duplication factor which affects the number of
-/// points that the optimisation algorithm has to choose from.</param>
-/// <param name="rng">The maximin number generator used to sample a uniform
-/// real distribution within [0, 1].</param>
-/// <returns>The hypercube sample.</returns>
-template<class TRng>
-inline matrix<std::size_t> maximin(_In_ const std::size_t samples,
-        _In_ const std::size_t parameters,
-        _In_ const std::size_t duplication,
-        _In_ TRng& rng) {
-    matrix<std::size_t> result(samples, parameters);
-    return maximin(result, duplication, rng,
-        std::uniform_real_distribution<float>());
-}
-
-/// <summary>
-/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
-/// </summary>
-/// <param name="samples">The number of samples per parameter (rows) of the
-/// Latin hypercube sample.</param>
-/// <param name="parameters">The number of parameters (columns) in the
-/// Latin hypercube sample.</param>
-/// <param name="duplication">The duplication factor which affects the number of
-/// points that the optimisation algorithm has to choose from.</param>
-/// <returns>The hypercube sample.</returns>
-inline matrix<std::size_t> maximin(_In_ const std::size_t samples,
-        _In_ const std::size_t parameters,
-        _In_ const std::size_t duplication) {
-    std::random_device rd;
-    std::mt19937 rng(rd());
-    return maximin(samples, parameters, duplication, rng);
-}
-
-LHS_NAMESPACE_END
-
-LHS_DETAIL_NAMESPACE_BEGIN
-
-/// <summary>
-/// Initialises the availability matrix for constructing a maximin LHS sample.
-/// </summary>
-/// <typeparam name="Layout"></typeparam>
-/// <param name="mat"></param>
-/// <returns></returns>
-template<matrix_layout Layout>
-matrix<std::size_t, Layout>& initialise_availability(
-    _Inout_ matrix<std::size_t, Layout>& mat);
-
-LHS_DETAIL_NAMESPACE_END
-
-#include "visus/lhs/maximin.inl"
-
-#endif /* !defined(_LHS_MAXIMIN_H) */
+﻿// <copyright file="maximin.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_MAXIMIN_H)
+#define _LHS_MAXIMIN_H
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <type_traits>
+
+#include "visus/lhs/distance.h"
+#include "visus/lhs/index_type.h"
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/order.h"
+#include "visus/lhs/static_matrix.h"
+#include "visus/lhs/valid.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Optimises an exisiting Latin Hypercube sample in external memory by
+/// maximising the minimum distance between the rows (samples).
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <param name="lhs">A view of the sample to be optimised in place.</param>
+/// <param name="epsilon">The minimum improvement that needs to be achieved in
+/// each iteration in order to continue.</param>
+/// <param name="iterations">The maximum number of iterations.</param>
+/// <returns><paramref name="lhs" />.</returns>
+template<class TValue, matrix_layout Layout>
+std::enable_if_t<std::is_arithmetic_v<TValue>, matrix_view<TValue, Layout>>
+maximin(_In_ const matrix_view<TValue, Layout> lhs,
+    _In_ const TValue epsilon = static_cast<TValue>(0.05),
+    _In_ const std::size_t iterations = 128);
+
+/// <summary>
+/// Optimises an exisiting Latin Hypercube sample by maximising the minimum
+/// distance between the rows (samples).
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="lhs">The sample to be optimised in place.</param>
+/// <param name="epsilon">The minimum improvement that needs to be achieved in
+/// each iteration in order to continue.</param>
+/// <param name="iterations">The maximum number of iterations.</param>
+/// <returns><paramref name="lhs" />.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline std::enable_if_t<std::is_arithmetic_v<TValue>,
+    matrix<TValue, Layout, TAllocator>&>
+maximin(_Inout_ matrix<TValue, Layout, TAllocator>& lhs,
+        _In_ const TValue epsilon = static_cast<TValue>(0.05),
+        _In_ const std::size_t iterations = 128) {
+    maximin(matrix_view<TValue, Layout>(lhs), epsilon, iterations);
+    return lhs;
+}
+
+/// <summary>
+/// Optimises an exisiting fixed-size Latin Hypercube sample by maximising the
+/// minimum distance between the rows (samples).
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="lhs">The sample to be optimised in place.</param>
+/// <param name="epsilon">The minimum improvement that needs to be achieved in
+/// each iteration in order to continue.</param>
+/// <param name="iterations">The maximum number of iterations.</param>
+/// <returns><paramref name="lhs" />.</returns>
+template<class TValue,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout>
+inline std::enable_if_t<std::is_arithmetic_v<TValue>,
+    static_matrix<TValue, Rows, Columns, Layout>&>
+maximin(_Inout_ static_matrix<TValue, Rows, Columns, Layout>& lhs,
+        _In_ const TValue epsilon = static_cast<TValue>(0.05),
+        _In_ const std::size_t iterations = 128) {
+    maximin(matrix_view<TValue, Layout>(lhs), epsilon, iterations);
+    return lhs;
+}
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices
+/// in external memory.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="result">The view of the memory to receive the Latin Hypercube
+/// sample. The values are ignored on entry. However, the number of rows
+/// represents the number of samples for each parameter whereas the number of
+/// columns represents the number of parameters.</param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <param name="rng">The maximin number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns><paramref name="result" />.</returns>
+/// <exception cref="std::invalid_argument">If the number of samples exceeds the
+/// range of <typeparamref name="TIndex" />.</exception>
+template<class TIndex, matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<detail::is_index_v<TIndex>, matrix_view<TIndex, Layout>>
+maximin(_In_ const matrix_view<TIndex, Layout> result,
+    _In_ const std::size_t duplication,
+    _In_ TRng& rng,
+    _In_ TDist& distribution);
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample. The
+/// values are ignored on entry. However, the number of rows represents the
+/// number of samples for each parameter whereas the number of columns
+/// represents the number of parameters.</param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <param name="rng">The maximin number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIndex,
+    matrix_layout Layout,
+    class TAllocator,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    matrix<TIndex, Layout, TAllocator>>
+maximin(_Inout_ matrix<TIndex, Layout, TAllocator>& result,
+        _In_ const std::size_t duplication,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    maximin(matrix_view<TIndex, Layout>(result), duplication, rng,
+        distribution);
+    return result;
+}
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices
+/// in a fixed-size matrix.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample.
+/// </param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <param name="rng">The maximin number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIndex,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    static_matrix<TIndex, Rows, Columns, Layout>&>
+maximin(_Inout_ static_matrix<TIndex, Rows, Columns, Layout>& result,
+        _In_ const std::size_t duplication,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    maximin(matrix_view<TIndex, Layout>(result), duplication, rng,
+        distribution);
+    return result;
+}
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample. The
+/// values are ignored on entry. However, the number of rows represents the
+/// number of samples for each parameter whereas the number of columns
+/// represents the number of parameters.</param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <param name="rng">The maximin number generator used to sample a uniform
+/// real distribution within [0, 1].</param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIndex, matrix_layout Layout, class TAllocator, class TRng>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    matrix<TIndex, Layout, TAllocator>>
+maximin(_Inout_ matrix<TIndex, Layout, TAllocator>& result,
+        _In_ const std::size_t duplication,
+        _In_ TRng& rng) {
+    return maximin(result, duplication, rng,
+        std::uniform_real_distribution<float>());
+}
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample. The
+/// values are ignored on entry. However, the number of rows represents the
+/// number of samples for each parameter whereas the number of columns
+/// represents the number of parameters.</param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIndex, matrix_layout Layout, class TAllocator, class TRng>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    matrix<TIndex, Layout, TAllocator>>
+maximin(_Inout_ matrix<TIndex, Layout, TAllocator>& result,
+        _In_ const std::size_t duplication) {
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return maximin(result, duplication, rng);
+}
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// This parameter defaults to <c>std::size_t</c>.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="samples">The number of samples per parameter (rows) of the
+/// Latin hypercube sample.</param>
+/// <param name="parameters">The number of parameters (columns) in the
+/// Latin hypercube sample.</param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <param name="rng">The maximin number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns>The hypercube sample.</returns>
+template<class TIndex = std::size_t, class TRng, class TDist>
+inline std::enable_if_t<detail::is_index_v<TIndex>, matrix<TIndex>> maximin(
+        _In_ const std::size_t samples,
+        _In_ const std::size_t parameters,
+        _In_ const std::size_t duplication,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    matrix<TIndex> result(samples, parameters);
+    return maximin(result, duplication, rng, distribution);
+}
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// This parameter defaults to <c>std::size_t</c>.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <param name="samples">The number of samples per parameter (rows) of the
+/// Latin hypercube sample.</param>
+/// <param name="parameters">The number of parameters (columns) in the
+/// Latin hypercube sample.</param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <param name="rng">The maximin number generator used to sample a uniform
+/// real distribution within [0, 1].</param>
+/// <returns>The hypercube sample.</returns>
+template<class TIndex = std::size_t, class TRng>
+inline std::enable_if_t<detail::is_index_v<TIndex>, matrix<TIndex>> maximin(
+        _In_ const std::size_t samples,
+        _In_ const std::size_t parameters,
+        _In_ const std::size_t duplication,
+        _In_ TRng& rng) {
+    matrix<TIndex> result(samples, parameters);
+    return maximin(result, duplication, rng,
+        std::uniform_real_distribution<float>());
+}
+
+/// <summary>
+/// Creates a maximin-optimised Latin Hypercube sample of zero-based indices.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// This parameter defaults to <c>std::size_t</c>.</typeparam>
+/// <param name="samples">The number of samples per parameter (rows) of the
+/// Latin hypercube sample.</param>
+/// <param name="parameters">The number of parameters (columns) in the
+/// Latin hypercube sample.</param>
+/// <param name="duplication">The duplication factor which affects the number of
+/// points that the optimisation algorithm has to choose from.</param>
+/// <returns>The hypercube sample.</returns>
+template<class TIndex = std::size_t>
+inline std::enable_if_t<detail::is_index_v<TIndex>, matrix<TIndex>> maximin(
+        _In_ const std::size_t samples,
+        _In_ const std::size_t parameters,
+        _In_ const std::size_t duplication) {
+    std::random_device rd;
+    std::mt19937 rng(rd());
+    return maximin<TIndex>(samples, parameters, duplication, rng);
+}
+
+LHS_NAMESPACE_END
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Initialises the availability matrix for constructing a maximin LHS sample.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices.</typeparam>
+/// <typeparam name="Layout"></typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="mat"></param>
+/// <returns></returns>
+template<class TIndex, matrix_layout Layout, class TAllocator>
+matrix<TIndex, Layout, TAllocator>& initialise_availability(
+    _Inout_ matrix<TIndex, Layout, TAllocator>& mat);
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/maximin.inl"
+
+#endif /* !defined(_LHS_MAXIMIN_H) */
@@ -10,19 +10,20 @@
  */
 template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
 std::enable_if_t<std::is_arithmetic_v<TValue>,
-    LHS_NAMESPACE::matrix<TValue, Layout>&>
-LHS_NAMESPACE::maximin(_Inout_ matrix<TValue, Layout>& lhs,
+    LHS_NAMESPACE::matrix_view<TValue, Layout>>
+LHS_NAMESPACE::maximin(_In_ const matrix_view<TValue, Layout> lhs,
         _In_ const TValue epsilon,
         _In_ const std::size_t iterations) {
     // Based on https://github.com/bertcarnell/lhs/blob/4be72495c0eba3ce0b1ae602122871ec83421db6/R/maximinLHS.R#L109-L176
     static constexpr auto one = static_cast<TValue>(1);
     const auto n = lhs.rows();
     const auto k = lhs.columns();
+    const matrix_view<const TValue, Layout> view(lhs);
     std::vector<TValue> distances;
 
     // Find the reference minimum distance between two samples in the current
     // 'lhs', which we want to maximise in the subsequent iterations.
-    detail::square_row_distances(distances, lhs);
+    detail::square_row_distances(distances, view);
     auto reference = *std::min_element(distances.begin(), distances.end());
 
     for (std::size_t i = 0; i < iterations; ++i) {
@@ -36,7 +37,7 @@ LHS_NAMESPACE::maximin(_Inout_ matrix<TValue, Layout>& lhs,
                 for (std::size_t s = r + 1; s < n; ++s) {
                     std::swap(lhs(r, c), lhs(s, c));
 
-                    detail::square_row_distances(distances, lhs);
+                    detail::square_row_distances(distances, view);
                     auto m = *std::min_element(
                         distances.begin(),
                         distances.end());
@@ -78,9 +79,11 @@ LHS_NAMESPACE::maximin(_Inout_ matrix<TValue, Layout>& lhs,
 /*
  * LHS_NAMESPACE::maximin
  */
-template<LHS_NAMESPACE::matrix_layout Layout, class TRng, class TDist>
-LHS_NAMESPACE::matrix<std::size_t, Layout> LHS_NAMESPACE::maximin(
-        _Inout_ matrix<std::size_t, Layout>& result,
+template<class TIndex, LHS_NAMESPACE::matrix_layout Layout, class TRng,
+    class TDist>
+std::enable_if_t<LHS_DETAIL_NAMESPACE::is_index_v<TIndex>,
+    LHS_NAMESPACE::matrix_view<TIndex, Layout>>
+LHS_NAMESPACE::maximin(_In_ const matrix_view<TIndex, Layout> result,
         _In_ const std::size_t duplication,
         _In_ TRng& rng,
         _In_ TDist& distribution) {
@@ -99,14 +102,15 @@ LHS_NAMESPACE::matrix<std::size_t, Layout> LHS_NAMESPACE::maximin(
     // Cache the number of samples 'n' and parameters 'k'.
     const auto n = result.rows();
     const auto k = result.columns();
+    detail::check_index<TIndex>(n);
 
     // Length of candidate points.
     assert(n > 0);
     const auto len = duplication * ((std::max)(n, one) - one);
 
-    matrix<std::size_t, Layout> avail(n, k);
-    matrix<std::size_t, Layout> point1(len, k);
-    std::vector<std::size_t> list1(len);
+    matrix<TIndex, Layout> avail(n, k);
+    matrix<TIndex, Layout> point1(len, k);
+    std::vector<TIndex> list1(len);
 
     // Initialise the availability matrix.
     detail::initialise_availability(avail);
@@ -114,11 +118,11 @@ LHS_NAMESPACE::matrix<std::size_t, Layout> LHS_NAMESPACE::maximin(
     for (std::size_t c = 0; c < k; ++c) {
         // Come up with a random sample in the last row of the 'result'.
         const auto r = random_index(n);
-        result(n - 1, c) = r;
+        result(n - 1, c) = static_cast<TIndex>(r);
 
         // Use the random order we just created to place an the index of the
         // last sample value randomly through the 'avail' matrix.
-        avail(r, c) = n - 1;
+        avail(r, c) = static_cast<TIndex>(n - 1);
     }
 
     // Move backwards through the samples in 'result' and fill them.
@@ -149,8 +153,13 @@ LHS_NAMESPACE::matrix<std::size_t, Layout> LHS_NAMESPACE::maximin(
             for (std::size_t i = s; i < n; ++i) {
                 auto d = zero;
 
+                // Note: the indices are widened before subtracting them, because
+                // the wrap-around of the unsigned difference only cancels out
+                // in the square if there are enough bits to hold the square.
                 for (std::size_t j = 0; j < k; ++j) {
-                    d += square(point1(r, j) - result(i, j));
+                    const auto p = static_cast<std::size_t>(point1(r, j));
+                    const auto q = static_cast<std::size_t>(result(i, j));
+                    d += detail::square(p - q);
                 }
 
                 if (d < dist) {
@@ -193,11 +202,11 @@ LHS_NAMESPACE::matrix<std::size_t, Layout> LHS_NAMESPACE::maximin(
 /*
  * LHS_DETAIL_NAMESPACE::initialise_availability
  */
-template<LHS_NAMESPACE::matrix_layout Layout>
-LHS_NAMESPACE::matrix<std::size_t, Layout>&
+template<class TIndex, LHS_NAMESPACE::matrix_layout Layout, class TAllocator>
+LHS_NAMESPACE::matrix<TIndex, Layout, TAllocator>&
 LHS_DETAIL_NAMESPACE::initialise_availability(
-        _Inout_ matrix<std::size_t, Layout>& mat) {
-    static constexpr auto zero = static_cast<std::size_t>(0);
+        _Inout_ matrix<TIndex, Layout, TAllocator>& mat) {
+    static constexpr auto zero = static_cast<TIndex>(0);
 
     for (std::size_t c = 0, e = mat.columns(); c < e; ++c) {
         std::iota(mat.begin_column(c), mat.end_column(c), zero);
@@ -0,0 +1,232 @@
+﻿// <copyright file="npy.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_NPY_H)
+#define _LHS_NPY_H
+#pragma once
+
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "visus/lhs/aligned_allocator.h"
+#include "visus/lhs/mapped_file.h"
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Writes <paramref name="lhs" /> into a NumPy <c>.npy</c> file.
+/// </summary>
+/// <remarks>
+/// <para>The file uses version 1.0 of the format. Row-major matrices are
+/// stored with <c>fortran_order</c> being <c>False</c>, column-major ones
+/// with <c>fortran_order</c> being <c>True</c>, such that the elements can be
+/// written in the order they are in memory. If the matrix is not padded,
+/// the elements are written with a single write.</para>
+/// <para>The elements are stored in the byte order of the machine, which is
+/// recorded in the header of the file.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements, which must be an
+/// integral or a floating-point type with a size of up to eight bytes.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="path">The path to the file to be written. An existing file
+/// will be overwritten.</param>
+/// <param name="lhs">The matrix to be written.</param>
+/// <exception cref="std::ios_base::failure">If the file could not be
+/// written.</exception>
+template<class TValue, matrix_layout Layout>
+void save_npy(_In_ const std::filesystem::path& path,
+    _In_ const matrix_view<TValue, Layout> lhs);
+
+/// <summary>
+/// Writes <paramref name="lhs" /> into a NumPy <c>.npy</c> file.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements, which must be an
+/// integral or a floating-point type with a size of up to eight bytes.
+/// </typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="path">The path to the file to be written. An existing file
+/// will be overwritten.</param>
+/// <param name="lhs">The matrix to be written.</param>
+/// <exception cref="std::ios_base::failure">If the file could not be
+/// written.</exception>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline void save_npy(_In_ const std::filesystem::path& path,
+        _In_ const matrix<TValue, Layout, TAllocator>& lhs) {
+    save_npy(path, matrix_view<const TValue, Layout>(lhs));
+}
+
+
+/// <summary>
+/// Provides zero-copy, read-only access to a two-dimensional array stored
+/// in a NumPy <c>.npy</c> file.
+/// </summary>
+/// <remarks>
+/// <para>The file is mapped into memory rather than being read. The view of
+/// the array remains valid as long as the instance exists.</para>
+/// <para>One-dimensional arrays are interpreted as a matrix with a single
+/// column.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements, which must match the
+/// <c>descr</c> of the array including the byte order.</typeparam>
+/// <typeparam name="Layout">The layout of the matrix, which must match the
+/// <c>fortran_order</c> of the array.</typeparam>
+template<class TValue, matrix_layout Layout = matrix_layout::row_major>
+class mapped_npy final {
+
+public:
+
+    /// <summary>
+    /// The type of the elements of the array.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// The type of the view of the array.
+    /// </summary>
+    typedef matrix_view<const TValue, Layout> view_type;
+
+    /// <summary>
+    /// Maps the <c>.npy</c> file at <paramref name="path" />.
+    /// </summary>
+    /// <param name="path">The path to the file.</param>
+    /// <exception cref="std::system_error">If the file could not be mapped.
+    /// </exception>
+    /// <exception cref="std::invalid_argument">If the file is not a valid
+    /// <c>.npy</c> file, if it does not hold a one- or two-dimensional array
+    /// or if the type or the order of the elements does not match
+    /// <typeparamref name="TValue" /> and <typeparamref name="Layout" />.
+    /// </exception>
+    explicit mapped_npy(_In_ const std::filesystem::path& path);
+
+    /// <summary>
+    /// Answer the number of columns of the array.
+    /// </summary>
+    /// <returns>The number of columns.</returns>
+    inline std::size_t columns(void) const noexcept {
+        return this->_view.columns();
+    }
+
+    /// <summary>
+    /// Answer the number of rows of the array.
+    /// </summary>
+    /// <returns>The number of rows.</returns>
+    inline std::size_t rows(void) const noexcept {
+        return this->_view.rows();
+    }
+
+    /// <summary>
+    /// Answer a view of the mapped array.
+    /// </summary>
+    /// <returns>A read-only view of the array, which is valid as long as the
+    /// instance exists.</returns>
+    inline view_type view(void) const noexcept {
+        return this->_view;
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="row">The zero-based row of the element.</param>
+    /// <param name="column">The zero-based column of the element.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline const value_type& operator ()(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        return this->_view(row, column);
+    }
+
+private:
+
+    mapped_file _file;
+    view_type _view;
+};
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The alignment of the array data in a <c>.npy</c> file in bytes, which is
+/// the alignment used by NumPy itself.
+/// </summary>
+constexpr const std::size_t npy_alignment = 64;
+
+/// <summary>
+/// Answer the magic string at the begin of a <c>.npy</c> file.
+/// </summary>
+/// <returns>The magic string, which is six characters long.</returns>
+inline constexpr std::string_view npy_magic(void) noexcept {
+    return std::string_view("\x93NUMPY", 6);
+}
+
+/// <summary>
+/// Answer whether the machine stores integers in little-endian byte order.
+/// </summary>
+/// <returns><c>true</c> for little-endian machines, <c>false</c> otherwise.
+/// </returns>
+inline bool is_little_endian(void) noexcept {
+    const std::uint16_t value = 1;
+    unsigned char first = 0;
+    std::memcpy(&first, &value, 1);
+    return (first == 1);
+}
+
+/// <summary>
+/// Answer the NumPy type descriptor of <typeparamref name="TValue" /> in the
+/// byte order of the machine.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements.</typeparam>
+/// <returns>The type descriptor, for instance <c>&lt;f8</c>.</returns>
+template<class TValue> std::string npy_descr(void);
+
+/// <summary>
+/// Creates the header of a <c>.npy</c> file including the magic string, the
+/// version and the padding.
+/// </summary>
+/// <param name="descr">The type descriptor of the array.</param>
+/// <param name="fortran_order">Whether the array is stored in column-major
+/// order.</param>
+/// <param name="rows">The number of rows of the array.</param>
+/// <param name="columns">The number of columns of the array.</param>
+/// <returns>The header, which is padded to a multiple of
+/// <see cref="npy_alignment" /> bytes.</returns>
+inline std::string npy_header(_In_ const std::string& descr,
+    _In_ const bool fortran_order,
+    _In_ const std::size_t rows,
+    _In_ const std::size_t columns);
+
+/// <summary>
+/// Finds the value of <paramref name="key" /> in the header dictionary of
+/// a <c>.npy</c> file.
+/// </summary>
+/// <param name="header">The header dictionary.</param>
+/// <param name="key">The name of the key without quotes.</param>
+/// <returns>The text after the colon following the key, with leading white
+/// space removed.</returns>
+/// <exception cref="std::invalid_argument">If the key was not found.
+/// </exception>
+inline std::string_view npy_value(_In_ const std::string_view header,
+    _In_ const std::string_view key);
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/npy.inl"
+
+#endif /* !defined(_LHS_NPY_H) */
@@ -0,0 +1,255 @@
+﻿// <copyright file="npy.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::save_npy
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+void LHS_NAMESPACE::save_npy(_In_ const std::filesystem::path& path,
+        _In_ const matrix_view<TValue, Layout> lhs) {
+    typedef std::remove_cv_t<TValue> value_type;
+    const auto header = detail::npy_header(detail::npy_descr<value_type>(),
+        lhs.column_major(), lhs.rows(), lhs.columns());
+
+    std::ofstream stream;
+    stream.exceptions(std::ios::badbit | std::ios::failbit);
+    stream.open(path, std::ios::binary | std::ios::trunc);
+    stream.write(header.data(), header.size());
+
+    const auto lines = lhs.row_major() ? lhs.rows() : lhs.columns();
+    const auto length = lhs.row_major() ? lhs.columns() : lhs.rows();
+
+    if (lhs.stride() == length) {
+        stream.write(reinterpret_cast<const char *>(lhs.data()),
+            lhs.size() * sizeof(value_type));
+
+    } else {
+        for (std::size_t l = 0; l < lines; ++l) {
+            stream.write(
+                reinterpret_cast<const char *>(lhs.data() + l * lhs.stride()),
+                length * sizeof(value_type));
+        }
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::mapped_npy<TValue, Layout>::mapped_npy
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+LHS_NAMESPACE::mapped_npy<TValue, Layout>::mapped_npy(
+        _In_ const std::filesystem::path& path) : _file(path) {
+    const auto data = static_cast<const char *>(this->_file.data());
+    const auto size = this->_file.size();
+    const auto magic = detail::npy_magic();
+
+    if ((size < magic.size() + 4)
+            || (std::string_view(data, magic.size()) != magic)) {
+        throw std::invalid_argument("The file is not a .npy file.");
+    }
+
+    // Version 1.0 uses a 16-bit length, versions 2.0 and 3.0 a 32-bit one,
+    // both in little-endian byte order.
+    const auto major = static_cast<unsigned char>(data[magic.size()]);
+    const auto bytes = (major == 1) ? 2 : 4;
+    if ((major < 1) || (major > 3) || (size < magic.size() + 2 + bytes)) {
+        throw std::invalid_argument("The version of the .npy file is not "
+            "supported.");
+    }
+
+    std::size_t length = 0;
+    for (int i = bytes - 1; i >= 0; --i) {
+        length <<= 8;
+        length |= static_cast<unsigned char>(data[magic.size() + 2 + i]);
+    }
+
+    const auto offset = magic.size() + 2 + bytes;
+    if (length > size - offset) {
+        throw std::invalid_argument("The header of the .npy file is "
+            "truncated.");
+    }
+
+    const std::string_view header(data + offset, length);
+
+    {
+        const auto value = detail::npy_value(header, "descr");
+        const auto descr = detail::npy_descr<TValue>();
+        if ((value.size() < descr.size() + 2)
+                || (value.substr(1, descr.size()) != descr)
+                || (value[descr.size() + 1] != value[0])) {
+            throw std::invalid_argument("The type of the elements in the .npy "
+                "file does not match the requested type.");
+        }
+    }
+
+    {
+        const auto value = detail::npy_value(header, "fortran_order");
+        const auto fortran_order = (value.substr(0, 4) == "True");
+        if (!fortran_order && (value.substr(0, 5) != "False")) {
+            throw std::invalid_argument("The fortran_order of the .npy file "
+                "is invalid.");
+        }
+        if (fortran_order != (Layout == matrix_layout::column_major)) {
+            throw std::invalid_argument("The order of the elements in the "
+                ".npy file does not match the requested layout.");
+        }
+    }
+
+    std::size_t shape[2] = { 0, 1 };
+    {
+        auto value = detail::npy_value(header, "shape");
+        if (value.empty() || (value.front() != '(')) {
+            throw std::invalid_argument("The shape of the .npy file is "
+                "invalid.");
+        }
+        value.remove_prefix(1);
+
+        std::size_t dimensions = 0;
+        while (!value.empty() && (value.front() != ')')) {
+            if ((value.front() == ',') || (value.front() == ' ')) {
+                value.remove_prefix(1);
+                continue;
+            }
+
+            if (dimensions >= 2) {
+                throw std::invalid_argument("The .npy file does not hold a "
+                    "one- or two-dimensional array.");
+            }
+
+            std::size_t extent = 0;
+            const auto result = std::from_chars(value.data(),
+                value.data() + value.size(), extent);
+            if (result.ec != std::errc()) {
+                throw std::invalid_argument("The shape of the .npy file is "
+                    "invalid.");
+            }
+
+            shape[dimensions++] = extent;
+            value.remove_prefix(result.ptr - value.data());
+        }
+
+        if (value.empty() || (dimensions == 0)) {
+            throw std::invalid_argument("The .npy file does not hold a one- "
+                "or two-dimensional array.");
+        }
+    }
+
+    const auto payload = offset + length;
+    const auto max_elements = (size - payload) / sizeof(TValue);
+    if ((shape[1] != 0) && (shape[0] > max_elements / shape[1])) {
+        throw std::invalid_argument("The .npy file is truncated.");
+    }
+    if ((payload % alignof(TValue)) != 0) {
+        throw std::invalid_argument("The data in the .npy file are not "
+            "properly aligned.");
+    }
+
+    this->_view = view_type(reinterpret_cast<const TValue *>(data + payload),
+        shape[0], shape[1]);
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::npy_descr
+ */
+template<class TValue> std::string LHS_DETAIL_NAMESPACE::npy_descr(void) {
+    static_assert((std::is_integral_v<TValue>
+        && !std::is_same_v<TValue, bool>
+        && (sizeof(TValue) <= 8))
+        || (std::is_floating_point_v<TValue>
+        && ((sizeof(TValue) == 4) || (sizeof(TValue) == 8))),
+        "The type cannot be stored in a .npy file.");
+    std::string retval;
+
+    if (sizeof(TValue) == 1) {
+        retval.push_back('|');
+    } else {
+        retval.push_back(is_little_endian() ? '<' : '>');
+    }
+
+    if (std::is_floating_point_v<TValue>) {
+        retval.push_back('f');
+    } else if (std::is_signed_v<TValue>) {
+        retval.push_back('i');
+    } else {
+        retval.push_back('u');
+    }
+
+    retval.push_back(static_cast<char>('0' + sizeof(TValue)));
+    return retval;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::npy_header
+ */
+inline std::string LHS_DETAIL_NAMESPACE::npy_header(
+        _In_ const std::string& descr,
+        _In_ const bool fortran_order,
+        _In_ const std::size_t rows,
+        _In_ const std::size_t columns) {
+    const auto magic = npy_magic();
+    std::string dict("{'descr': '");
+    dict += descr;
+    dict += "', 'fortran_order': ";
+    dict += fortran_order ? "True" : "False";
+    dict += ", 'shape': (";
+    dict += std::to_string(rows);
+    dict += ", ";
+    dict += std::to_string(columns);
+    dict += "), }";
+
+    // The dictionary is padded with spaces and terminated by a line break such
+    // that the data start at an aligned offset.
+    const auto prefix = magic.size() + 2 + 2;
+    const auto total = round_up(prefix + dict.size() + 1, npy_alignment);
+    dict.append(total - prefix - dict.size() - 1, ' ');
+    dict.push_back('\n');
+
+    const auto length = static_cast<std::uint16_t>(dict.size());
+    std::string retval(magic);
+    retval.push_back(1);
+    retval.push_back(0);
+    retval.push_back(static_cast<char>(length & 0xff));
+    retval.push_back(static_cast<char>((length >> 8) & 0xff));
+    retval += dict;
+    return retval;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::npy_value
+ */
+inline std::string_view LHS_DETAIL_NAMESPACE::npy_value(
+        _In_ const std::string_view header,
+        _In_ const std::string_view key) {
+    for (const auto quote : { '\'', '"' }) {
+        std::string quoted(1, quote);
+        quoted += key;
+        quoted += quote;
+
+        auto position = header.find(quoted);
+        if (position == header.npos) {
+            continue;
+        }
+
+        position = header.find(':', position + quoted.size());
+        if (position == header.npos) {
+            break;
+        }
+
+        auto retval = header.substr(position + 1);
+        while (!retval.empty() && (retval.front() == ' ')) {
+            retval.remove_prefix(1);
+        }
+
+        return retval;
+    }
+
+    throw std::invalid_argument("The header of the .npy file does not "
+        "contain the required key.");
+}
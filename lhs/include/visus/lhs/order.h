@@ -21,6 +21,57 @@
 
 LHS_DETAIL_NAMESPACE_BEGIN
 
+/// <summary>
+/// Writes the order of the elements in the specified range by the given
+/// <typeparamref name="TLess" /> function to <paramref name="indices" />
+/// without modifying the range itself.
+/// </summary>
+/// <remarks>
+/// In contrast to <see cref="order_by" />, this function does not allocate
+/// any memory, which allows callers to use fixed-size buffers.
+/// </remarks>
+/// <typeparam name="TOutput">A random access iterator over the output range,
+/// which must be able to hold as many indices as there are elements in
+/// [<paramref name="begin" />, <paramref name="end" />[.</typeparam>
+/// <typeparam name="TIterator">An iterator over the item to determine the order
+/// of. The iterator must be a random access iterator.</typeparam>
+/// <typeparam name="TLess">A function that determines whether which of the
+/// iterated items is smaller.</typeparam>
+/// <param name="indices">The begin of the output range.</param>
+/// <param name="begin">An iterator for the begin of the range of items to
+/// determine the order of.</param>
+/// <param name="end">An iterator past the range of items to determine the
+/// order of.</param>
+/// <param name="less">A predicate which determines which of two of the iterated
+/// items is the smaller one.</param>
+template<class TOutput, class TIterator, class TLess>
+void order_into(_In_ const TOutput indices,
+    _In_ const TIterator begin,
+    _In_ const TIterator end,
+    _In_ const TLess& less);
+
+/// <summary>
+/// Writes the order of the elements in the specified range to
+/// <paramref name="indices" /> without modifying the range itself.
+/// </summary>
+/// <typeparam name="TOutput">A random access iterator over the output range,
+/// which must be able to hold as many indices as there are elements in
+/// [<paramref name="begin" />, <paramref name="end" />[.</typeparam>
+/// <typeparam name="TIterator">An iterator over the item to determine the order
+/// of. The iterator must be a random access iterator.</typeparam>
+/// <param name="indices">The begin of the output range.</param>
+/// <param name="begin">An iterator for the begin of the range of items to
+/// determine the order of.</param>
+/// <param name="end">An iterator past the range of items to determine the
+/// order of.</param>
+template<class TOutput, class TIterator>
+inline void order_into(_In_ const TOutput indices,
+        _In_ const TIterator begin,
+        _In_ const TIterator end) {
+    typedef typename std::iterator_traits<TIterator>::value_type value_type;
+    order_into(indices, begin, end, std::less<value_type>());
+}
+
 /// <summary>
 /// Determines the order of the elements in the specified range by the given
 /// <typeparamref name="TLess" /> function without modifying the range itself.
@@ -29,6 +80,8 @@ LHS_DETAIL_NAMESPACE_BEGIN
 /// of. The iterator must be a random access iterator.</typeparam>
 /// <typeparam name="TLess">A function that determines whether which of the
 /// iterated items is smaller.</typeparam>
+/// <typeparam name="TIndex">The type of the indices, which must be able to
+/// represent the size of the range.</typeparam>
 /// <param name="indices">Receives the zero-based indices of the sorted range
 /// [<paramref name="begin" />, <paramref name="end" />[. Callers should not
 /// reserve the array as the function must do this anyways.</param>
@@ -38,8 +91,8 @@ LHS_DETAIL_NAMESPACE_BEGIN
 /// order of.</param>
 /// <param name="less">A predicate which determines which of two of the iterated
 /// items is the smaller one.</param>
-template<class TIterator, class TLess>
-void order_by(_Inout_ std::vector<std::size_t>& indices,
+template<class TIterator, class TLess, class TIndex>
+void order_by(_Inout_ std::vector<TIndex>& indices,
     _In_ const TIterator begin,
     _In_ const TIterator end,
     _In_ const TLess& less);
@@ -79,6 +132,8 @@ inline std::vector<std::size_t> order_by(
 /// </summary>
 /// <typeparam name="TIterator">An iterator over the item to determine the order
 /// of. The iterator must be a random access iterator.</typeparam>
+/// <typeparam name="TIndex">The type of the indices, which must be able to
+/// represent the size of the range.</typeparam>
 /// <param name="indices">Receives the zero-based indices of the sorted range
 /// [<paramref name="begin" />, <paramref name="end" />[. Callers should not
 /// reserve the array as the function must do this anyways.</param>
@@ -86,8 +141,8 @@ inline std::vector<std::size_t> order_by(
 /// determine the order of.</param>
 /// <param name="end">An iterator past the range of items to determine the
 /// order of.</param>
-template<class TIterator>
-inline void order(_Inout_ std::vector<std::size_t>& indices,
+template<class TIterator, class TIndex>
+inline void order(_Inout_ std::vector<TIndex>& indices,
         _In_ const TIterator begin,
         _In_ const TIterator end) {
     typedef typename std::iterator_traits<TIterator>::value_type value_type;
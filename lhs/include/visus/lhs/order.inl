@@ -8,18 +8,37 @@
 /*
  * LHS_DETAIL_NAMESPACE::order_by
  */
-template<class TIterator, class TLess>
+template<class TIterator, class TLess, class TIndex>
 void LHS_DETAIL_NAMESPACE::order_by(
-        _Inout_ std::vector<std::size_t>& indices,
+        _Inout_ std::vector<TIndex>& indices,
         _In_ const TIterator begin,
         _In_ const TIterator end,
         _In_ const TLess& less) {
+    static_assert(std::is_integral_v<TIndex>, "The indices must be integral "
+        "numbers.");
     indices.resize(std::distance(begin, end));
-    std::iota(indices.begin(), indices.end(), static_cast<std::size_t>(0));
+    order_into(indices.begin(), begin, end, less);
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::order_into
+ */
+template<class TOutput, class TIterator, class TLess>
+void LHS_DETAIL_NAMESPACE::order_into(
+        _In_ const TOutput indices,
+        _In_ const TIterator begin,
+        _In_ const TIterator end,
+        _In_ const TLess& less) {
+    typedef typename std::iterator_traits<TOutput>::value_type index_type;
+    static_assert(std::is_integral_v<index_type>, "The indices must be "
+        "integral numbers.");
+    const auto last = indices + std::distance(begin, end);
+    std::iota(indices, last, static_cast<index_type>(0));
 
-    std::sort(indices.begin(),
-        indices.end(),
-        [less, begin](const std::size_t lhs, const std::size_t rhs) {
+    std::sort(indices,
+        last,
+        [less, begin](const index_type lhs, const index_type rhs) {
             return less(*(begin + lhs), *(begin + rhs));
         });
 }
@@ -38,7 +57,7 @@ LHS_DETAIL_NAMESPACE::random_order_by(
         _In_ TLess&& less,
         _In_ TRng& rng,
         _In_ TDist& distribution) {
-    typedef typename TIterator::value_type index_type;
+    typedef typename std::iterator_traits<TIterator>::value_type index_type;
     typedef typename TDist::result_type value_type;
 
     const auto size = std::distance(begin, end);
@@ -51,7 +70,7 @@ LHS_DETAIL_NAMESPACE::random_order_by(
     }
 
     // Determine the order of the samples.
-    std::iota(begin, begin, static_cast<index_type>(0));
+    std::iota(begin, end, static_cast<index_type>(0));
     std::sort(begin,
         end,
         [less, &buffer](const index_type lhs, const index_type rhs) {
@@ -0,0 +1,343 @@
+﻿// <copyright file="packed_matrix.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_PACKED_MATRIX_H)
+#define _LHS_PACKED_MATRIX_H
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "visus/lhs/index_type.h"
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/valid.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// A compact representation of a Latin hypercube sample of stratum indices,
+/// which stores every index in the minimum number of bits required for the
+/// number of samples.
+/// </summary>
+/// <remarks>
+/// <para>A sample with n rows only contains indices within [0, n[, which can
+/// be represented using ceil(log2(n)) bits. The packed matrix stores the
+/// elements in the order given by <typeparamref name="Layout" /> as a
+/// contiguous stream of bits, wherefore an element may span two words of the
+/// storage. A sample of 1000 points, for instance, requires only 10 bits per
+/// element instead of 64 bits in a <c>matrix&lt;std::size_t&gt;</c>.</para>
+/// <para>Random access to single elements is O(1), but considerably more
+/// expensive than for a <see cref="matrix" />. The packed matrix is therefore
+/// intended for archiving and caching samples, which are converted to a
+/// <see cref="matrix" /> using <see cref="unpack" /> or
+/// <see cref="unpack_unit" /> before being used.</para>
+/// </remarks>
+/// <typeparam name="Layout">The order in which the elements are packed.
+/// Unpacking into a matrix of the same layout is the fastest.</typeparam>
+template<matrix_layout Layout = matrix_layout::row_major>
+class packed_matrix final {
+
+public:
+
+    /// <summary>
+    /// The type of the words the bits are stored in.
+    /// </summary>
+    typedef std::uint64_t word_type;
+
+    /// <summary>
+    /// The type of the elements returned by the accessors.
+    /// </summary>
+    typedef std::size_t value_type;
+
+    /// <summary>
+    /// Answer the number of bits required to store the indices of a sample
+    /// with <paramref name="rows" /> rows.
+    /// </summary>
+    /// <param name="rows">The number of samples.</param>
+    /// <returns>The number of bits per element, which is at least one.
+    /// </returns>
+    static constexpr std::size_t bits_for(_In_ const std::size_t rows) noexcept;
+
+    /// <summary>
+    /// Initialises a new, empty instance.
+    /// </summary>
+    inline packed_matrix(void) noexcept : _bits(1), _columns(0), _rows(0) { }
+
+    /// <summary>
+    /// Initialises a new instance with all elements being zero.
+    /// </summary>
+    /// <param name="rows">The number of rows in the matrix, which also
+    /// determines the number of bits per element.</param>
+    /// <param name="columns">The number of columns in the matrix.</param>
+    packed_matrix(_In_ const std::size_t rows,
+        _In_ const std::size_t columns);
+
+    /// <summary>
+    /// Initialises a new instance by packing the given index matrix.
+    /// </summary>
+    /// <typeparam name="TValue">The type of the indices, which must be an
+    /// unsigned integral type.</typeparam>
+    /// <typeparam name="L">The layout of <paramref name="lhs" />.</typeparam>
+    /// <param name="lhs">The sample to be packed.</param>
+    /// <exception cref="std::invalid_argument">If any element of
+    /// <paramref name="lhs" /> is not a valid index of a row.</exception>
+    template<class TValue, matrix_layout L>
+    explicit packed_matrix(_In_ const matrix_view<const TValue, L> lhs);
+
+    /// <summary>
+    /// Initialises a new instance by packing the given index matrix.
+    /// </summary>
+    /// <typeparam name="TValue">The type of the indices, which must be an
+    /// unsigned integral type.</typeparam>
+    /// <typeparam name="L">The layout of <paramref name="lhs" />.</typeparam>
+    /// <typeparam name="A">The allocator of <paramref name="lhs" />.
+    /// </typeparam>
+    /// <param name="lhs">The sample to be packed.</param>
+    /// <exception cref="std::invalid_argument">If any element of
+    /// <paramref name="lhs" /> is not a valid index of a row.</exception>
+    template<class TValue, matrix_layout L, class A>
+    inline explicit packed_matrix(_In_ const matrix<TValue, L, A>& lhs)
+        : packed_matrix(matrix_view<const TValue, L>(lhs)) { }
+
+    /// <summary>
+    /// Answer the number of bits used for every element.
+    /// </summary>
+    /// <returns>The number of bits per element.</returns>
+    inline std::size_t bits(void) const noexcept {
+        return this->_bits;
+    }
+
+    /// <summary>
+    /// Answer the number of columns in the matrix.
+    /// </summary>
+    /// <returns>The number of columns in the matrix.</returns>
+    inline std::size_t columns(void) const noexcept {
+        return this->_columns;
+    }
+
+    /// <summary>
+    /// Answer the packed bits.
+    /// </summary>
+    /// <returns>A pointer to the first word of the packed elements.</returns>
+    inline const word_type *data(void) const noexcept {
+        return this->_words.data();
+    }
+
+    /// <summary>
+    /// Answer whether the matrix has no elements.
+    /// </summary>
+    /// <returns><c>true</c> if the matrix has no elements,
+    /// <c>false</c> otherwise.</returns>
+    inline bool empty(void) const noexcept {
+        return (this->size() == 0);
+    }
+
+    /// <summary>
+    /// Answer the element with the given flattened index.
+    /// </summary>
+    /// <param name="index">The flattened index of the element in the order
+    /// given by <typeparamref name="Layout" />.</param>
+    /// <returns>The value of the element.</returns>
+    value_type get(_In_ const std::size_t index) const noexcept;
+
+    /// <summary>
+    /// Answer the layout of the packed elements.
+    /// </summary>
+    /// <returns>The layout of the matrix.</returns>
+    inline constexpr matrix_layout layout(void) const noexcept {
+        return Layout;
+    }
+
+    /// <summary>
+    /// Answer the number of rows in the matrix.
+    /// </summary>
+    /// <returns>The number of rows in the matrix.</returns>
+    inline std::size_t rows(void) const noexcept {
+        return this->_rows;
+    }
+
+    /// <summary>
+    /// Sets the element with the given flattened index.
+    /// </summary>
+    /// <param name="index">The flattened index of the element in the order
+    /// given by <typeparamref name="Layout" />.</param>
+    /// <param name="value">The new value, which must be representable using
+    /// <see cref="bits" /> bits.</param>
+    void set(_In_ const std::size_t index,
+        _In_ const value_type value) noexcept;
+
+    /// <summary>
+    /// Sets the element at the given position.
+    /// </summary>
+    /// <param name="row">The zero-based row of the element.</param>
+    /// <param name="column">The zero-based column of the element.</param>
+    /// <param name="value">The new value, which must be representable using
+    /// <see cref="bits" /> bits.</param>
+    inline void set(_In_ const std::size_t row,
+            _In_ const std::size_t column,
+            _In_ const value_type value) noexcept {
+        this->set(this->index(row, column), value);
+    }
+
+    /// <summary>
+    /// Answer the number of elements in the matrix.
+    /// </summary>
+    /// <returns>The number of elements in the matrix.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_rows * this->_columns;
+    }
+
+    /// <summary>
+    /// Unpacks the indices into <paramref name="dst" />.
+    /// </summary>
+    /// <remarks>
+    /// The bits are decoded as a stream, which avoids computing the position
+    /// of each element separately.
+    /// </remarks>
+    /// <typeparam name="TValue">The type of the indices, which must be an
+    /// unsigned integral type.</typeparam>
+    /// <typeparam name="L">The layout of <paramref name="dst" />.</typeparam>
+    /// <param name="dst">The view to receive the indices, which must have the
+    /// same dimensions as the packed matrix.</param>
+    /// <returns><paramref name="dst" />.</returns>
+    /// <exception cref="std::invalid_argument">If the dimensions of
+    /// <paramref name="dst" /> do not match or if
+    /// <typeparamref name="TValue" /> cannot represent all indices.
+    /// </exception>
+    template<class TValue, matrix_layout L>
+    matrix_view<TValue, L> unpack(_In_ const matrix_view<TValue, L> dst) const;
+
+    /// <summary>
+    /// Unpacks the indices into a new matrix.
+    /// </summary>
+    /// <typeparam name="TValue">The type of the indices, which must be an
+    /// unsigned integral type. This parameter defaults to
+    /// <c>std::size_t</c>.</typeparam>
+    /// <returns>A matrix holding the unpacked indices.</returns>
+    /// <exception cref="std::invalid_argument">If
+    /// <typeparamref name="TValue" /> cannot represent all indices.
+    /// </exception>
+    template<class TValue = std::size_t>
+    inline matrix<TValue, Layout> unpack(void) const {
+        matrix<TValue, Layout> retval(this->_rows, this->_columns);
+        this->unpack(matrix_view<TValue, Layout>(retval));
+        return retval;
+    }
+
+    /// <summary>
+    /// Unpacks the sample into the centres of the strata of the unit
+    /// hypercube, which is what <see cref="centred" /> would produce for the
+    /// same indices.
+    /// </summary>
+    /// <typeparam name="TValue">The floating-point type of the result.
+    /// </typeparam>
+    /// <typeparam name="L">The layout of <paramref name="dst" />.</typeparam>
+    /// <param name="dst">The view to receive the sample, which must have the
+    /// same dimensions as the packed matrix.</param>
+    /// <returns><paramref name="dst" />.</returns>
+    /// <exception cref="std::invalid_argument">If the dimensions of
+    /// <paramref name="dst" /> do not match.</exception>
+    template<class TValue, matrix_layout L>
+    std::enable_if_t<std::is_floating_point_v<TValue>, matrix_view<TValue, L>>
+    unpack_unit(_In_ const matrix_view<TValue, L> dst) const;
+
+    /// <summary>
+    /// Unpacks the sample into the centres of the strata of the unit
+    /// hypercube.
+    /// </summary>
+    /// <typeparam name="TValue">The floating-point type of the result.
+    /// </typeparam>
+    /// <returns>A matrix holding the unit sample.</returns>
+    template<class TValue>
+    inline std::enable_if_t<std::is_floating_point_v<TValue>,
+        matrix<TValue, Layout>> unpack_unit(void) const {
+        matrix<TValue, Layout> retval(this->_rows, this->_columns);
+        this->unpack_unit(matrix_view<TValue, Layout>(retval));
+        return retval;
+    }
+
+    /// <summary>
+    /// Answer the number of words used to store the bits.
+    /// </summary>
+    /// <returns>The number of words behind <see cref="data" />.</returns>
+    inline std::size_t words(void) const noexcept {
+        return this->_words.size();
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="row">The zero-based row of the element.</param>
+    /// <param name="column">The zero-based column of the element.</param>
+    /// <returns>The value of the element.</returns>
+    inline value_type operator ()(_In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        return this->get(this->index(row, column));
+    }
+
+    /// <summary>
+    /// Answer the element with the given flattened index.
+    /// </summary>
+    /// <param name="index">The flattened index of the element in the order
+    /// given by <typeparamref name="Layout" />.</param>
+    /// <returns>The value of the element.</returns>
+    inline value_type operator [](_In_ const std::size_t index) const noexcept {
+        return this->get(index);
+    }
+
+private:
+
+    /// <summary>
+    /// The number of bits in a <see cref="word_type" />.
+    /// </summary>
+    static constexpr std::size_t word_bits = 8 * sizeof(word_type);
+
+    /// <summary>
+    /// Calls <paramref name="consumer" /> for all elements in the order given
+    /// by <typeparamref name="Layout" />.
+    /// </summary>
+    template<class TConsumer>
+    void decode(_In_ TConsumer&& consumer) const;
+
+    /// <summary>
+    /// Answer the flattened index of the given <paramref name="row" /> and
+    /// <paramref name="column" />.
+    /// </summary>
+    inline std::size_t index(_In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        assert(row < this->_rows);
+        assert(column < this->_columns);
+        return (Layout == matrix_layout::row_major)
+            ? row * this->_columns + column
+            : column * this->_rows + row;
+    }
+
+    /// <summary>
+    /// Answer the mask selecting the lowest <see cref="_bits" /> bits.
+    /// </summary>
+    inline word_type mask(void) const noexcept {
+        return (this->_bits < word_bits)
+            ? (static_cast<word_type>(1) << this->_bits) - 1
+            : ~static_cast<word_type>(0);
+    }
+
+    std::size_t _bits;
+    std::size_t _columns;
+    std::size_t _rows;
+    std::vector<word_type> _words;
+};
+
+LHS_NAMESPACE_END
+
+#include "visus/lhs/packed_matrix.inl"
+
+#endif /* !defined(_LHS_PACKED_MATRIX_H) */
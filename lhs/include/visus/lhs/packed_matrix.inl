@@ -0,0 +1,226 @@
+﻿// <copyright file="packed_matrix.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::bits_for
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+constexpr std::size_t LHS_NAMESPACE::packed_matrix<Layout>::bits_for(
+        _In_ const std::size_t rows) noexcept {
+    std::size_t retval = 1;
+
+    while ((retval < word_bits) && ((static_cast<std::size_t>(1) << retval)
+            < rows)) {
+        ++retval;
+    }
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::packed_matrix
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+LHS_NAMESPACE::packed_matrix<Layout>::packed_matrix(
+        _In_ const std::size_t rows,
+        _In_ const std::size_t columns)
+    : _bits(bits_for(rows)),
+        _columns(columns),
+        _rows(rows),
+        _words((rows * columns * bits_for(rows) + word_bits - 1) / word_bits,
+            static_cast<word_type>(0)) { }
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::packed_matrix
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+template<class TValue, LHS_NAMESPACE::matrix_layout L>
+LHS_NAMESPACE::packed_matrix<Layout>::packed_matrix(
+        _In_ const matrix_view<const TValue, L> lhs)
+        : packed_matrix(lhs.rows(), lhs.columns()) {
+    static_assert(detail::is_index_v<TValue>, "Only matrices of stratum "
+        "indices can be packed.");
+    const auto inner = (Layout == matrix_layout::row_major)
+        ? this->_columns
+        : this->_rows;
+    const auto outer = (Layout == matrix_layout::row_major)
+        ? this->_rows
+        : this->_columns;
+
+    for (std::size_t o = 0, i = 0; o < outer; ++o) {
+        for (std::size_t n = 0; n < inner; ++n, ++i) {
+            const auto value = (Layout == matrix_layout::row_major)
+                ? lhs(o, n)
+                : lhs(n, o);
+            if (static_cast<std::size_t>(value) >= this->_rows) {
+                throw std::invalid_argument("The matrix contains an element "
+                    "which is not a valid index of a stratum.");
+            }
+
+            this->set(i, static_cast<value_type>(value));
+        }
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::get
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+typename LHS_NAMESPACE::packed_matrix<Layout>::value_type
+LHS_NAMESPACE::packed_matrix<Layout>::get(
+        _In_ const std::size_t index) const noexcept {
+    assert(index < this->size());
+    const auto bit = index * this->_bits;
+    const auto word = bit / word_bits;
+    const auto offset = bit % word_bits;
+
+    auto retval = this->_words[word] >> offset;
+    if (offset + this->_bits > word_bits) {
+        // The element continues in the next word.
+        retval |= this->_words[word + 1] << (word_bits - offset);
+    }
+
+    return static_cast<value_type>(retval & this->mask());
+}
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::set
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+void LHS_NAMESPACE::packed_matrix<Layout>::set(
+        _In_ const std::size_t index,
+        _In_ const value_type value) noexcept {
+    assert(index < this->size());
+    const auto mask = this->mask();
+    const auto v = static_cast<word_type>(value);
+    assert(v <= mask);
+    const auto bit = index * this->_bits;
+    const auto word = bit / word_bits;
+    const auto offset = bit % word_bits;
+
+    auto& lo = this->_words[word];
+    lo = (lo & ~(mask << offset)) | (v << offset);
+
+    if (offset + this->_bits > word_bits) {
+        const auto shift = word_bits - offset;
+        auto& hi = this->_words[word + 1];
+        hi = (hi & ~(mask >> shift)) | (v >> shift);
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::unpack
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+template<class TValue, LHS_NAMESPACE::matrix_layout L>
+LHS_NAMESPACE::matrix_view<TValue, L>
+LHS_NAMESPACE::packed_matrix<Layout>::unpack(
+        _In_ const matrix_view<TValue, L> dst) const {
+    static_assert(detail::is_index_v<TValue>, "The indices must be unpacked "
+        "into an unsigned integral type.");
+    if ((dst.rows() != this->_rows) || (dst.columns() != this->_columns)) {
+        throw std::invalid_argument("The dimensions of the destination do not "
+            "match the packed matrix.");
+    }
+    detail::check_index<TValue>(this->_rows);
+
+    const auto minor = (L == matrix_layout::row_major)
+        ? dst.columns()
+        : dst.rows();
+
+    if ((L == Layout) && (dst.stride() == minor)) {
+        // Fast path: the destination is dense and in the same order as the
+        // packed elements.
+        auto d = dst.data();
+        this->decode([&d](const std::size_t, const std::size_t,
+                const word_type value) {
+            *d++ = static_cast<TValue>(value);
+        });
+
+    } else {
+        this->decode([dst](const std::size_t r, const std::size_t c,
+                const word_type value) {
+            dst(r, c) = static_cast<TValue>(value);
+        });
+    }
+
+    return dst;
+}
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::unpack_unit
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+template<class TValue, LHS_NAMESPACE::matrix_layout L>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    LHS_NAMESPACE::matrix_view<TValue, L>>
+LHS_NAMESPACE::packed_matrix<Layout>::unpack_unit(
+        _In_ const matrix_view<TValue, L> dst) const {
+    constexpr auto half = static_cast<TValue>(0.5);
+    if ((dst.rows() != this->_rows) || (dst.columns() != this->_columns)) {
+        throw std::invalid_argument("The dimensions of the destination do not "
+            "match the packed matrix.");
+    }
+
+    const auto step = static_cast<TValue>(1) / static_cast<TValue>(this->_rows);
+    this->decode([dst, half, step](const std::size_t r, const std::size_t c,
+            const word_type value) {
+        dst(r, c) = (static_cast<TValue>(value) + half) * step;
+    });
+
+    ASSERT_VALID_LHS(dst);
+    return dst;
+}
+
+
+/*
+ * LHS_NAMESPACE::packed_matrix<Layout>::decode
+ */
+template<LHS_NAMESPACE::matrix_layout Layout>
+template<class TConsumer>
+void LHS_NAMESPACE::packed_matrix<Layout>::decode(
+        _In_ TConsumer&& consumer) const {
+    const auto bits = this->_bits;
+    const auto mask = this->mask();
+    const auto inner = (Layout == matrix_layout::row_major)
+        ? this->_columns
+        : this->_rows;
+    const auto outer = (Layout == matrix_layout::row_major)
+        ? this->_rows
+        : this->_columns;
+    auto word = this->_words.data();
+    std::size_t offset = 0;
+
+    // Note: we walk the bits as a stream rather than calling get(), which
+    // replaces the division and modulo per element with an addition.
+    for (std::size_t o = 0; o < outer; ++o) {
+        for (std::size_t i = 0; i < inner; ++i) {
+            auto value = *word >> offset;
+            if (offset + bits > word_bits) {
+                value |= word[1] << (word_bits - offset);
+            }
+
+            if (Layout == matrix_layout::row_major) {
+                consumer(o, i, value & mask);
+            } else {
+                consumer(i, o, value & mask);
+            }
+
+            offset += bits;
+            if (offset >= word_bits) {
+                offset -= word_bits;
+                ++word;
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+﻿// <copyright file="parallel.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_PARALLEL_H)
+#define _LHS_PARALLEL_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "visus/lhs/api.h"
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Determines the number of threads to be used for processing
+/// <paramref name="work" /> work items.
+/// </summary>
+/// <param name="work">The number of work items to be processed.</param>
+/// <param name="threads">The number of threads requested by the caller. If
+/// this is zero, the number of hardware threads will be used.</param>
+/// <param name="grain">The minimum number of work items a thread should
+/// process. Each thread will get at least this many items.</param>
+/// <returns>The number of threads, which is at least one.</returns>
+inline std::size_t parallelism(_In_ const std::size_t work,
+    _In_ std::size_t threads,
+    _In_ const std::size_t grain = 1) noexcept;
+
+/// <summary>
+/// Splits the half-open range [<paramref name="begin" />,
+/// <paramref name="end" />) into contiguous chunks and invokes
+/// <paramref name="function" /> for each of them on its own thread.
+/// </summary>
+/// <remarks>
+/// <para>The function is invoked with the begin and the end of the chunk it
+/// should process, which allows the callee to set up scratch space once per
+/// chunk rather than per work item. The calling thread processes the last
+/// chunk itself. If only one thread is used, the function is called directly
+/// on the calling thread without any threads being created.</para>
+/// <para>If any of the invocations throws, the method waits for all threads
+/// to complete and rethrows the first exception.</para>
+/// </remarks>
+/// <typeparam name="TFunction">The type of the function, which must accept
+/// the begin and the end of the chunk to process.</typeparam>
+/// <param name="begin">The first work item.</param>
+/// <param name="end">The work item after the last one.</param>
+/// <param name="function">The function to be invoked for each chunk.</param>
+/// <param name="threads">The number of threads to use. If this is zero, the
+/// number of hardware threads will be used.</param>
+/// <param name="grain">The minimum number of work items a thread should
+/// process, which allows for preventing small workloads from being split into
+/// chunks that do not amortise the cost of creating a thread.</param>
+template<class TFunction>
+void parallel_for(_In_ const std::size_t begin,
+    _In_ const std::size_t end,
+    _In_ TFunction&& function,
+    _In_ const std::size_t threads = 0,
+    _In_ const std::size_t grain = 1);
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/parallel.inl"
+
+#endif /* !defined(_LHS_PARALLEL_H) */
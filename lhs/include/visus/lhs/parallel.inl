@@ -0,0 +1,94 @@
+﻿// <copyright file="parallel.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::parallelism
+ */
+inline std::size_t LHS_DETAIL_NAMESPACE::parallelism(
+        _In_ const std::size_t work,
+        _In_ std::size_t threads,
+        _In_ const std::size_t grain) noexcept {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+    }
+
+    // Make sure that each thread gets at least 'grain' items.
+    const auto g = (std::max)(grain, static_cast<std::size_t>(1));
+    threads = (std::min)(threads, work / g);
+
+    return (std::max)(threads, static_cast<std::size_t>(1));
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::parallel_for
+ */
+template<class TFunction>
+void LHS_DETAIL_NAMESPACE::parallel_for(_In_ const std::size_t begin,
+        _In_ const std::size_t end,
+        _In_ TFunction&& function,
+        _In_ const std::size_t threads,
+        _In_ const std::size_t grain) {
+    if (begin >= end) {
+        return;
+    }
+
+    const auto work = end - begin;
+    const auto cnt = parallelism(work, threads, grain);
+
+    if (cnt < 2) {
+        function(begin, end);
+        return;
+    }
+
+    // Distribute the remainder over the first chunks such that the chunks
+    // differ by at most one item.
+    const auto chunk = work / cnt;
+    const auto remainder = work % cnt;
+    auto chunk_begin = [begin, chunk, remainder](const std::size_t i) {
+        return begin + i * chunk + (std::min)(i, remainder);
+    };
+
+    std::vector<std::exception_ptr> errors(cnt);
+    std::vector<std::thread> workers;
+    workers.reserve(cnt - 1);
+
+    auto run = [&errors, &function](const std::size_t i,
+            const std::size_t b,
+            const std::size_t e) {
+        try {
+            function(b, e);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    try {
+        for (std::size_t i = 0; i < cnt - 1; ++i) {
+            workers.emplace_back(run, i, chunk_begin(i), chunk_begin(i + 1));
+        }
+    } catch (...) {
+        // Could not start all threads, so we need to wait for the ones we
+        // have started before we can report the problem.
+        for (auto& w : workers) {
+            w.join();
+        }
+        throw;
+    }
+
+    run(cnt - 1, chunk_begin(cnt - 1), end);
+
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    for (auto& e : errors) {
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
+}
@@ -9,24 +9,144 @@
 #pragma once
 
 #include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
 #include <random>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #include "visus/lhs/make_floating_point.h"
 #include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/index_type.h"
 #include "visus/lhs/is_iterable.h"
 #include "visus/lhs/is_range.h"
 #include "visus/lhs/order.h"
 #include "visus/lhs/range.h"
+#include "visus/lhs/range_scaler.h"
 #include "visus/lhs/scale.h"
+#include "visus/lhs/static_matrix.h"
 #include "visus/lhs/valid.h"
 
 
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Implements the creation of a Latin Hypercube sample of indices for a
+/// matrix whose size may be known at compile time.
+/// </summary>
+/// <remarks>
+/// If <typeparamref name="Rows" /> and <typeparamref name="Columns" /> are
+/// non-zero, they must match the size of <paramref name="result" />. In this
+/// case, all working buffers are allocated on the stack and the loops have a
+/// fixed trip count. Zero designates a size that is only known at runtime.
+/// </remarks>
+template<std::size_t Rows, std::size_t Columns, class TIndex,
+    matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<is_index_v<TIndex>, matrix_view<TIndex, Layout>>
+fill_random(_In_ const matrix_view<TIndex, Layout> result,
+    _In_ TRng& rng,
+    _In_ TDist& distribution);
+
+/// <summary>
+/// Implements the creation of a Latin Hypercube sample of floating-point
+/// numbers for a matrix whose size may be known at compile time.
+/// </summary>
+/// <remarks>
+/// If <typeparamref name="Rows" /> and <typeparamref name="Columns" /> are
+/// non-zero, they must match the size of <paramref name="result" />. In this
+/// case, all working buffers are allocated on the stack and the loops have a
+/// fixed trip count. Zero designates a size that is only known at runtime.
+/// </remarks>
+template<std::size_t Rows, std::size_t Columns, class TValue,
+    matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix_view<TValue, Layout>>
+fill_random(_In_ const matrix_view<TValue, Layout> result,
+    _In_ const bool preserve_draw,
+    _In_ TRng& rng,
+    _In_ TDist& distribution);
+
+/// <summary>
+/// Implements the creation of a Latin Hypercube sample on a unit hypercube
+/// whose values are passed through <paramref name="transform" /> before
+/// they are written to <paramref name="result" />.
+/// </summary>
+/// <remarks>
+/// <para>This fuses the generation of the unit sample and the scaling to the
+/// actual parameter ranges into a single pass over
+/// <paramref name="result" />. The random numbers are drawn in the same order
+/// as by <see cref="fill_random" />, so the result is the same as scaling the
+/// output of <see cref="fill_random" /> afterwards.</para>
+/// <para>If the draw is not preserved, the ranks of all columns must be known
+/// before the jitter is drawn. They are stored in
+/// <paramref name="result" /> if its type can represent all ranks, and in a
+/// temporary matrix of indices otherwise.</para>
+/// </remarks>
+/// <typeparam name="TValue">The floating-point type used for the unit
+/// sample.</typeparam>
+/// <typeparam name="TResult">The type of the elements of the result.
+/// </typeparam>
+/// <typeparam name="TTransform">The type of a function that accepts the
+/// zero-based column and a value of the unit sample in that column and
+/// returns the actual value to be stored in <paramref name="result" />.
+/// </typeparam>
+template<std::size_t Rows, std::size_t Columns, class TValue, class TResult,
+    matrix_layout Layout, class TRng, class TDist, class TTransform>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix_view<TResult, Layout>>
+fill_random_scaled(_In_ const matrix_view<TResult, Layout> result,
+    _In_ const bool preserve_draw,
+    _In_ TRng& rng,
+    _In_ TDist& distribution,
+    _In_ TTransform&& transform);
+
+LHS_DETAIL_NAMESPACE_END
+
+
 LHS_NAMESPACE_BEGIN
 
+/// <summary>
+/// Fill the memory designated by <paramref name="result" /> with a Latin
+/// Hypercube sample.
+/// </summary>
+/// <remarks>
+/// This function creates what the R implmenetation also calls a
+/// &quot;grid&quot; of samples.
+/// </remarks>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// Using narrow types like <c>std::uint16_t</c> for small samples reduces the
+/// memory footprint of the sample.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="result">The view of the memory to receive the Latin Hypercube
+/// sample. The values are ignored on entry. However, the number of rows
+/// represents the number of samples for each parameter whereas the number of
+/// columns represents the number of parameters.</param>
+/// <param name="rng">The random number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution used to sample the random
+/// numbers from. This should be a uniform distribution. Note that the numbers
+/// generated here are not directly part of the result, but only used for
+/// ordering the indices randomly.</param>
+/// <returns><paramref name="result" />.</returns>
+/// <exception cref="std::invalid_argument">If the number of samples exceeds the
+/// range of <typeparamref name="TIndex" />.</exception>
+template<class TIndex, matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<detail::is_index_v<TIndex>, matrix_view<TIndex, Layout>>
+random(_In_ const matrix_view<TIndex, Layout> result,
+    _In_ TRng& rng,
+    _In_ TDist& distribution);
+
 /// <summary>
 /// Fill <paramref name="result" /> with a Latin Hypercube sample.
 /// </summary>
@@ -34,9 +154,13 @@ LHS_NAMESPACE_BEGIN
 /// This function creates what the R implmenetation also calls a
 /// &quot;grid&quot; of samples.
 /// </remarks>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
 /// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
 /// to use row-major matrices here, because in this case, the parameter values
 /// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <typeparam name="TRng">The type of the random number generator.</typeparam>
 /// <typeparam name="TDist">The type of the distribution used to generate random
 /// numbers.</typeparam>
@@ -51,11 +175,19 @@ LHS_NAMESPACE_BEGIN
 /// generated here are not directly part of the result, but only used for
 /// ordering the indices randomly.</param>
 /// <returns><paramref name="result" />.</returns>
-template<matrix_layout Layout, class TRng, class TDist>
-matrix<std::size_t, Layout>& random(
-    _Inout_ matrix<std::size_t, Layout>& result,
-    _In_ TRng& rng,
-    _In_ TDist& distribution);
+template<class TIndex,
+    matrix_layout Layout,
+    class TAllocator,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    matrix<TIndex, Layout, TAllocator>&>
+random(_Inout_ matrix<TIndex, Layout, TAllocator>& result,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    random(matrix_view<TIndex, Layout>(result), rng, distribution);
+    return result;
+}
 
 /// <summary>
 /// Fill <paramref name="result" /> with a Latin Hypercube sample.
@@ -64,9 +196,13 @@ matrix<std::size_t, Layout>& random(
 /// This function creates what the R implmenetation also calls a
 /// &quot;grid&quot; of samples.
 /// </remarks>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
 /// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
 /// to use row-major matrices here, because in this case, the parameter values
 /// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <typeparam name="TRng">The type of the random number generator.</typeparam>
 /// <param name="result">The matrix to receive the Latin Hypercube sample. The
 /// values are ignored on entry. However, the number of rows represents the
@@ -75,9 +211,74 @@ matrix<std::size_t, Layout>& random(
 /// <param name="rng">The random number generator used to sample a uniform
 /// real distribution within [0, 1].</param>
 /// <returns><paramref name="result" />.</returns>
-template<matrix_layout Layout, class TRng>
-inline matrix<std::size_t, Layout>& random(
-        _Inout_ matrix<std::size_t, Layout>& result,
+template<class TIndex, matrix_layout Layout, class TAllocator, class TRng>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    matrix<TIndex, Layout, TAllocator>&>
+random(_Inout_ matrix<TIndex, Layout, TAllocator>& result,
+        _In_ TRng& rng) {
+    return random(result, rng, std::uniform_real_distribution<float>());
+}
+
+/// <summary>
+/// Fill the fixed-size matrix <paramref name="result" /> with a Latin
+/// Hypercube sample without allocating any memory on the heap.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample.
+/// </param>
+/// <param name="rng">The random number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution used to sample the random
+/// numbers for ordering the indices.</param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIndex,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    static_matrix<TIndex, Rows, Columns, Layout>&>
+random(_Inout_ static_matrix<TIndex, Rows, Columns, Layout>& result,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    detail::fill_random<Rows, Columns>(matrix_view<TIndex, Layout>(result),
+        rng, distribution);
+    return result;
+}
+
+/// <summary>
+/// Fill the fixed-size matrix <paramref name="result" /> with a Latin
+/// Hypercube sample without allocating any memory on the heap.
+/// </summary>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample.
+/// </param>
+/// <param name="rng">The random number generator used to sample a uniform
+/// real distribution within [0, 1].</param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIndex,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout,
+    class TRng>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    static_matrix<TIndex, Rows, Columns, Layout>&>
+random(_Inout_ static_matrix<TIndex, Rows, Columns, Layout>& result,
         _In_ TRng& rng) {
     return random(result, rng, std::uniform_real_distribution<float>());
 }
@@ -89,17 +290,22 @@ inline matrix<std::size_t, Layout>& random(
 /// This function creates what the R implmenetation also calls a
 /// &quot;grid&quot; of samples.
 /// </remarks>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// </typeparam>
 /// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
 /// to use row-major matrices here, because in this case, the parameter values
 /// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <param name="result">The matrix to receive the Latin Hypercube sample. The
 /// values are ignored on entry. However, the number of rows represents the
 /// number of samples for each parameter whereas the number of columns
 /// represents the number of parameters.</param>
 /// <returns><paramref name="result" />.</returns>
-template<matrix_layout Layout, class TRng>
-inline matrix<std::size_t, Layout>& random(
-        _Inout_ matrix<std::size_t, Layout>& result) {
+template<class TIndex, matrix_layout Layout, class TAllocator>
+inline std::enable_if_t<detail::is_index_v<TIndex>,
+    matrix<TIndex, Layout, TAllocator>&>
+random(_Inout_ matrix<TIndex, Layout, TAllocator>& result) {
     std::random_device rd;
     std::mt19937 rng(rd());
     return random(result, rng, std::uniform_real_distribution<float>());
@@ -112,6 +318,9 @@ inline matrix<std::size_t, Layout>& random(
 /// This function creates what the R implmenetation also calls a
 /// &quot;grid&quot; of samples.
 /// </remarks>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// This parameter defaults to <c>std::size_t</c>.</typeparam>
 /// <typeparam name="TRng">The type of the random number generator.</typeparam>
 /// <typeparam name="TDist">The type of the distribution used to generate random
 /// numbers.</typeparam>
@@ -126,13 +335,13 @@ inline matrix<std::size_t, Layout>& random(
 /// generated here are not directly part of the result, but only used for
 /// ordering the indices randomly.</param>
 /// <returns></returns>
-template<class TRng, class TDist>
-inline matrix<std::size_t> random(
+template<class TIndex = std::size_t, class TRng, class TDist>
+inline std::enable_if_t<detail::is_index_v<TIndex>, matrix<TIndex>> random(
         _In_ const std::size_t samples,
         _In_ const std::size_t parameters,
         _In_ TRng& rng,
         _In_ TDist& distribution) {
-    matrix<std::size_t> result(samples, parameters);
+    matrix<TIndex> result(samples, parameters);
     return random(result, rng, distribution);
 }
 
@@ -143,6 +352,9 @@ inline matrix<std::size_t> random(
 /// This function creates what the R implmenetation also calls a
 /// &quot;grid&quot; of samples.
 /// </remarks>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// This parameter defaults to <c>std::size_t</c>.</typeparam>
 /// <typeparam name="TRng">The type of the random number generator.</typeparam>
 /// <param name="samples">The number of samples per parameter (rows) of the
 /// Latin hypercube sample.</param>
@@ -153,12 +365,12 @@ inline matrix<std::size_t> random(
 /// <param name="rng">The random number generator used to sample a uniform
 /// real distribution within [0, 1].</param>
 /// <returns></returns>
-template<class TRng>
-inline matrix<std::size_t> random(
+template<class TIndex = std::size_t, class TRng>
+inline std::enable_if_t<detail::is_index_v<TIndex>, matrix<TIndex>> random(
         _In_ const std::size_t samples,
         _In_ const std::size_t parameters,
         _In_ TRng& rng) {
-    matrix<std::size_t> result(samples, parameters);
+    matrix<TIndex> result(samples, parameters);
     return random(result, rng, std::uniform_real_distribution<float>());
 }
 
@@ -169,6 +381,9 @@ inline matrix<std::size_t> random(
 /// This function creates what the R implmenetation also calls a
 /// &quot;grid&quot; of samples.
 /// </remarks>
+/// <typeparam name="TIndex">The type of the indices in the sample, which must
+/// be an unsigned integral type that can represent the number of samples.
+/// This parameter defaults to <c>std::size_t</c>.</typeparam>
 /// <param name="samples">The number of samples per parameter (rows) of the
 /// Latin hypercube sample.</param>
 /// <param name="parameters">The number of parameters (columns) in the
@@ -176,15 +391,48 @@ inline matrix<std::size_t> random(
 /// <param name="rng">The random number generator used to sample a uniform
 /// real distribution within [0, 1].</param>
 /// <returns></returns>
-inline matrix<std::size_t> random(
+template<class TIndex = std::size_t>
+inline std::enable_if_t<detail::is_index_v<TIndex>, matrix<TIndex>> random(
         _In_ const std::size_t samples,
         _In_ const std::size_t parameters) {
-    matrix<std::size_t> result(samples, parameters);
+    matrix<TIndex> result(samples, parameters);
     std::random_device rd;
     std::mt19937 rng(rd());
     return random(result, rng, std::uniform_real_distribution<float>());
 }
 
+/// <summary>
+/// Fill the memory designated by <paramref name="result" /> with a
+/// (uniformly distributed) stratified sample from unit hypercube.
+/// </summary>
+/// <typeparam name="TValue">The type of values to be created, which must be a
+/// floating point type.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
+/// to use row-major matrices here, because in this case, the parameter values
+/// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="result">The view of the memory to receive the Latin Hypercube
+/// sample. The values are ignored on entry. However, the number of rows
+/// represents the number of samples for each parameter whereas the number of
+/// columns represents the number of parameters.</param>
+/// <param name="preserve_draw">Indicates whether the order of the draw should
+/// be preserved if less columns are selected.</param>
+/// <param name="rng">The random number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns><paramref name="result" />.</returns>
+template<class TValue, matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix_view<TValue, Layout>>
+random(_In_ const matrix_view<TValue, Layout> result,
+    _In_ const bool preserve_draw,
+    _In_ TRng& rng,
+    _In_ TDist& distribution);
+
 /// <summary>
 /// Fill <paramref name="result" /> with a (uniformly distributed) stratified
 /// sample from unit hypercube.
@@ -194,6 +442,7 @@ inline matrix<std::size_t> random(
 /// <typeparam name="Layout">The memory layout of the matrix. It is reasonable
 /// to use row-major matrices here, because in this case, the parameter values
 /// for a sample are laid out contiguously in memory.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <typeparam name="TRng">The type of the random number generator.</typeparam>
 /// <typeparam name="TDist">The type of the distribution used to generate random
 /// numbers.</typeparam>
@@ -209,12 +458,61 @@ inline matrix<std::size_t> random(
 /// typically is a uniform real distribution creating numbers within [0, 1].
 /// </param>
 /// <returns><paramref name="result" />.</returns>
-template<class TValue, matrix_layout Layout, class TRng, class TDist>
-std::enable_if_t<std::is_floating_point_v<TValue>, matrix<TValue, Layout>&>
-random(_Inout_ matrix<TValue, Layout>& result,
-    _In_ const bool preserve_draw,
-    _In_ TRng& rng,
-    _In_ TDist& distribution);
+template<class TValue,
+    matrix_layout Layout,
+    class TAllocator,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<std::is_floating_point_v<TValue>,
+    matrix<TValue, Layout, TAllocator>&>
+random(_Inout_ matrix<TValue, Layout, TAllocator>& result,
+        _In_ const bool preserve_draw,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    random(matrix_view<TValue, Layout>(result), preserve_draw, rng,
+        distribution);
+    return result;
+}
+
+/// <summary>
+/// Fill the fixed-size matrix <paramref name="result" /> with a Latin
+/// Hypercube sample from the unit hypercube without allocating any memory on
+/// the heap.
+/// </summary>
+/// <typeparam name="TValue">The type of values to be created, which must be a
+/// floating point type.</typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <typeparam name="TDist">The type of the distribution used to generate random
+/// numbers.</typeparam>
+/// <param name="result">The matrix to receive the Latin Hypercube sample.
+/// </param>
+/// <param name="preserve_draw">Indicates whether the order of the draw should
+/// be preserved if less columns are selected.</param>
+/// <param name="rng">The random number generator used to sample the given
+/// <paramref name="distribution" />.</param>
+/// <param name="distribution">The distribution to draw samples from, which
+/// typically is a uniform real distribution creating numbers within [0, 1].
+/// </param>
+/// <returns><paramref name="result" />.</returns>
+template<class TValue,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout,
+    class TRng,
+    class TDist>
+inline std::enable_if_t<std::is_floating_point_v<TValue>,
+    static_matrix<TValue, Rows, Columns, Layout>&>
+random(_Inout_ static_matrix<TValue, Rows, Columns, Layout>& result,
+        _In_ const bool preserve_draw,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    detail::fill_random<Rows, Columns>(matrix_view<TValue, Layout>(result),
+        preserve_draw, rng, distribution);
+    return result;
+}
 
 /// <summary>
 /// Create a (uniformly distributed) stratified sample from unit hypercube.
@@ -302,10 +600,15 @@ random(_In_ const std::size_t samples,
 /// the given parameter <see cref="range{TValue}" />s.
 /// </summary>
 /// <remarks>
-/// <para>This function will first create a uniformly distributed sample from
-/// a unit hypercube. Afterwards, the resulting values will be scaled to the
-/// specified parameter ranges. If the parameters are integral numbers, the
-/// results will be rounded to the nearest integer value.</para>
+/// <para>This function creates a uniformly distributed sample from a unit
+/// hypercube and scales the values to the specified parameter ranges while
+/// writing them, i.e. without an intermediate unit matrix. If the parameters
+/// are integral numbers, the results will be rounded to the nearest integer
+/// value.</para>
+/// <para>The parameters may also be
+/// <see cref="transformed_range{TValue, TTransform}" />s like logarithmic
+/// ranges, in which case the inverse transform is applied while writing the
+/// sample as well.</para>
 /// </remarks>
 /// <typeparam name="TIterator">An iterator over the parameter
 /// <paramref name="range{TValue}" />s. The elements, which can be
@@ -346,10 +649,15 @@ random(_In_ const std::size_t samples,
 /// the given parameter <see cref="range{TValue}" />s.
 /// </summary>
 /// <remarks>
-/// <para>This function will first create a uniformly distributed sample from
-/// a unit hypercube. Afterwards, the resulting values will be scaled to the
-/// specified parameter ranges. If the parameters are integral numbers, the
-/// results will be rounded to the nearest integer value.</para>
+/// <para>This function creates a uniformly distributed sample from a unit
+/// hypercube and scales the values to the specified parameter ranges while
+/// writing them, i.e. without an intermediate unit matrix. If the parameters
+/// are integral numbers, the results will be rounded to the nearest integer
+/// value.</para>
+/// <para>The parameters may also be
+/// <see cref="transformed_range{TValue, TTransform}" />s like logarithmic
+/// ranges, in which case the inverse transform is applied while writing the
+/// sample as well.</para>
 /// </remarks>
 /// <typeparam name="TIterator">An iterator over the parameter
 /// <paramref name="range{TValue}" />s. The elements, which can be
@@ -393,10 +701,11 @@ random(_In_ const std::size_t samples,
 /// the given parameter <see cref="range{TValue}" />s.
 /// </summary>
 /// <remarks>
-/// <para>This function will first create a uniformly distributed sample from
-/// a unit hypercube. Afterwards, the resulting values will be scaled to the
-/// specified parameter ranges. If the parameters are integral numbers, the
-/// results will be rounded to the nearest integer value.</para>
+/// <para>This function creates a uniformly distributed sample from a unit
+/// hypercube and scales the values to the specified parameter ranges while
+/// writing them, i.e. without an intermediate unit matrix. If the parameters
+/// are integral numbers, the results will be rounded to the nearest integer
+/// value.</para>
 /// </remarks>
 /// <typeparam name="TValue">The type of samples to be generated.</typeparam>
 /// <typeparam name="TRng">The type of the random number generator.</typeparam>
@@ -431,10 +740,11 @@ inline matrix<TValue> random(_In_ const std::size_t samples,
 /// the given parameter <see cref="range{TValue}" />s.
 /// </summary>
 /// <remarks>
-/// <para>This function will first create a uniformly distributed sample from
-/// a unit hypercube. Afterwards, the resulting values will be scaled to the
-/// specified parameter ranges. If the parameters are integral numbers, the
-/// results will be rounded to the nearest integer value.</para>
+/// <para>This function creates a uniformly distributed sample from a unit
+/// hypercube and scales the values to the specified parameter ranges while
+/// writing them, i.e. without an intermediate unit matrix. If the parameters
+/// are integral numbers, the results will be rounded to the nearest integer
+/// value.</para>
 /// </remarks>
 /// <typeparam name="TValue">The type of samples to be generated.</typeparam>
 /// <typeparam name="TRng">The type of the random number generator.</typeparam>
@@ -8,22 +8,137 @@
 /*
  * LHS_NAMESPACE::random
  */
-template<LHS_NAMESPACE::matrix_layout Layout, class TRng, class TDist>
-LHS_NAMESPACE::matrix<std::size_t, Layout>& LHS_NAMESPACE::random(
-        _Inout_ matrix<std::size_t, Layout>& result,
+template<class TIndex, LHS_NAMESPACE::matrix_layout Layout, class TRng,
+    class TDist>
+std::enable_if_t<LHS_DETAIL_NAMESPACE::is_index_v<TIndex>,
+    LHS_NAMESPACE::matrix_view<TIndex, Layout>>
+LHS_NAMESPACE::random(_In_ const matrix_view<TIndex, Layout> result,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    return detail::fill_random<0, 0>(result, rng, distribution);
+}
+
+
+/*
+ * LHS_NAMESPACE::random
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout, class TRng,
+    class TDist>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    LHS_NAMESPACE::matrix_view<TValue, Layout>>
+LHS_NAMESPACE::random(_In_ const matrix_view<TValue, Layout> result,
+        _In_ const bool preserve_draw,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    return detail::fill_random<0, 0>(result, preserve_draw, rng,
+        distribution);
+}
+
+
+/*
+ * LHS_NAMESPACE::random
+ */
+template<class TIterator, class TRng, class TDist>
+inline std::enable_if_t<LHS_DETAIL_NAMESPACE::is_range_v<
+        typename std::iterator_traits<TIterator>::value_type>,
+    LHS_NAMESPACE::matrix<
+        typename std::iterator_traits<TIterator>::value_type::value_type>>
+LHS_NAMESPACE::random(_In_ const std::size_t samples,
+        _In_ TIterator&& begin,
+        _In_ TIterator&& end,
+        _In_ const bool preserve_draw,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    typedef typename std::iterator_traits<TIterator>::value_type range_type;
+    typedef typename range_type::value_type int_type;
+    typedef detail::make_floating_point_t<int_type> float_type;
+    typedef detail::range_scaler<std::decay_t<range_type>, float_type>
+        scaler_type;
+    constexpr auto half = static_cast<float_type>(0.5);
+
+    // Note: the scalers also apply the transform of transformed ranges, which
+    // is therefore fused into writing the sample.
+    std::vector<scaler_type> scalers;
+    for (auto it = begin; it != end; ++it) {
+        scalers.emplace_back(*it);
+    }
+
+    matrix<int_type> retval(samples, scalers.size());
+    detail::fill_random_scaled<0, 0, float_type>(
+        matrix_view<int_type>(retval), preserve_draw, rng, distribution,
+        [&scalers](const std::size_t c, const float_type v) {
+            const auto value = scalers[c](v);
+            if constexpr (std::is_floating_point_v<int_type>) {
+                return value;
+            } else {
+                return static_cast<int_type>(value + half);
+            }
+        });
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::random
+ */
+template<class TIterator, class TRng, class TDist>
+std::enable_if_t<std::is_integral_v<
+    typename std::iterator_traits<TIterator>::value_type>,
+    LHS_NAMESPACE::matrix<typename std::iterator_traits<TIterator>::value_type>>
+LHS_NAMESPACE::random(_In_ const std::size_t samples,
+        _In_ TIterator&& begin,
+        _In_ TIterator&& end,
+        _In_ const bool preserve_draw,
+        _In_ TRng& rng,
+        _In_ TDist& distribution) {
+    typedef typename std::iterator_traits<TIterator>::value_type int_type;
+    typedef detail::make_floating_point_t<int_type> float_type;
+    constexpr auto half = static_cast<float_type>(0.5);
+
+    // The largest index of each parameter is the scale of the unit sample.
+    std::vector<float_type> scales;
+    for (auto it = begin; it != end; ++it) {
+        scales.push_back(static_cast<float_type>((*it != 0) ? (*it - 1) : *it));
+    }
+
+    matrix<int_type> retval(samples, scales.size());
+    detail::fill_random_scaled<0, 0, float_type>(
+        matrix_view<int_type>(retval), preserve_draw, rng, distribution,
+        [&scales](const std::size_t c, const float_type v) {
+            return static_cast<int_type>(scales[c] * v + half);
+        });
+
+    return retval;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::fill_random
+ */
+template<std::size_t Rows, std::size_t Columns, class TIndex,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng, class TDist>
+std::enable_if_t<LHS_DETAIL_NAMESPACE::is_index_v<TIndex>,
+    LHS_NAMESPACE::matrix_view<TIndex, Layout>>
+LHS_DETAIL_NAMESPACE::fill_random(
+        _In_ const matrix_view<TIndex, Layout> result,
         _In_ TRng& rng,
         _In_ TDist& distribution) {
     // Derived from https://github.com/bertcarnell/lhs/blob/4be72495c0eba3ce0b1ae602122871ec83421db6/src/randomLHS.cpp#L26C1-L43C5
-    const auto n = result.rows();
-    std::vector<std::size_t> indices(n);
-    std::vector<typename TDist::result_type> values(n);
+    assert((Rows == 0) || (result.rows() == Rows));
+    assert((Columns == 0) || (result.columns() == Columns));
+    const auto n = (Rows != 0) ? Rows : result.rows();
+    const auto k = (Columns != 0) ? Columns : result.columns();
+    check_index<TIndex>(n);
+    auto indices = make_buffer<TIndex, Rows>(n);
+    auto values = make_buffer<typename TDist::result_type, Rows>(n);
 
-    for (std::size_t c = 0, k = result.columns(); c < k; ++c) {
+    for (std::size_t c = 0; c < k; ++c) {
         for (std::size_t r = 0; r < n; ++r) {
             values[r] = distribution(rng);
         }
 
-        detail::order(indices, values.begin(), values.end());
+        order_into(indices.begin(), values.begin(), values.end());
 
         for (std::size_t r = 0; r < n; ++r) {
             result(r, c) = indices[r];
@@ -36,27 +151,50 @@ LHS_NAMESPACE::matrix<std::size_t, Layout>& LHS_NAMESPACE::random(
 
 
 /*
- * LHS_NAMESPACE::random
+ * LHS_DETAIL_NAMESPACE::fill_random
  */
-template<class TValue,
-    LHS_NAMESPACE::matrix_layout Layout,
-    class TRng,
-    class TDist>
+template<std::size_t Rows, std::size_t Columns, class TValue,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng, class TDist>
 std::enable_if_t<std::is_floating_point_v<TValue>,
-    LHS_NAMESPACE::matrix<TValue, Layout>&>
-LHS_NAMESPACE::random(_Inout_ matrix<TValue, Layout>& result,
+    LHS_NAMESPACE::matrix_view<TValue, Layout>>
+LHS_DETAIL_NAMESPACE::fill_random(
+        _In_ const matrix_view<TValue, Layout> result,
         _In_ const bool preserve_draw,
         _In_ TRng& rng,
         _In_ TDist& distribution) {
+    fill_random_scaled<Rows, Columns, TValue>(result, preserve_draw, rng,
+        distribution, [](const std::size_t, const TValue v) { return v; });
+    ASSERT_VALID_LHS(result);
+    return result;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::fill_random_scaled
+ */
+template<std::size_t Rows, std::size_t Columns, class TValue, class TResult,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng, class TDist,
+    class TTransform>
+std::enable_if_t<std::is_floating_point_v<TValue>,
+    LHS_NAMESPACE::matrix_view<TResult, Layout>>
+LHS_DETAIL_NAMESPACE::fill_random_scaled(
+        _In_ const matrix_view<TResult, Layout> result,
+        _In_ const bool preserve_draw,
+        _In_ TRng& rng,
+        _In_ TDist& distribution,
+        _In_ TTransform&& transform) {
     // Derived from https://github.com/bertcarnell/lhs/blob/4be72495c0eba3ce0b1ae602122871ec83421db6/src/randomLHS.cpp#L46C2-L113C10
-    const auto n = result.rows();
-    std::vector<std::size_t> indices(n);
-    std::vector<TValue> values(n);
+    assert((Rows == 0) || (result.rows() == Rows));
+    assert((Columns == 0) || (result.columns() == Columns));
+    const auto n = (Rows != 0) ? Rows : result.rows();
+    const auto k = (Columns != 0) ? Columns : result.columns();
+    auto indices = make_buffer<std::size_t, Rows>(n);
+    auto values = make_buffer<TValue, Rows>(n);
 
     if (preserve_draw) {
-        std::vector<TValue> values2(values.size());
+        auto values2 = make_buffer<TValue, Rows>(n);
 
-        for (std::size_t c = 0, k = result.columns(); c < k; ++c) {
+        for (std::size_t c = 0; c < k; ++c) {
             for (std::size_t r = 0; r < n; ++r) {
                 values[r] = static_cast<TValue>(distribution(rng));
             }
@@ -66,100 +204,62 @@ LHS_NAMESPACE::random(_Inout_ matrix<TValue, Layout>& result,
                 values2[r] = static_cast<TValue>(distribution(rng));
             }
 
-            detail::order(indices, values.begin(), values.end());
+            order_into(indices.begin(), values.begin(), values.end());
 
             for (std::size_t r = 0; r < n; ++r) {
-                result(r, c) = static_cast<TValue>(indices[r]) + values2[r];
-                result(r, c) /= static_cast<TValue>(n);
+                auto value = static_cast<TValue>(indices[r]) + values2[r];
+                value /= static_cast<TValue>(n);
+                result(r, c) = transform(c, value);
             }
-        } /* for (std::size_t c = 0, k = result.columns(); c < k; ++c) */
+        } /* for (std::size_t c = 0; c < k; ++c) */
 
     } else {
-        const auto k = result.columns();
+        // The ranks are kept in 'result' unless it cannot represent them, in
+        // which case we need a separate matrix.
+        bool in_place = true;
+        if constexpr (std::is_integral_v<TResult>) {
+            in_place = (n == 0) || (static_cast<std::uintmax_t>(n - 1)
+                <= static_cast<std::uintmax_t>(
+                (std::numeric_limits<TResult>::max)()));
+        }
+
+        matrix<std::size_t, Layout> ranks(in_place ? 0 : n, in_place ? 0 : k);
 
         for (std::size_t c = 0; c < k; ++c) {
             for (std::size_t r = 0; r < n; ++r) {
                 values[r] = static_cast<TValue>(distribution(rng));
             }
 
-            detail::order(indices, values.begin(), values.end());
+            order_into(indices.begin(), values.begin(), values.end());
 
             for (std::size_t r = 0; r < n; ++r) {
-                result(r, c) = static_cast<TValue>(indices[r]);
+                if (in_place) {
+                    result(r, c) = static_cast<TResult>(indices[r]);
+                } else {
+                    ranks(r, c) = indices[r];
+                }
             }
         }
 
-        std::decay_t<decltype(result)> values2(result.rows(), result.columns());
-        for (std::size_t i = 0; i < values2.size(); ++i) {
-            values2[i] = static_cast<TValue>(distribution(rng));
-        }
-
-        for (std::size_t c = 0; c < k; ++c) {
-            for (std::size_t r = 0; r < n; ++r) {
-                result(r, c) += values2(r, c);
-                result(r, c) /= static_cast<TValue>(n);
+        // Note: the jitter must be drawn in the order of the layout of
+        // 'result' in order to reproduce previous samples. Adding it in place
+        // rather than drawing it into a buffer first streams through 'result'
+        // without any additional memory.
+        const auto lines = (Layout == matrix_layout::row_major) ? n : k;
+        const auto length = (Layout == matrix_layout::row_major) ? k : n;
+        for (std::size_t l = 0; l < lines; ++l) {
+            for (std::size_t i = 0; i < length; ++i) {
+                const auto r = (Layout == matrix_layout::row_major) ? l : i;
+                const auto c = (Layout == matrix_layout::row_major) ? i : l;
+                auto value = in_place
+                    ? static_cast<TValue>(result(r, c))
+                    : static_cast<TValue>(ranks(r, c));
+                value += static_cast<TValue>(distribution(rng));
+                value /= static_cast<TValue>(n);
+                result(r, c) = transform(c, value);
             }
         }
     } /* if (preserve_draw) */
 
-    ASSERT_VALID_LHS(result);
     return result;
 }
-
-
-/*
- * LHS_NAMESPACE::random
- */
-template<class TIterator, class TRng, class TDist>
-inline std::enable_if_t<LHS_DETAIL_NAMESPACE::is_range_v<
-        typename std::iterator_traits<TIterator>::value_type>,
-    LHS_NAMESPACE::matrix<
-        typename std::iterator_traits<TIterator>::value_type::value_type>>
-LHS_NAMESPACE::random(_In_ const std::size_t samples,
-        _In_ TIterator&& begin,
-        _In_ TIterator&& end,
-        _In_ const bool preserve_draw,
-        _In_ TRng& rng,
-        _In_ TDist& distribution) {
-    typedef typename std::iterator_traits<TIterator>::value_type range_type;
-    typedef typename range_type::value_type int_type;
-    typedef make_floating_point_t<int_type> float_type;
-
-    matrix<float_type> retval(samples, std::distance(begin, end));
-
-    // Create random samples within [0, 1].
-    random(retval,
-        preserve_draw,
-        std::forward<TRng>(rng),
-        std::forward<TDist>(distribution));
-
-    // Scale to the requested range.
-    return detail::scale(retval, begin, end);
-}
-
-
-/*
- * LHS_NAMESPACE::random
- */
-template<class TIterator, class TRng, class TDist>
-std::enable_if_t<std::is_integral_v<
-    typename std::iterator_traits<TIterator>::value_type>,
-    LHS_NAMESPACE::matrix<typename std::iterator_traits<TIterator>::value_type>>
-LHS_NAMESPACE::random(_In_ const std::size_t samples,
-        _In_ TIterator&& begin,
-        _In_ TIterator&& end,
-        _In_ const bool preserve_draw,
-        _In_ TRng& rng,
-        _In_ TDist& distribution) {
-    typedef typename std::iterator_traits<TIterator>::value_type int_type;
-    typedef make_floating_point_t<int_type> float_type;
-
-    // Create a sample from the unit hypercube.
-    matrix<float_type> unit(samples, std::distance(begin, end));
-    random(unit, preserve_draw, rng, distribution);
-
-    // Scale the cube to the the specified ranges.
-    return scale(unit,
-        std::forward<TIterator>(begin),
-        std::forward<TIterator>(end));
-}
@@ -0,0 +1,162 @@
+﻿// <copyright file="range_scaler.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_RANGE_SCALER_H)
+#define _LHS_RANGE_SCALER_H
+#pragma once
+
+#include <algorithm>
+#include <type_traits>
+
+#include "visus/lhs/range.h"
+#include "visus/lhs/transformed_range.h"
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Maps values from the unit interval to a parameter range.
+/// </summary>
+/// <remarks>
+/// The scaler is created once per column and captures everything required
+/// to scale the column, which allows the generators to scale the values
+/// while writing them.
+/// </remarks>
+/// <typeparam name="TRange">The type of the parameter range.</typeparam>
+/// <typeparam name="TFloat">The floating-point type in which the values are
+/// scaled.</typeparam>
+template<class TRange, class TFloat> class range_scaler final { };
+
+
+/// <summary>
+/// Specialisation for linear ranges.
+/// </summary>
+template<class TValue, class TFloat>
+class range_scaler<range<TValue>, TFloat> final {
+
+public:
+
+    /// <summary>
+    /// The type of the parameter range.
+    /// </summary>
+    typedef range<TValue> range_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="range">The range the unit values are mapped to.</param>
+    inline explicit range_scaler(_In_ const range_type& range) noexcept
+        : _distance(static_cast<TFloat>(range.distance())),
+            _offset(static_cast<TFloat>(range.begin())) { }
+
+    /// <summary>
+    /// Answer the length of the range in the space in which it is sampled
+    /// uniformly.
+    /// </summary>
+    inline TFloat distance(void) const noexcept {
+        return this->_distance;
+    }
+
+    /// <summary>
+    /// Maps a value from the space in which the range is sampled uniformly
+    /// to the parameter space, which is the identity for linear ranges.
+    /// </summary>
+    inline TFloat inverse(_In_ const TFloat value) const noexcept {
+        return value;
+    }
+
+    /// <summary>
+    /// Answer the begin of the range in the space in which it is sampled
+    /// uniformly.
+    /// </summary>
+    inline TFloat offset(void) const noexcept {
+        return this->_offset;
+    }
+
+    /// <summary>
+    /// Maps the unit sample value <paramref name="value" /> to the range.
+    /// </summary>
+    inline TFloat operator ()(_In_ const TFloat value) const noexcept {
+        return this->_offset + this->_distance * value;
+    }
+
+private:
+
+    TFloat _distance;
+    TFloat _offset;
+};
+
+
+/// <summary>
+/// Specialisation for transformed ranges.
+/// </summary>
+template<class TValue, class TTransform, class TFloat>
+class range_scaler<transformed_range<TValue, TTransform>, TFloat> final {
+
+public:
+
+    /// <summary>
+    /// The type of the parameter range.
+    /// </summary>
+    typedef transformed_range<TValue, TTransform> range_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="range">The range the unit values are mapped to.</param>
+    inline explicit range_scaler(_In_ const range_type& range)
+        : _distance(static_cast<TFloat>(range.transformed_distance())),
+            _lower(static_cast<TFloat>(range.begin())),
+            _offset(static_cast<TFloat>(range.transformed_begin())),
+            _transform(range.transform()),
+            _upper(static_cast<TFloat>(range.end())) { }
+
+    /// <summary>
+    /// Answer the length of the range in the transformed space, in which it
+    /// is sampled uniformly.
+    /// </summary>
+    inline TFloat distance(void) const noexcept {
+        return this->_distance;
+    }
+
+    /// <summary>
+    /// Applies the inverse transform and clamps the result to the bounds of
+    /// the range.
+    /// </summary>
+    inline TFloat inverse(_In_ const TFloat value) const noexcept {
+        const auto retval = static_cast<TFloat>(
+            this->_transform.inverse(value));
+        return (std::min)((std::max)(retval, this->_lower), this->_upper);
+    }
+
+    /// <summary>
+    /// Answer the begin of the range in the transformed space, in which it is
+    /// sampled uniformly.
+    /// </summary>
+    inline TFloat offset(void) const noexcept {
+        return this->_offset;
+    }
+
+    /// <summary>
+    /// Maps the unit sample value <paramref name="value" /> to the transformed
+    /// space and from there back to the parameter space.
+    /// </summary>
+    inline TFloat operator ()(_In_ const TFloat value) const noexcept {
+        return this->inverse(this->_offset + this->_distance * value);
+    }
+
+private:
+
+    TFloat _distance;
+    TFloat _lower;
+    TFloat _offset;
+    TTransform _transform;
+    TFloat _upper;
+};
+
+LHS_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_LHS_RANGE_SCALER_H) */
@@ -8,10 +8,16 @@
 #define _LHS_SAMPLE_H
 #pragma once
 
+#include <algorithm>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/parallel.h"
 #include "visus/lhs/sample_type.h"
 #include "visus/lhs/valid.h"
+#include "visus/lhs/vector_view.h"
 
 
 LHS_NAMESPACE_BEGIN
@@ -35,11 +41,270 @@ template<class TLhsGenerator, class... TParameters>
 std::vector<detail::sample_type_t<TParameters...>> sample(
     _In_ TLhsGenerator lhs_generator, _In_ const TParameters&... parameters);
 
+/// <summary>
+/// Create a Latin Hypercube sample for the given parameter ranges and store
+/// it as one column per parameter.
+/// </summary>
+/// <remarks>
+/// In contrast to <see cref="sample" />, which returns one tuple per sample,
+/// this function returns a tuple of contiguous vectors, one for each
+/// parameter, which is preferable if the parameters are processed one at a
+/// time. Each column is realised in a separate loop over the rows of the
+/// unit hypercube sample.
+/// </remarks>
+/// <typeparam name="TLhsGenerator">The type of the generator function that
+/// creates a stratified Latin unit hypercube sample.</typeparam>
+/// <typeparam name="TParameters">The type of the parameters, which can either
+/// be enumerated categorical parameters or numeric ranges.</typeparam>
+/// <param name="lhs_generator">The generator producing the Latin hypercube
+/// sample on a unit hypercube, which will subsequently be transformed into
+/// specific parameter expressions. The number of rows returned by the function
+/// determines the number of samples selected. The function receives the number
+/// of parameters as input, which must be the number of columns in the matrix
+/// returned.</param>
+/// <param name="parameters">The parameters of the sample.</param>
+/// <returns>The actual parameter expressions for the sample, where the
+/// <c>i</c>-th vector holds the expressions of the <c>i</c>-th parameter.
+/// </returns>
+template<class TLhsGenerator, class... TParameters>
+detail::column_sample_type_t<TParameters...> sample_columns(
+    _In_ TLhsGenerator lhs_generator, _In_ const TParameters&... parameters);
+
+/// <summary>
+/// Create a list of Latin Hypercube samples for the given parameter ranges
+/// using multiple threads.
+/// </summary>
+/// <remarks>
+/// The result is the same as for <see cref="sample" />. The output is
+/// allocated up front and disjoint blocks of rows are realised into it
+/// concurrently. The generator itself is only invoked once on the calling
+/// thread.
+/// </remarks>
+/// <typeparam name="TLhsGenerator">The type of the generator function that
+/// creates a stratified Latin unit hypercube sample.</typeparam>
+/// <typeparam name="TParameters">The type of the parameters, which can either
+/// be enumerated categorical parameters or numeric ranges.</typeparam>
+/// <param name="threads">The maximum number of threads used to realise the
+/// sample. If zero, the number of threads the hardware supports is used.
+/// </param>
+/// <param name="lhs_generator">The generator producing the Latin hypercube
+/// sample on a unit hypercube. The function receives the number of
+/// parameters as input, which must be the number of columns in the matrix
+/// returned.</param>
+/// <param name="parameters">The parameters of the sample.</param>
+/// <returns>The actual parameter expressions for the sample.</returns>
+template<class TLhsGenerator, class... TParameters>
+std::vector<detail::sample_type_t<TParameters...>> parallel_sample(
+    _In_ const std::size_t threads,
+    _In_ TLhsGenerator lhs_generator,
+    _In_ const TParameters&... parameters);
+
+/// <summary>
+/// Create a Latin Hypercube sample for the given parameter ranges, store it
+/// as one column per parameter and use multiple threads to do so.
+/// </summary>
+/// <remarks>
+/// The result is the same as for <see cref="sample_columns" />. The columns
+/// are allocated up front and disjoint blocks of rows are realised into them
+/// concurrently.
+/// </remarks>
+/// <typeparam name="TLhsGenerator">The type of the generator function that
+/// creates a stratified Latin unit hypercube sample.</typeparam>
+/// <typeparam name="TParameters">The type of the parameters, which can either
+/// be enumerated categorical parameters or numeric ranges.</typeparam>
+/// <param name="threads">The maximum number of threads used to realise the
+/// sample. If zero, the number of threads the hardware supports is used.
+/// </param>
+/// <param name="lhs_generator">The generator producing the Latin hypercube
+/// sample on a unit hypercube. The function receives the number of
+/// parameters as input, which must be the number of columns in the matrix
+/// returned.</param>
+/// <param name="parameters">The parameters of the sample.</param>
+/// <returns>The actual parameter expressions for the sample, where the
+/// <c>i</c>-th vector holds the expressions of the <c>i</c>-th parameter.
+/// </returns>
+template<class TLhsGenerator, class... TParameters>
+detail::column_sample_type_t<TParameters...> parallel_sample_columns(
+    _In_ const std::size_t threads,
+    _In_ TLhsGenerator lhs_generator,
+    _In_ const TParameters&... parameters);
+
+/// <summary>
+/// Create Latin Hypercube samples for the given parameter ranges and pass
+/// them to <paramref name="sink" /> in batches.
+/// </summary>
+/// <remarks>
+/// <para>In contrast to <see cref="sample" />, the realised samples are not
+/// collected, but only a buffer for <paramref name="batch_size" /> samples is
+/// allocated. Whenever the buffer is full, and once for the remaining
+/// samples at the end, the sink is invoked with a view of the buffer. The
+/// sink may move the samples out of the view, for instance to hand them to
+/// another thread, because the buffer is cleared before it is filled
+/// again.</para>
+/// <para>Exceptions thrown by the sink are propagated to the caller and
+/// abort the realisation of the remaining samples.</para>
+/// </remarks>
+/// <typeparam name="TSink">The type of the sink, which must be invocable
+/// with a <see cref="vector_view" /> of the realised samples.</typeparam>
+/// <typeparam name="TLhsGenerator">The type of the generator function that
+/// creates a stratified Latin unit hypercube sample.</typeparam>
+/// <typeparam name="TParameters">The type of the parameters, which can either
+/// be enumerated categorical parameters or numeric ranges.</typeparam>
+/// <param name="sink">The sink receiving the batches of samples. The view
+/// passed to the sink is only valid during the call.</param>
+/// <param name="batch_size">The maximum number of samples passed to the
+/// sink at once, which must be at least one.</param>
+/// <param name="lhs_generator">The generator producing the Latin hypercube
+/// sample on a unit hypercube. The function receives the number of
+/// parameters as input, which must be the number of columns in the matrix
+/// returned.</param>
+/// <param name="parameters">The parameters of the sample.</param>
+/// <returns>The total number of samples passed to the sink.</returns>
+/// <exception cref="std::invalid_argument">If
+/// <paramref name="batch_size" /> is zero or if the number of columns in the
+/// sample produced by the generator does not match the number of parameters.
+/// </exception>
+template<class TSink, class TLhsGenerator, class... TParameters>
+std::size_t sample_into(_In_ TSink&& sink,
+    _In_ const std::size_t batch_size,
+    _In_ TLhsGenerator lhs_generator,
+    _In_ const TParameters&... parameters);
+
 LHS_NAMESPACE_END
 
 
 LHS_DETAIL_NAMESPACE_BEGIN
 
+/// <summary>
+/// The number of rows that are realised as a unit by
+/// <see cref="parallel_sample" /> and <see cref="parallel_sample_columns" />.
+/// </summary>
+/// <remarks>
+/// The block size is a multiple of 64 such that concurrently realised blocks
+/// never share a word of a <c>std::vector&lt;bool&gt;</c>.
+/// </remarks>
+constexpr const std::size_t sample_block_size = 4096;
+
+/// <summary>
+/// Resizes <paramref name="dst" /> to hold <paramref name="size" />
+/// elements that can subsequently be overwritten concurrently.
+/// </summary>
+/// <remarks>
+/// If <typeparamref name="TValue" /> cannot be default-constructed, which is
+/// the case for the references realised from a
+/// <see cref="categorical" /> parameter, all elements are initialised with
+/// the result of <paramref name="prototype" />.
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements.</typeparam>
+/// <typeparam name="TPrototype">The type of a function without parameters
+/// creating a valid element.</typeparam>
+/// <param name="dst">The vector to be resized.</param>
+/// <param name="size">The number of elements.</param>
+/// <param name="prototype">A function creating a valid element, which is
+/// only called if required.</param>
+template<class TValue, class TPrototype>
+inline void presize(_Inout_ std::vector<TValue>& dst,
+        _In_ const std::size_t size,
+        _In_ TPrototype&& prototype) {
+    if constexpr (std::is_default_constructible_v<TValue>) {
+        dst.resize(size);
+    } else if (size > 0) {
+        dst.assign(size, prototype());
+    } else {
+        dst.clear();
+    }
+}
+
+/// <summary>
+/// Realise all sample values in <paramref name="values" /> for
+/// <paramref name="parameter" /> and append them to
+/// <paramref name="column" />.
+/// </summary>
+/// <typeparam name="TValue">A floating-point type.</typeparam>
+/// <typeparam name="TParameter">The type of the parameter, which can either
+/// be an enumerated categorical parameter or a numeric range.</typeparam>
+/// <param name="column">The vector receiving the parameter expressions.
+/// </param>
+/// <param name="values">The sample values within [0, 1].</param>
+/// <param name="parameter">The parameter to be realised.</param>
+template<class TValue, class TParameter>
+inline void realise_column(
+        _Inout_ std::vector<sample_value_type_t<TParameter>>& column,
+        _In_ const vector_view<TValue> values,
+        _In_ const TParameter& parameter) {
+    typedef sample_value_type<TParameter> current_parameter;
+    static_assert(std::is_floating_point_v<std::remove_cv_t<TValue>>,
+        "The sample value must be a floating-point number witin [0, 1].");
+    column.reserve(column.size() + values.size());
+    for (const auto v : values) {
+        column.push_back(current_parameter::realise(v, parameter));
+    }
+}
+
+/// <summary>
+/// Realise the rows <paramref name="begin" /> to <paramref name="end" /> of
+/// <paramref name="values" /> for <paramref name="parameter" /> and
+/// overwrite the respective elements of <paramref name="column" />, which
+/// must have been resized before.
+/// </summary>
+template<class TValue, class TParameter>
+inline void realise_column(
+        _Inout_ std::vector<sample_value_type_t<TParameter>>& column,
+        _In_ const vector_view<TValue> values,
+        _In_ const std::size_t begin,
+        _In_ const std::size_t end,
+        _In_ const TParameter& parameter) {
+    typedef sample_value_type<TParameter> current_parameter;
+    assert(column.size() == values.size());
+    assert(end <= values.size());
+    for (std::size_t r = begin; r < end; ++r) {
+        column[r] = current_parameter::realise(values[r], parameter);
+    }
+}
+
+/// <summary>
+/// Realise the columns of <paramref name="lhs" /> for all
+/// <paramref name="parameters" />.
+/// </summary>
+template<class TMatrix, std::size_t... Indices, class... TParameters>
+inline void realise_columns(
+        _Inout_ column_sample_type_t<TParameters...>& columns,
+        _In_ const TMatrix& lhs,
+        _In_ std::index_sequence<Indices...>,
+        _In_ const TParameters&... parameters) {
+    (realise_column(std::get<Indices>(columns), column_view(lhs, Indices),
+        parameters), ...);
+}
+
+/// <summary>
+/// Allocates the columns for all <paramref name="parameters" /> and then
+/// realises the rows of <paramref name="lhs" /> in blocks of
+/// <see cref="sample_block_size" /> on up to <paramref name="threads" />
+/// threads.
+/// </summary>
+template<class TMatrix, std::size_t... Indices, class... TParameters>
+void realise_columns(
+        _Inout_ column_sample_type_t<TParameters...>& columns,
+        _In_ const TMatrix& lhs,
+        _In_ const std::size_t threads,
+        _In_ std::index_sequence<Indices...>,
+        _In_ const TParameters&... parameters) {
+    const auto n = lhs.rows();
+
+    (presize(std::get<Indices>(columns), n, [&lhs, &parameters]() {
+        typedef sample_value_type<TParameters> current_parameter;
+        return current_parameter::realise(lhs(0, Indices), parameters);
+    }), ...);
+
+    const auto blocks = (n + sample_block_size - 1) / sample_block_size;
+    parallel_for(0, blocks, [&](const std::size_t b, const std::size_t e) {
+        const auto begin = b * sample_block_size;
+        const auto end = (std::min)(e * sample_block_size, n);
+        (realise_column(std::get<Indices>(columns), column_view(lhs, Indices),
+            begin, end, parameters), ...);
+    }, threads);
+}
+
 /// <summary>
 /// Realise the <paramref name="parameter" /> expression based on the given
 /// sample value.
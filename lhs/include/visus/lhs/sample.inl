@@ -25,10 +25,140 @@ LHS_NAMESPACE::sample(_In_ TLhsGenerator lhs_generator,
     retval.reserve(lhs.rows());
 
     for (std::size_t i = 0; i < lhs.rows(); ++i) {
-        auto b = lhs.begin_row(i);
-        auto e = lhs.end_row(i);
-        retval.push_back(detail::realise_parameters(b, e, parameters...));
+        const auto row = row_view(lhs, i);
+        retval.push_back(detail::realise_parameters(row.begin(), row.end(),
+            parameters...));
     }
 
     return retval;
 }
+
+
+/*
+ * LHS_NAMESPACE::sample_columns
+ */
+template<class TLhsGenerator, class... TParameters>
+LHS_DETAIL_NAMESPACE::column_sample_type_t<TParameters...>
+LHS_NAMESPACE::sample_columns(_In_ TLhsGenerator lhs_generator,
+        _In_ const TParameters&... parameters) {
+    auto lhs = lhs_generator(sizeof...(parameters));
+    ASSERT_VALID_LHS(lhs);
+
+    if (lhs.columns() != sizeof...(parameters)) {
+        throw std::invalid_argument("The number of columns in the Latin "
+            "hypercube sample produced by the generator callback does not "
+            "match the number of parameters.");
+    }
+
+    detail::column_sample_type_t<TParameters...> retval;
+    detail::realise_columns(retval, lhs,
+        std::index_sequence_for<TParameters...>(), parameters...);
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::parallel_sample
+ */
+template<class TLhsGenerator, class... TParameters>
+std::vector<LHS_DETAIL_NAMESPACE::sample_type_t<TParameters...>>
+LHS_NAMESPACE::parallel_sample(_In_ const std::size_t threads,
+        _In_ TLhsGenerator lhs_generator,
+        _In_ const TParameters&... parameters) {
+    auto lhs = lhs_generator(sizeof...(parameters));
+    ASSERT_VALID_LHS(lhs);
+
+    if (lhs.columns() != sizeof...(parameters)) {
+        throw std::invalid_argument("The number of columns in the Latin "
+            "hypercube sample produced by the generator callback does not "
+            "match the number of parameters.");
+    }
+
+    const auto realise = [&lhs, &parameters...](const std::size_t r) {
+        const auto row = row_view(lhs, r);
+        return detail::realise_parameters(row.begin(), row.end(),
+            parameters...);
+    };
+
+    const auto n = lhs.rows();
+    std::vector<detail::sample_type_t<TParameters...>> retval;
+    detail::presize(retval, n, [&realise]() { return realise(0); });
+
+    const auto blocks = (n + detail::sample_block_size - 1)
+        / detail::sample_block_size;
+    detail::parallel_for(0, blocks, [&](const std::size_t b,
+            const std::size_t e) {
+        const auto end = (std::min)(e * detail::sample_block_size, n);
+        for (auto r = b * detail::sample_block_size; r < end; ++r) {
+            retval[r] = realise(r);
+        }
+    }, threads);
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::parallel_sample_columns
+ */
+template<class TLhsGenerator, class... TParameters>
+LHS_DETAIL_NAMESPACE::column_sample_type_t<TParameters...>
+LHS_NAMESPACE::parallel_sample_columns(_In_ const std::size_t threads,
+        _In_ TLhsGenerator lhs_generator,
+        _In_ const TParameters&... parameters) {
+    auto lhs = lhs_generator(sizeof...(parameters));
+    ASSERT_VALID_LHS(lhs);
+
+    if (lhs.columns() != sizeof...(parameters)) {
+        throw std::invalid_argument("The number of columns in the Latin "
+            "hypercube sample produced by the generator callback does not "
+            "match the number of parameters.");
+    }
+
+    detail::column_sample_type_t<TParameters...> retval;
+    detail::realise_columns(retval, lhs, threads,
+        std::index_sequence_for<TParameters...>(), parameters...);
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::sample_into
+ */
+template<class TSink, class TLhsGenerator, class... TParameters>
+std::size_t LHS_NAMESPACE::sample_into(_In_ TSink&& sink,
+        _In_ const std::size_t batch_size,
+        _In_ TLhsGenerator lhs_generator,
+        _In_ const TParameters&... parameters) {
+    typedef detail::sample_type_t<TParameters...> value_type;
+
+    if (batch_size < 1) {
+        throw std::invalid_argument("The batch size must be at least one.");
+    }
+
+    auto lhs = lhs_generator(sizeof...(parameters));
+    ASSERT_VALID_LHS(lhs);
+
+    if (lhs.columns() != sizeof...(parameters)) {
+        throw std::invalid_argument("The number of columns in the Latin "
+            "hypercube sample produced by the generator callback does not "
+            "match the number of parameters.");
+    }
+
+    const auto n = lhs.rows();
+    std::vector<value_type> batch;
+    batch.reserve((std::min)(batch_size, n));
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const auto row = row_view(lhs, i);
+        batch.push_back(detail::realise_parameters(row.begin(), row.end(),
+            parameters...));
+
+        if ((batch.size() == batch_size) || (i == n - 1)) {
+            sink(vector_view<value_type>(batch.data(), batch.size()));
+            batch.clear();
+        }
+    }
+
+    return n;
+}
@@ -0,0 +1,285 @@
+﻿// <copyright file="sample_iterator.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_SAMPLE_ITERATOR_H)
+#define _LHS_SAMPLE_ITERATOR_H
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+
+#include "visus/lhs/api.h"
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A random-access iterator over the samples of a
+/// <see cref="sample_view" />, which realises the parameter expressions of a
+/// sample when it is dereferenced.
+/// </summary>
+/// <remarks>
+/// As the samples are created on the fly, dereferencing the iterator yields
+/// a value rather than a reference.
+/// </remarks>
+/// <typeparam name="TView">The type of the sample view.</typeparam>
+template<class TView> class sample_iterator final {
+
+public:
+
+    /// <summary>
+    /// The type to express the distance between two iterators.
+    /// </summary>
+    typedef std::ptrdiff_t difference_type;
+
+    /// <summary>
+    /// The category of the iterator.
+    /// </summary>
+    typedef std::random_access_iterator_tag iterator_category;
+
+    /// <summary>
+    /// The iterator does not provide pointers to the samples.
+    /// </summary>
+    typedef void pointer;
+
+    /// <summary>
+    /// The type of a realised sample.
+    /// </summary>
+    typedef typename TView::value_type value_type;
+
+    /// <summary>
+    /// The result of dereferencing the iterator, which is a realised sample.
+    /// </summary>
+    typedef value_type reference;
+
+    /// <summary>
+    /// The type of the view the iterator enumerates.
+    /// </summary>
+    typedef TView view_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="view">The view to enumerate. The iterator is invalidated
+    /// if the view is destroyed or moved.</param>
+    /// <param name="position">The zero-based index of the sample the iterator
+    /// initially points to.</param>
+    inline explicit sample_iterator(_In_opt_ const view_type *view = nullptr,
+            _In_ const std::size_t position = 0) noexcept
+        : _position(position), _view(view) { }
+
+    /// <summary>
+    /// Answer the zero-based index of the sample the iterator points to.
+    /// </summary>
+    /// <returns>The position of the iterator.</returns>
+    inline std::size_t position(void) const noexcept {
+        return this->_position;
+    }
+
+    /// <summary>
+    /// Realises the current sample.
+    /// </summary>
+    /// <returns>The parameter expressions of the current sample.</returns>
+    inline reference operator *(void) const {
+        assert(this->_view != nullptr);
+        return (*this->_view)[this->_position];
+    }
+
+    /// <summary>
+    /// Realises the sample <paramref name="offset" /> positions away from the
+    /// current one.
+    /// </summary>
+    /// <param name="offset">The offset in number of samples.</param>
+    /// <returns>The parameter expressions of the sample at the specified
+    /// offset.</returns>
+    inline reference operator [](_In_ const difference_type offset) const {
+        return *(*this + offset);
+    }
+
+    /// <summary>
+    /// Prefix increment.
+    /// </summary>
+    /// <returns>The iterator after it has been advanced.</returns>
+    inline sample_iterator& operator ++(void) noexcept {
+        ++this->_position;
+        return *this;
+    }
+
+    /// <summary>
+    /// Postfix increment.
+    /// </summary>
+    /// <returns>The iterator before it has been advanced.</returns>
+    inline sample_iterator operator ++(int) noexcept {
+        auto retval = *this;
+        ++(*this);
+        return retval;
+    }
+
+    /// <summary>
+    /// Prefix decrement.
+    /// </summary>
+    /// <returns>The iterator after it has been moved back.</returns>
+    inline sample_iterator& operator --(void) noexcept {
+        --this->_position;
+        return *this;
+    }
+
+    /// <summary>
+    /// Postfix decrement.
+    /// </summary>
+    /// <returns>The iterator before it has been moved back.</returns>
+    inline sample_iterator operator --(int) noexcept {
+        auto retval = *this;
+        --(*this);
+        return retval;
+    }
+
+    /// <summary>
+    /// Advances the iterator by <paramref name="offset" /> samples.
+    /// </summary>
+    /// <param name="offset">The number of samples to advance.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline sample_iterator& operator +=(
+            _In_ const difference_type offset) noexcept {
+        this->_position += offset;
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the iterator back by <paramref name="offset" /> samples.
+    /// </summary>
+    /// <param name="offset">The number of samples to move back.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline sample_iterator& operator -=(
+            _In_ const difference_type offset) noexcept {
+        this->_position -= offset;
+        return *this;
+    }
+
+    /// <summary>
+    /// Answer an iterator <paramref name="offset" /> samples ahead.
+    /// </summary>
+    /// <param name="offset">The number of samples to advance.</param>
+    /// <returns>The advanced iterator.</returns>
+    inline sample_iterator operator +(
+            _In_ const difference_type offset) const noexcept {
+        auto retval = *this;
+        return (retval += offset);
+    }
+
+    /// <summary>
+    /// Answer an iterator <paramref name="offset" /> samples back.
+    /// </summary>
+    /// <param name="offset">The number of samples to move back.</param>
+    /// <returns>The moved iterator.</returns>
+    inline sample_iterator operator -(
+            _In_ const difference_type offset) const noexcept {
+        auto retval = *this;
+        return (retval -= offset);
+    }
+
+    /// <summary>
+    /// Answer the number of samples between <paramref name="rhs" /> and this
+    /// iterator.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand, which must iterate the
+    /// same view.</param>
+    /// <returns>The distance between the iterators in samples.</returns>
+    inline difference_type operator -(
+            _In_ const sample_iterator& rhs) const noexcept {
+        assert(this->_view == rhs._view);
+        return static_cast<difference_type>(this->_position)
+            - static_cast<difference_type>(rhs._position);
+    }
+
+    /// <summary>
+    /// Test for equality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if both iterators designate the same sample,
+    /// <c>false</c> otherwise.</returns>
+    inline bool operator ==(_In_ const sample_iterator& rhs) const noexcept {
+        assert(this->_view == rhs._view);
+        return (this->_position == rhs._position);
+    }
+
+    /// <summary>
+    /// Test for inequality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if the iterators designate different samples,
+    /// <c>false</c> otherwise.</returns>
+    inline bool operator !=(_In_ const sample_iterator& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is before <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is before
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator <(_In_ const sample_iterator& rhs) const noexcept {
+        assert(this->_view == rhs._view);
+        return (this->_position < rhs._position);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is before or at <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is not after
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator <=(_In_ const sample_iterator& rhs) const noexcept {
+        return !(rhs < *this);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is after <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is after
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator >(_In_ const sample_iterator& rhs) const noexcept {
+        return (rhs < *this);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is after or at <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is not before
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator >=(_In_ const sample_iterator& rhs) const noexcept {
+        return !(*this < rhs);
+    }
+
+private:
+
+    std::size_t _position;
+    const view_type *_view;
+};
+
+
+/// <summary>
+/// Answer an iterator <paramref name="offset" /> samples ahead of
+/// <paramref name="it" />.
+/// </summary>
+/// <typeparam name="TView">The type of the sample view.</typeparam>
+/// <param name="offset">The number of samples to advance.</param>
+/// <param name="it">The iterator to be advanced.</param>
+/// <returns>The advanced iterator.</returns>
+template<class TView>
+inline sample_iterator<TView> operator +(
+        _In_ const typename sample_iterator<TView>::difference_type offset,
+        _In_ const sample_iterator<TView>& it) noexcept {
+    return (it + offset);
+}
+
+LHS_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_LHS_SAMPLE_ITERATOR_H) */
@@ -9,14 +9,20 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <initializer_list>
+#include <iterator>
 #include <list>
 #include <set>
 #include <tuple>
 #include <type_traits>
 #include <vector>
 
+#include "visus/lhs/categorical.h"
+#include "visus/lhs/distributions.h"
 #include "visus/lhs/range.h"
+#include "visus/lhs/range_scaler.h"
+#include "visus/lhs/transformed_range.h"
 #include "visus/lhs/scale.h"
 
 
@@ -55,6 +61,43 @@ template<class TParameter> struct sample_value_type final {
     }
 };
 
+/// <summary>
+/// Realises parameters described by a distribution by applying its inverse
+/// cumulative distribution function to the sample value.
+/// </summary>
+/// <typeparam name="TDistribution">The type of the distribution, which must
+/// provide a <c>quantile</c> function.</typeparam>
+template<class TDistribution> struct distribution_sample_value_type {
+
+    /// <summary>
+    /// The user-specified distribution of the parameter.
+    /// </summary>
+    typedef TDistribution input_type;
+
+    /// <summary>
+    /// The type of the parameter in the sample.
+    /// </summary>
+    typedef typename TDistribution::value_type type;
+
+    /// <summary>
+    /// Realises the parameter based on the given sample value.
+    /// </summary>
+    /// <typeparam name="TValue">The sample value, which must be a
+    /// floating-point number.</typeparam>
+    /// <param name="value">The sample value within [0, 1]. Zero and one are
+    /// moved into the open interval, because they would be realised as
+    /// infinity by unbounded distributions.</param>
+    /// <param name="parameter">The distribution of the parameter.</param>
+    /// <returns>The quantile of <paramref name="value" />.</returns>
+    template<class TValue> inline static std::enable_if_t<
+        std::is_floating_point_v<TValue>, type>
+    realise(_In_ const TValue value, _In_ const input_type& parameter) {
+        assert(value >= static_cast<TValue>(0));
+        assert(value <= static_cast<TValue>(1));
+        return parameter.quantile(open_probability(static_cast<type>(value)));
+    }
+};
+
 /// <summary>
 /// Specialisation for a categorical parameter in an
 /// <see cref="std::array{TParameter, Count}"/>.
@@ -74,6 +117,20 @@ struct sample_value_type<std::array<TParameter, Count>> final {
     }
 };
 
+/// <summary>
+/// Specialisation for a beta-distributed parameter.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<beta_distribution<TParameter>> final
+    : distribution_sample_value_type<beta_distribution<TParameter>> { };
+
+/// <summary>
+/// Specialisation for a parameter following an empirical distribution.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<empirical_distribution<TParameter>> final
+    : distribution_sample_value_type<empirical_distribution<TParameter>> { };
+
 /// <summary>
 /// Specialisation for a categorical parameter in an
 /// <see cref="std::initializer_list{TParameter, Count}"/>.
@@ -104,10 +161,26 @@ struct sample_value_type<std::list<TParameter>> final {
     template<class TValue> inline static constexpr std::enable_if_t<
         std::is_floating_point_v<TValue>, type>
     realise(_In_ const TValue value, _In_ const input_type& parameter) {
-        return parameter[scale(value, parameter.size())];
+        auto it = parameter.begin();
+        std::advance(it, scale(value, parameter.size()));
+        return *it;
     }
 };
 
+/// <summary>
+/// Specialisation for a log-normally distributed parameter.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<lognormal_distribution<TParameter>> final
+    : distribution_sample_value_type<lognormal_distribution<TParameter>> { };
+
+/// <summary>
+/// Specialisation for a normally distributed parameter.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<normal_distribution<TParameter>> final
+    : distribution_sample_value_type<normal_distribution<TParameter>> { };
+
 /// <summary>
 /// Specialisation for a numerical range.
 /// </summary>
@@ -136,7 +209,81 @@ template<class TParameter> struct sample_value_type<std::set<TParameter>> final
     template<class TValue> inline static constexpr std::enable_if_t<
         std::is_floating_point_v<TValue>, type>
     realise(_In_ const TValue value, _In_ const input_type& parameter) {
-        return parameter.begin() + scale(value, parameter.size());
+        auto it = parameter.begin();
+        std::advance(it, scale(value, parameter.size()));
+        return *it;
+    }
+};
+
+/// <summary>
+/// Specialisation for a <see cref="categorical{TParameter}" /> parameter,
+/// which realises references into its dictionary instead of copies.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<categorical<TParameter>> final {
+    typedef categorical<TParameter> input_type;
+    typedef std::reference_wrapper<const TParameter> type;
+
+    template<class TValue> inline static std::enable_if_t<
+        std::is_floating_point_v<TValue>, type>
+    realise(_In_ const TValue value, _In_ const input_type& parameter) {
+        return std::cref(parameter[scale(value, parameter.size())]);
+    }
+};
+
+/// <summary>
+/// Specialisation for a numerical range that is sampled uniformly after
+/// applying a monotone transform, for instance a logarithmic range.
+/// </summary>
+template<class TParameter, class TTransform>
+struct sample_value_type<transformed_range<TParameter, TTransform>> final {
+    typedef transformed_range<TParameter, TTransform> input_type;
+    typedef TParameter type;
+
+    template<class TValue> inline static std::enable_if_t<
+        std::is_floating_point_v<TValue>, type>
+    realise(_In_ const TValue value, _In_ const input_type& parameter) {
+        typedef typename input_type::transformed_type float_type;
+        assert(value >= static_cast<TValue>(0));
+        assert(value <= static_cast<TValue>(1));
+        const range_scaler<input_type, float_type> scaler(parameter);
+        const auto retval = scaler(static_cast<float_type>(value));
+        if constexpr (std::is_floating_point_v<type>) {
+            return retval;
+        } else {
+            return static_cast<type>(retval + static_cast<float_type>(0.5));
+        }
+    }
+};
+
+/// <summary>
+/// Specialisation for a parameter following a triangular distribution.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<triangular_distribution<TParameter>> final
+    : distribution_sample_value_type<triangular_distribution<TParameter>> { };
+
+/// <summary>
+/// Specialisation for a parameter following a truncated distribution.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<truncated_distribution<TParameter>> final
+    : distribution_sample_value_type<truncated_distribution<TParameter>> { };
+
+/// <summary>
+/// Specialisation for a <see cref="weighted_categorical{TParameter}" />
+/// parameter, which selects the expression in constant time from the
+/// precomputed table of the parameter.
+/// </summary>
+template<class TParameter>
+struct sample_value_type<weighted_categorical<TParameter>> final {
+    typedef weighted_categorical<TParameter> input_type;
+    typedef std::reference_wrapper<const TParameter> type;
+
+    template<class TValue> inline static std::enable_if_t<
+        std::is_floating_point_v<TValue>, type>
+    realise(_In_ const TValue value, _In_ const input_type& parameter) {
+        return std::cref(parameter[parameter.select(value)]);
     }
 };
 
@@ -190,6 +337,26 @@ template<class... TParameters> struct sample_type final {
 template<class... TParameters>
 using sample_type_t = typename sample_type<TParameters...>::type;
 
+
+/// <summary>
+/// Derives the type of a sample stored by columns from the list of
+/// parameters.
+/// </summary>
+/// <typeparam name="TParameters">The list of parameters, which must be
+/// resolvable individually using <see cref="sample_type_type_t{TParameter}" />.
+/// </typeparam>
+template<class... TParameters> struct column_sample_type final {
+
+    /// <summary>
+    /// The type of a sample stored as one contiguous column per parameter.
+    /// </summary>
+    typedef std::tuple<std::vector<sample_value_type_t<TParameters>>...> type;
+};
+
+
+template<class... TParameters>
+using column_sample_type_t = typename column_sample_type<TParameters...>::type;
+
 LHS_DETAIL_NAMESPACE_END
 
 #endif /* !defined(_LHS_SAMPLE_TYPE_H) */
@@ -0,0 +1,173 @@
+﻿// <copyright file="sample_view.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_SAMPLE_VIEW_H)
+#define _LHS_SAMPLE_VIEW_H
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "visus/lhs/sample.h"
+#include "visus/lhs/sample_iterator.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// A lazy view of a Latin hypercube sample, which realises the parameter
+/// expressions of a sample only when it is accessed.
+/// </summary>
+/// <remarks>
+/// <para>The view owns the unit hypercube sample and a copy of the
+/// parameters. In contrast to <see cref="sample" />, no realised samples are
+/// stored, which is useful if the samples are only streamed to their
+/// consumers. The view supports random access, so disjoint slices can be
+/// processed independently, for instance by multiple threads.</para>
+/// <para>Parameters of type <c>std::initializer_list</c> only reference
+/// their elements, which must therefore outlive the view.</para>
+/// </remarks>
+/// <typeparam name="TMatrix">The type of the unit hypercube sample.
+/// </typeparam>
+/// <typeparam name="TParameters">The type of the parameters, which can either
+/// be enumerated categorical parameters or numeric ranges.</typeparam>
+template<class TMatrix, class... TParameters> class sample_view final {
+
+public:
+
+    /// <summary>
+    /// The type of the iterator over the samples.
+    /// </summary>
+    typedef detail::sample_iterator<sample_view> iterator;
+
+    /// <summary>
+    /// The type of the unit hypercube sample.
+    /// </summary>
+    typedef TMatrix matrix_type;
+
+    /// <summary>
+    /// The type of a realised sample.
+    /// </summary>
+    typedef detail::sample_type_t<TParameters...> value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="lhs">The unit hypercube sample, which must have a column
+    /// for each of the <paramref name="parameters" />.</param>
+    /// <param name="parameters">The parameters of the sample.</param>
+    /// <exception cref="std::invalid_argument">If the number of columns of
+    /// <paramref name="lhs" /> does not match the number of parameters.
+    /// </exception>
+    sample_view(_In_ matrix_type&& lhs, _In_ const TParameters&... parameters);
+
+    sample_view(const sample_view&) = delete;
+
+    sample_view(sample_view&&) = default;
+
+    /// <summary>
+    /// Answer an iterator to the first sample.
+    /// </summary>
+    /// <returns>An iterator to the first sample. The iterator is invalidated
+    /// if the view is destroyed or moved.</returns>
+    inline iterator begin(void) const noexcept {
+        return iterator(this, 0);
+    }
+
+    /// <summary>
+    /// Answer whether the view contains no samples.
+    /// </summary>
+    /// <returns><c>true</c> if the view is empty, <c>false</c> otherwise.
+    /// </returns>
+    inline bool empty(void) const noexcept {
+        return (this->size() == 0);
+    }
+
+    /// <summary>
+    /// Answer an iterator past the last sample.
+    /// </summary>
+    /// <returns>An iterator past the last sample. The iterator is invalidated
+    /// if the view is destroyed or moved.</returns>
+    inline iterator end(void) const noexcept {
+        return iterator(this, this->size());
+    }
+
+    /// <summary>
+    /// Answer the unit hypercube sample the view realises.
+    /// </summary>
+    /// <returns>The unit hypercube sample.</returns>
+    inline const matrix_type& lhs(void) const noexcept {
+        return this->_lhs;
+    }
+
+    /// <summary>
+    /// Answer the number of samples in the view.
+    /// </summary>
+    /// <returns>The number of samples.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_lhs.rows();
+    }
+
+    sample_view& operator =(const sample_view&) = delete;
+
+    sample_view& operator =(sample_view&&) = default;
+
+    /// <summary>
+    /// Realises the sample at the specified position.
+    /// </summary>
+    /// <param name="row">The zero-based index of the sample, which must be
+    /// less than <see cref="size" />.</param>
+    /// <returns>The parameter expressions of the sample.</returns>
+    value_type operator [](_In_ const std::size_t row) const;
+
+private:
+
+    matrix_type _lhs;
+    std::tuple<TParameters...> _parameters;
+};
+
+
+/// <summary>
+/// Create a lazy view of a Latin hypercube sample for the given parameter
+/// ranges.
+/// </summary>
+/// <remarks>
+/// In contrast to <see cref="sample" />, the parameter expressions are not
+/// realised up front, but whenever a sample is accessed through the view.
+/// </remarks>
+/// <typeparam name="TLhsGenerator">The type of the generator function that
+/// creates a stratified Latin unit hypercube sample.</typeparam>
+/// <typeparam name="TParameters">The type of the parameters, which can either
+/// be enumerated categorical parameters or numeric ranges.</typeparam>
+/// <param name="lhs_generator">The generator producing the Latin hypercube
+/// sample on a unit hypercube. The number of rows returned by the function
+/// determines the number of samples selected. The function receives the number
+/// of parameters as input, which must be the number of columns in the matrix
+/// returned.</param>
+/// <param name="parameters">The parameters of the sample.</param>
+/// <returns>A view realising the parameter expressions on demand.</returns>
+/// <exception cref="std::invalid_argument">If the number of columns in the
+/// sample produced by the generator does not match the number of parameters.
+/// </exception>
+template<class TLhsGenerator, class... TParameters>
+inline sample_view<std::decay_t<std::invoke_result_t<TLhsGenerator,
+    std::size_t>>, TParameters...> lazy_sample(
+        _In_ TLhsGenerator lhs_generator,
+        _In_ const TParameters&... parameters) {
+    return sample_view<std::decay_t<std::invoke_result_t<TLhsGenerator,
+        std::size_t>>, TParameters...>(
+        lhs_generator(sizeof...(parameters)), parameters...);
+}
+
+LHS_NAMESPACE_END
+
+#include "visus/lhs/sample_view.inl"
+
+#endif /* !defined(_LHS_SAMPLE_VIEW_H) */
@@ -0,0 +1,38 @@
+﻿// <copyright file="sample_view.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::sample_view<TMatrix, TParameters...>::sample_view
+ */
+template<class TMatrix, class... TParameters>
+LHS_NAMESPACE::sample_view<TMatrix, TParameters...>::sample_view(
+        _In_ matrix_type&& lhs,
+        _In_ const TParameters&... parameters)
+    : _lhs(std::move(lhs)), _parameters(parameters...) {
+    ASSERT_VALID_LHS(this->_lhs);
+
+    if (this->_lhs.columns() != sizeof...(TParameters)) {
+        throw std::invalid_argument("The number of columns in the Latin "
+            "hypercube sample does not match the number of parameters.");
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::sample_view<TMatrix, TParameters...>::operator []
+ */
+template<class TMatrix, class... TParameters>
+typename LHS_NAMESPACE::sample_view<TMatrix, TParameters...>::value_type
+LHS_NAMESPACE::sample_view<TMatrix, TParameters...>::operator [](
+        _In_ const std::size_t row) const {
+    assert(row < this->size());
+    const auto values = row_view(this->_lhs, row);
+    return std::apply([&values](const TParameters&... parameters) {
+        return detail::realise_parameters(values.begin(), values.end(),
+            parameters...);
+    }, this->_parameters);
+}
@@ -8,12 +8,15 @@
 #define _LHS_SCALE_H
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 #include <stdexcept>
 
 #include "visus/lhs/is_range.h"
 #include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/range_scaler.h"
 #include "visus/lhs/valid.h"
 
 
@@ -22,6 +25,10 @@ LHS_DETAIL_NAMESPACE_BEGIN
 /// <summary>
 /// Converts a floating-point number in the range [0, 1] to a zero-based index.
 /// </summary>
+/// <remarks>
+/// The unit interval is divided into <paramref name="cnt" /> intervals of
+/// equal width, each of which is mapped to one index.
+/// </remarks>
 /// <typeparam name="TValue">A floating-point type.</typeparam>
 /// <param name="value">A value within [0, 1].</param>
 /// <param name="cnt">The total number of elements, which must be at least one.
@@ -43,6 +50,39 @@ std::enable_if_t<std::is_floating_point_v<TValue>, std::size_t> scale(
 /// matrix elements of <paramref name="lhs" /> at the same time.</typeparam>
 /// <typeparam name="Layout">The matrix layout of <paramref name="lhs" />.
 /// </typeparam>
+/// <param name="lhs">A view of the unit hypercube sample to be scaled. The
+/// number of rows is the number of parameters, which must match the length of
+/// the range <paramref name="begin" /> to <paramref name="end" />.</param>
+/// <param name="begin">The begin of the range of parameter ranges which are
+/// used to scale the distribution.</param>
+/// <param name="end">The end of the range of parameter ranges. The distance
+/// between <paramref name="begin" /> and <paramref name="end" /> must be equal
+/// to the number of parameters (or number of columns in the matrix).</param>
+/// <returns><paramref name="lhs" /> after scaling.</returns>
+template<class TIterator, matrix_layout Layout>
+std::enable_if_t<is_range_v<
+        typename std::iterator_traits<TIterator>::value_type>
+    && std::is_floating_point_v<
+        typename std::iterator_traits<TIterator>::value_type::value_type>,
+    matrix_view<
+        typename std::iterator_traits<TIterator>::value_type::value_type,
+        Layout>>
+scale(_In_ const matrix_view<typename
+    std::iterator_traits<TIterator>::value_type::value_type, Layout> lhs,
+    _In_ const TIterator begin,
+    _In_ const TIterator end);
+
+/// <summary>
+/// Scales the parameters of the given unit hypercube sample to the ranges
+/// defined by the range <paramref name="begin" /> to </paramref name="end" />
+/// in place.
+/// </summary>
+/// <typeparam name="TIterator">An iterator over floating-point
+/// <see cref="range{TValue}" />s. The iterated type must be the type of the
+/// matrix elements of <paramref name="lhs" /> at the same time.</typeparam>
+/// <typeparam name="Layout">The matrix layout of <paramref name="lhs" />.
+/// </typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <param name="lhs">The unit hypercube sample to be scaled. The number of
 /// rows is the number of parameters, which must match the length of the
 /// range <paramref name="begin" /> to <paramref name="end" />.</param>
@@ -52,16 +92,67 @@ std::enable_if_t<std::is_floating_point_v<TValue>, std::size_t> scale(
 /// between <paramref name="begin" /> and <paramref name="end" /> must be equal
 /// to the number of parameters (or number of columns in the matrix).</param>
 /// <returns><paramref name="lhs" /> after scaling.</returns>
-template<class TIterator, matrix_layout Layout>
-std::enable_if_t<is_range_v<
+template<class TIterator, matrix_layout Layout, class TAllocator>
+inline std::enable_if_t<is_range_v<
         typename std::iterator_traits<TIterator>::value_type>
     && std::is_floating_point_v<
         typename std::iterator_traits<TIterator>::value_type::value_type>,
     matrix<
         typename std::iterator_traits<TIterator>::value_type::value_type,
-        Layout>&>
+        Layout, TAllocator>&>
 scale(_Inout_ matrix<typename
-    std::iterator_traits<TIterator>::value_type::value_type, Layout>& lhs,
+        std::iterator_traits<TIterator>::value_type::value_type, Layout,
+        TAllocator>& lhs,
+        _In_ const TIterator begin,
+        _In_ const TIterator end) {
+    typedef typename std::iterator_traits<TIterator>::value_type range_type;
+    typedef typename range_type::value_type value_type;
+    scale(matrix_view<value_type, Layout>(lhs), begin, end);
+    return lhs;
+}
+
+/// <summary>
+/// Scales the parameters of the given unit hypercube sample to the integer
+/// ranges by the range <paramref name="begin" /> to </paramref name="end" />
+/// and writes the result to <paramref name="result" />. The function will
+/// round to the nearest integer value.
+/// </summary>
+/// <typeparam name="TIterator">An iterator over the ranges of of the
+/// parameters. The value iterated here is the type of the matrix elements
+/// of <paramref name="result" /> at the same time.</typeparam>
+/// <typeparam name="RLayout">The matrix layout of <paramref name="result" />.
+/// </typeparam>
+/// <typeparam name="Layout">The matrix layout of <paramref name="lhs" />.
+/// </typeparam>
+/// <typeparam name="TElement">A floating-point type used for the elements of
+/// the unit hypercube sample <paramref name="lhs" />.</typeparam>
+/// <param name="result">A view of the memory receiving the scaled sample,
+/// which must have the same dimensions as <paramref name="lhs" />.</param>
+/// <param name="lhs">The unit hypercube sample to be scaled. The number of
+/// rows is the number of parameters, which must match the length of the
+/// range <paramref name="begin" /> to <paramref name="end" />.</param>
+/// <param name="begin">The begin of the range of parameter ranges which are
+/// used to scale the distribution.</param>
+/// <param name="end">The end of the range of parameter ranges. The distance
+/// between <paramref name="begin" /> and <paramref name="end" /> must be equal
+/// to the number of parameters (or number of columns in the matrix).</param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIterator,
+    matrix_layout RLayout,
+    matrix_layout Layout,
+    class TElement>
+std::enable_if_t<is_range_v<
+        typename std::iterator_traits<TIterator>::value_type>
+    && std::is_integral_v<
+        typename std::iterator_traits<TIterator>::value_type::value_type>
+    && std::is_floating_point_v<TElement>,
+    matrix_view<
+        typename std::iterator_traits<TIterator>::value_type::value_type,
+        RLayout>>
+scale(_In_ const matrix_view<
+        typename std::iterator_traits<TIterator>::value_type::value_type,
+        RLayout> result,
+    _In_ const matrix_view<const TElement, Layout> lhs,
     _In_ const TIterator begin,
     _In_ const TIterator end);
 
@@ -77,6 +168,7 @@ scale(_Inout_ matrix<typename
 /// same layout will be used for the return value.</typeparam>
 /// <typeparam name="TElement">A floating-point type used for the elements of
 /// the unit hypercube sample <paramref name="lhs" />.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <param name="lhs">The unit hypercube sample to be scaled. The number of
 /// rows is the number of parameters, which must match the length of the
 /// range <paramref name="begin" /> to <paramref name="end" />.</param>
@@ -86,15 +178,67 @@ scale(_Inout_ matrix<typename
 /// between <paramref name="begin" /> and <paramref name="end" /> must be equal
 /// to the number of parameters (or number of columns in the matrix).</param>
 /// <returns>A scaled, integer variant of <paramref name="lhs" />.</returns>
-template<class TIterator, matrix_layout Layout, class TElement>
-std::enable_if_t<is_range_v<
+template<class TIterator, matrix_layout Layout, class TElement,
+    class TAllocator>
+inline std::enable_if_t<is_range_v<
         typename std::iterator_traits<TIterator>::value_type>
     && std::is_integral_v<
         typename std::iterator_traits<TIterator>::value_type::value_type>
     && std::is_floating_point_v<TElement>,
     matrix<typename std::iterator_traits<TIterator>::value_type::value_type,
         Layout>>
-scale(_In_ const matrix<TElement, Layout>& lhs,
+scale(_In_ const matrix<TElement, Layout, TAllocator>& lhs,
+        _In_ const TIterator begin,
+        _In_ const TIterator end) {
+    typedef typename std::iterator_traits<TIterator>::value_type range_type;
+    typedef typename range_type::value_type int_type;
+    matrix<int_type, Layout> retval(lhs.rows(), lhs.columns());
+    scale(matrix_view<int_type, Layout>(retval),
+        matrix_view<const TElement, Layout>(lhs),
+        begin,
+        end);
+    return retval;
+}
+
+/// <summary>
+/// Scales the parameters of the given unit hypercube sample to the given 
+/// exclusive integer index ranges specified by <paramref name="begin" /> to
+/// <paramref name="end" /> and writes the result to
+/// <paramref name="result" />.
+/// </summary>
+/// <typeparam name="TIterator">An iterator over the size of the ranges to scale
+/// the parameters to. The value iterated here is the type of the matrix
+/// elements of <paramref name="result" /> at the same time.
+/// </typeparam>
+/// <typeparam name="RLayout">The matrix layout of <paramref name="result" />.
+/// </typeparam>
+/// <typeparam name="Layout">The matrix layout of <paramref name="lhs" />.
+/// </typeparam>
+/// <typeparam name="TElement">A floating-point type used for the elements of
+/// the unit hypercube sample <paramref name="lhs" />.</typeparam>
+/// <param name="result">A view of the memory receiving the scaled sample,
+/// which must have the same dimensions as <paramref name="lhs" />.</param>
+/// <param name="lhs">The unit hypercube sample to be scaled. The number of
+/// rows is the number of parameters, which must match the length of the
+/// range <paramref name="begin" /> to <paramref name="end" />.</param>
+/// <param name="begin">The begin of the range of parameter sizes. The range
+/// from zero up to one before the specified size will be used to scale the
+/// parameter values.</param>
+/// <param name="end">The end of the range of parameter ranges. The distance
+/// between <paramref name="begin" /> and <paramref name="end" /> must be equal
+/// to the number of parameters (or number of columns in the matrix).</param>
+/// <returns><paramref name="result" />.</returns>
+template<class TIterator,
+    matrix_layout RLayout,
+    matrix_layout Layout,
+    class TElement>
+std::enable_if_t<std::is_integral_v<
+        typename std::iterator_traits<TIterator>::value_type>
+    && std::is_floating_point_v<TElement>,
+    matrix_view<typename std::iterator_traits<TIterator>::value_type, RLayout>>
+scale(_In_ const matrix_view<
+        typename std::iterator_traits<TIterator>::value_type, RLayout> result,
+    _In_ const matrix_view<const TElement, Layout> lhs,
     _In_ const TIterator begin,
     _In_ const TIterator end);
 
@@ -111,6 +255,7 @@ scale(_In_ const matrix<TElement, Layout>& lhs,
 /// same layout will be used for the return value.</typeparam>
 /// <typeparam name="TElement">A floating-point type used for the elements of
 /// the unit hypercube sample <paramref name="lhs" />.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <param name="lhs">The unit hypercube sample to be scaled. The number of
 /// rows is the number of parameters, which must match the length of the
 /// range <paramref name="begin" /> to <paramref name="end" />.</param>
@@ -121,14 +266,23 @@ scale(_In_ const matrix<TElement, Layout>& lhs,
 /// between <paramref name="begin" /> and <paramref name="end" /> must be equal
 /// to the number of parameters (or number of columns in the matrix).</param>
 /// <returns>A scaled, integer variant of <paramref name="lhs" />.</returns>
-template<class TIterator, matrix_layout Layout, class TElement>
-std::enable_if_t<std::is_integral_v<
+template<class TIterator, matrix_layout Layout, class TElement,
+    class TAllocator>
+inline std::enable_if_t<std::is_integral_v<
         typename std::iterator_traits<TIterator>::value_type>
     && std::is_floating_point_v<TElement>,
     matrix<typename std::iterator_traits<TIterator>::value_type, Layout>>
-scale(_In_ const matrix<TElement, Layout>& lhs,
-    _In_ const TIterator begin,
-    _In_ const TIterator end);
+scale(_In_ const matrix<TElement, Layout, TAllocator>& lhs,
+        _In_ const TIterator begin,
+        _In_ const TIterator end) {
+    typedef typename std::iterator_traits<TIterator>::value_type int_type;
+    matrix<int_type, Layout> retval(lhs.rows(), lhs.columns());
+    scale(matrix_view<int_type, Layout>(retval),
+        matrix_view<const TElement, Layout>(lhs),
+        begin,
+        end);
+    return retval;
+}
 
 LHS_DETAIL_NAMESPACE_END
 
@@ -0,0 +1,132 @@
+﻿// <copyright file="splitmix.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_SPLITMIX_H)
+#define _LHS_SPLITMIX_H
+#pragma once
+
+#include <cstdint>
+#include <limits>
+
+#include "visus/lhs/api.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// The SplitMix64 pseudo-random number generator, which can be used in
+/// constant expressions.
+/// </summary>
+/// <remarks>
+/// <para>The generator satisfies the requirements of a uniform random bit
+/// generator, wherefore it can be used with the distributions of the STL at
+/// runtime, too. Its state is a single 64-bit integer, which makes it cheap to
+/// copy.</para>
+/// <para>See https://prng.di.unimi.it/splitmix64.c for the reference
+/// implementation.</para>
+/// </remarks>
+class splitmix64 final {
+
+public:
+
+    /// <summary>
+    /// The type of the numbers generated.
+    /// </summary>
+    typedef std::uint64_t result_type;
+
+    /// <summary>
+    /// The default seed of the generator.
+    /// </summary>
+    static constexpr result_type default_seed = 0;
+
+    /// <summary>
+    /// Answer the largest number the generator can produce.
+    /// </summary>
+    /// <returns>The largest number that can be generated.</returns>
+    static inline constexpr result_type (max)(void) noexcept {
+        return (std::numeric_limits<result_type>::max)();
+    }
+
+    /// <summary>
+    /// Answer the smallest number the generator can produce.
+    /// </summary>
+    /// <returns>The smallest number that can be generated.</returns>
+    static inline constexpr result_type (min)(void) noexcept {
+        return (std::numeric_limits<result_type>::min)();
+    }
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="seed">The initial state of the generator.</param>
+    inline constexpr explicit splitmix64(
+        _In_ const result_type seed = default_seed) noexcept
+        : _state(seed) { }
+
+    /// <summary>
+    /// Advances the state of the generator by <paramref name="count" />
+    /// numbers.
+    /// </summary>
+    /// <param name="count">The number of values to be skipped.</param>
+    inline constexpr void discard(_In_ unsigned long long count) noexcept {
+        this->_state += static_cast<result_type>(count) * increment;
+    }
+
+    /// <summary>
+    /// Resets the state of the generator.
+    /// </summary>
+    /// <param name="seed">The new state of the generator.</param>
+    inline constexpr void seed(
+            _In_ const result_type seed = default_seed) noexcept {
+        this->_state = seed;
+    }
+
+    /// <summary>
+    /// Generates the next number.
+    /// </summary>
+    /// <returns>A pseudo-random number.</returns>
+    inline constexpr result_type operator ()(void) noexcept {
+        auto retval = (this->_state += increment);
+        retval = (retval ^ (retval >> 30)) * 0xbf58476d1ce4e5b9ull;
+        retval = (retval ^ (retval >> 27)) * 0x94d049bb133111ebull;
+        return retval ^ (retval >> 31);
+    }
+
+    /// <summary>
+    /// Test for equality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if both generators will produce the same
+    /// sequence, <c>false</c> otherwise.</returns>
+    inline constexpr bool operator ==(
+            _In_ const splitmix64& rhs) const noexcept {
+        return (this->_state == rhs._state);
+    }
+
+    /// <summary>
+    /// Test for inequality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if the generators will produce different
+    /// sequences, <c>false</c> otherwise.</returns>
+    inline constexpr bool operator !=(
+            _In_ const splitmix64& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+private:
+
+    /// <summary>
+    /// The golden-ratio increment of the state.
+    /// </summary>
+    static constexpr result_type increment = 0x9e3779b97f4a7c15ull;
+
+    result_type _state;
+};
+
+LHS_NAMESPACE_END
+
+#endif /* !defined(_LHS_SPLITMIX_H) */
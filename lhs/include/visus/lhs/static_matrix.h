@@ -0,0 +1,374 @@
+﻿// <copyright file="static_matrix.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_STATIC_MATRIX_H)
+#define _LHS_STATIC_MATRIX_H
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+
+#include "visus/lhs/matrix_layout.h"
+#include "visus/lhs/matrix_view.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// A matrix with dimensions known at compile time, which stores its elements
+/// inline rather than on the heap.
+/// </summary>
+/// <remarks>
+/// <para>This matrix is intended for tiny designs that are created very
+/// often, for instance in the inner loops of local refinements. Creating such
+/// a matrix does not allocate any memory and the generators use the
+/// compile-time dimensions for their working buffers, too, wherefore creating
+/// a sample in a static matrix is allocation-free.</para>
+/// <para>The matrix converts into a <see cref="matrix_view" />. Note that
+/// the conversion is not considered when deducing template arguments, so
+/// the view must be created explicitly for functions that only accept views.
+/// The generators and metrics of the library have overloads for static
+/// matrices.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type used to store a scalar.</typeparam>
+/// <typeparam name="Rows">The number of rows in the matrix.</typeparam>
+/// <typeparam name="Columns">The number of columns in the matrix.</typeparam>
+/// <typeparam name="Layout">The memory layout used by the matrix.</typeparam>
+template<class TValue,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout = matrix_layout::row_major>
+class static_matrix final {
+
+    /// <summary>
+    /// The type of the inline storage.
+    /// </summary>
+    typedef std::array<TValue, Rows * Columns> storage_type;
+
+public:
+
+    /// <summary>
+    /// An iterator over the in-memory representation of the matrix.
+    /// </summary>
+    typedef typename storage_type::const_iterator const_iterator;
+
+    /// <summary>
+    /// An iterator over the in-memory representation of the matrix.
+    /// </summary>
+    typedef typename storage_type::iterator iterator;
+
+    /// <summary>
+    /// The return type of an accessor to a matrix element.
+    /// </summary>
+    typedef TValue& return_value_type;
+
+    /// <summary>
+    /// The type used to store a scalar.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance with all elements being zero.
+    /// </summary>
+    inline constexpr static_matrix(void) noexcept : _elements() { }
+
+    /// <summary>
+    /// Initialises a new instance with all elements being
+    /// <paramref name="value" />.
+    /// </summary>
+    /// <param name="value">The initial value of all matrix elements.</param>
+    inline constexpr explicit static_matrix(
+            _In_ const value_type value) noexcept : _elements() {
+        this->fill(value);
+    }
+
+    /// <summary>
+    /// Gets an iterator for the begin of the elements in the order given by
+    /// <typeparamref name="Layout" />.
+    /// </summary>
+    /// <returns>An iterator for the begin of the elements.</returns>
+    inline constexpr iterator begin(void) noexcept {
+        return this->_elements.begin();
+    }
+
+    /// <summary>
+    /// Gets an iterator for the begin of the elements in the order given by
+    /// <typeparamref name="Layout" />.
+    /// </summary>
+    /// <returns>An iterator for the begin of the elements.</returns>
+    inline constexpr const_iterator begin(void) const noexcept {
+        return this->_elements.begin();
+    }
+
+    /// <summary>
+    /// Answer the number of columns in the matrix.
+    /// </summary>
+    /// <returns>The number of columns in the matrix.</returns>
+    inline constexpr std::size_t columns(void) const noexcept {
+        return Columns;
+    }
+
+    /// <summary>
+    /// Answer whether the matrix is stored in column-major order.
+    /// </summary>
+    /// <returns><c>true</c> if the matrix is a column-major matrix,
+    /// <c>false</c> if it is a row-major matrix.</returns>
+    inline constexpr bool column_major(void) const noexcept {
+        return (Layout == matrix_layout::column_major);
+    }
+
+    /// <summary>
+    /// Answer the in-memory representation of the matrix.
+    /// </summary>
+    /// <returns>A pointer to the first element of the matrix.</returns>
+    inline constexpr value_type *data(void) noexcept {
+        return this->_elements.data();
+    }
+
+    /// <summary>
+    /// Answer the in-memory representation of the matrix.
+    /// </summary>
+    /// <returns>A pointer to the first element of the matrix.</returns>
+    inline constexpr const value_type *data(void) const noexcept {
+        return this->_elements.data();
+    }
+
+    /// <summary>
+    /// Answer whether the matrix has no elements.
+    /// </summary>
+    /// <returns><c>true</c> if the matrix has no elements,
+    /// <c>false</c> otherwise.</returns>
+    inline constexpr bool empty(void) const noexcept {
+        return (this->size() == 0);
+    }
+
+    /// <summary>
+    /// Gets an iterator for the end of the elements in the order given by
+    /// <typeparamref name="Layout" />.
+    /// </summary>
+    /// <returns>An iterator for the end of the elements.</returns>
+    inline constexpr iterator end(void) noexcept {
+        return this->_elements.end();
+    }
+
+    /// <summary>
+    /// Gets an iterator for the end of the elements in the order given by
+    /// <typeparamref name="Layout" />.
+    /// </summary>
+    /// <returns>An iterator for the end of the elements.</returns>
+    inline constexpr const_iterator end(void) const noexcept {
+        return this->_elements.end();
+    }
+
+    /// <summary>
+    /// Sets all elements of the matrix to <paramref name="value" />.
+    /// </summary>
+    /// <param name="value">The value to be set.</param>
+    inline constexpr void fill(_In_ const value_type value) noexcept {
+        for (auto& e : this->_elements) {
+            e = value;
+        }
+    }
+
+    /// <summary>
+    /// Answer the layout of the matrix.
+    /// </summary>
+    /// <returns>The layout of the matrix.</returns>
+    inline constexpr matrix_layout layout(void) const noexcept {
+        return Layout;
+    }
+
+    /// <summary>
+    /// Answer the number of rows in the matrix.
+    /// </summary>
+    /// <returns>The number of rows in the matrix.</returns>
+    inline constexpr std::size_t rows(void) const noexcept {
+        return Rows;
+    }
+
+    /// <summary>
+    /// Answer whether the matrix is stored in row-major order.
+    /// </summary>
+    /// <returns><c>true</c> if the matrix is a row-major matrix,
+    /// <c>false</c> if it is a column-major matrix.</returns>
+    inline constexpr bool row_major(void) const noexcept {
+        return (Layout == matrix_layout::row_major);
+    }
+
+    /// <summary>
+    /// Answer the number of elements in the matrix.
+    /// </summary>
+    /// <returns>The number of elements in the matrix.</returns>
+    inline constexpr std::size_t size(void) const noexcept {
+        return Rows * Columns;
+    }
+
+    /// <summary>
+    /// Answer the distance between two consecutive rows (for row-major
+    /// matrices) or columns (for column-major matrices) in elements.
+    /// </summary>
+    /// <remarks>
+    /// Static matrices are never padded.
+    /// </remarks>
+    /// <returns>The number of elements between two consecutive rows or
+    /// columns.</returns>
+    inline constexpr std::size_t stride(void) const noexcept {
+        return (Layout == matrix_layout::row_major) ? Columns : Rows;
+    }
+
+    /// <summary>
+    /// Test for equality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if all elements of this matrix and of
+    /// <paramref name="rhs" /> are equal, <c>false</c> otherwise.</returns>
+    inline constexpr bool operator ==(
+            _In_ const static_matrix& rhs) const noexcept {
+        for (std::size_t i = 0; i < this->size(); ++i) {
+            if (this->_elements[i] != rhs._elements[i]) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /// <summary>
+    /// Test for inequality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if not all elements of this matrix and of
+    /// <paramref name="rhs" /> are equal, <c>false</c> otherwise.</returns>
+    inline constexpr bool operator !=(
+            _In_ const static_matrix& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="row">The zero-based row of the element.</param>
+    /// <param name="column">The zero-based column of the element.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline constexpr const value_type& operator ()(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) const noexcept {
+        return this->_elements[offset(row, column)];
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="row">The zero-based row of the element.</param>
+    /// <param name="column">The zero-based column of the element.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline constexpr return_value_type operator ()(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) noexcept {
+        return this->_elements[offset(row, column)];
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="index">The flattened index of the matrix element.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline constexpr const value_type& operator [](
+            _In_ const std::size_t index) const noexcept {
+        return this->_elements[index];
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="index">The flattened index of the matrix element.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline constexpr return_value_type operator [](
+            _In_ const std::size_t index) noexcept {
+        return this->_elements[index];
+    }
+
+    /// <summary>
+    /// Gets a view of the matrix.
+    /// </summary>
+    /// <returns>A view of the matrix.</returns>
+    inline operator matrix_view<TValue, Layout>(void) noexcept {
+        return matrix_view<TValue, Layout>(this->data(), Rows, Columns);
+    }
+
+    /// <summary>
+    /// Gets a read-only view of the matrix.
+    /// </summary>
+    /// <returns>A read-only view of the matrix.</returns>
+    inline operator matrix_view<const TValue, Layout>(void) const noexcept {
+        return matrix_view<const TValue, Layout>(this->data(), Rows, Columns);
+    }
+
+private:
+
+    /// <summary>
+    /// Answer the position of the given <paramref name="row" /> and
+    /// <paramref name="column" /> in <see cref="_elements" />.
+    /// </summary>
+    static inline constexpr std::size_t offset(
+            _In_ const std::size_t row,
+            _In_ const std::size_t column) noexcept {
+        assert(row < Rows);
+        assert(column < Columns);
+        return (Layout == matrix_layout::row_major)
+            ? (row * Columns + column)
+            : (column * Rows + row);
+    }
+
+    storage_type _elements;
+};
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The type of a working buffer with <typeparamref name="Size" /> elements,
+/// which is a <c>std::array</c> if the size is known at compile time or a
+/// <c>std::vector</c> if <typeparamref name="Size" /> is zero.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements in the buffer.
+/// </typeparam>
+/// <typeparam name="Size">The number of elements if known at compile time,
+/// zero otherwise.</typeparam>
+template<class TValue, std::size_t Size>
+using buffer_t = std::conditional_t<(Size == 0),
+    std::vector<TValue>,
+    std::array<TValue, Size>>;
+
+/// <summary>
+/// Creates a working buffer of type <see cref="buffer_t" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements in the buffer.
+/// </typeparam>
+/// <typeparam name="Size">The number of elements if known at compile time,
+/// zero otherwise.</typeparam>
+/// <param name="size">The number of elements, which must match
+/// <typeparamref name="Size" /> unless this is zero.</param>
+/// <returns>A new buffer.</returns>
+template<class TValue, std::size_t Size>
+inline buffer_t<TValue, Size> make_buffer(_In_ const std::size_t size) {
+    if constexpr (Size == 0) {
+        return std::vector<TValue>(size);
+    } else {
+        assert(size == Size);
+        return std::array<TValue, Size>();
+    }
+}
+
+LHS_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_LHS_STATIC_MATRIX_H) */
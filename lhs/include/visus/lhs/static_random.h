@@ -0,0 +1,165 @@
+﻿// <copyright file="static_random.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_STATIC_RANDOM_H)
+#define _LHS_STATIC_RANDOM_H
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <type_traits>
+
+#include "visus/lhs/index_type.h"
+#include "visus/lhs/splitmix.h"
+#include "visus/lhs/static_matrix.h"
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Draws an unbiased random integer from [0, <paramref name="bound" />[ in a
+/// way that can be used in constant expressions.
+/// </summary>
+/// <typeparam name="TRng">The type of the random number generator, which must
+/// produce uniformly distributed numbers over the whole range of 64-bit
+/// unsigned integers in a constant expression.</typeparam>
+/// <param name="rng">The random number generator.</param>
+/// <param name="bound">The exclusive upper bound, which must not be zero.
+/// </param>
+/// <returns>A random number within [0, <paramref name="bound" />[.</returns>
+template<class TRng>
+constexpr std::uint64_t bounded_random(_Inout_ TRng& rng,
+    _In_ const std::uint64_t bound) noexcept;
+
+/// <summary>
+/// Draws a random floating-point number from [0, 1[ in a way that can be used
+/// in constant expressions.
+/// </summary>
+/// <typeparam name="TValue">The floating-point type to be created.
+/// </typeparam>
+/// <typeparam name="TRng">The type of the random number generator, which must
+/// produce uniformly distributed numbers over the whole range of 64-bit
+/// unsigned integers in a constant expression.</typeparam>
+/// <param name="rng">The random number generator.</param>
+/// <returns>A random number within [0, 1[.</returns>
+template<class TValue, class TRng>
+constexpr TValue unit_random(_Inout_ TRng& rng) noexcept;
+
+/// <summary>
+/// Fills each column of <paramref name="result" /> with a random permutation
+/// of the indices from zero to the number of rows using a Fisher-Yates
+/// shuffle, which can be used in constant expressions.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Rows">The number of rows in the matrix.</typeparam>
+/// <typeparam name="Columns">The number of columns in the matrix.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator.</typeparam>
+/// <param name="result">The matrix to receive the permutations.</param>
+/// <param name="rng">The random number generator.</param>
+template<class TValue, std::size_t Rows, std::size_t Columns,
+    matrix_layout Layout, class TRng>
+constexpr void permute_columns(
+    _Inout_ static_matrix<TValue, Rows, Columns, Layout>& result,
+    _Inout_ TRng& rng) noexcept;
+
+LHS_DETAIL_NAMESPACE_END
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Creates a Latin Hypercube sample of indices at compile time.
+/// </summary>
+/// <remarks>
+/// <para>All of the computation can be performed in a constant expression,
+/// which allows for baking pre-generated designs into read-only data:</para>
+/// <code>
+/// constexpr auto lhs = static_random&lt;std::uint8_t, 16, 4&gt;(
+///     splitmix64(42));
+/// </code>
+/// <para>The generator is taken by value, because it cannot be modified in a
+/// constant expression if it is not local to the evaluation. The columns are
+/// permuted using a Fisher-Yates shuffle rather than by sorting random
+/// numbers, wherefore the result differs from the one of
+/// <see cref="random" /> for the same generator.</para>
+/// </remarks>
+/// <typeparam name="TIndex">The type of the indices, which must be an unsigned
+/// integral type that can represent <typeparamref name="Rows" />.</typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator, which must
+/// produce uniformly distributed numbers over the whole range of 64-bit
+/// unsigned integers in a constant expression.</typeparam>
+/// <param name="rng">The random number generator.</param>
+/// <returns>A Latin Hypercube sample of indices.</returns>
+template<class TIndex,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout = matrix_layout::row_major,
+    class TRng = splitmix64>
+constexpr std::enable_if_t<detail::is_index_v<TIndex>,
+    static_matrix<TIndex, Rows, Columns, Layout>>
+static_random(_In_ TRng rng = TRng()) noexcept;
+
+/// <summary>
+/// Creates a Latin Hypercube sample from the unit hypercube at compile time.
+/// </summary>
+/// <remarks>
+/// The values are jittered within their strata like the ones created by
+/// <see cref="random" />, but the draw differs from the one of the runtime
+/// generator for the same random number generator.
+/// </remarks>
+/// <typeparam name="TValue">The type of the values to be created, which must
+/// be a floating-point type.</typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator, which must
+/// produce uniformly distributed numbers over the whole range of 64-bit
+/// unsigned integers in a constant expression.</typeparam>
+/// <param name="rng">The random number generator.</param>
+/// <returns>A Latin Hypercube sample within [0, 1].</returns>
+template<class TValue,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout = matrix_layout::row_major,
+    class TRng = splitmix64>
+constexpr std::enable_if_t<std::is_floating_point_v<TValue>,
+    static_matrix<TValue, Rows, Columns, Layout>>
+static_random(_In_ TRng rng = TRng()) noexcept;
+
+/// <summary>
+/// Creates a Latin Hypercube sample from the unit hypercube at compile time,
+/// placing the values in the centre of the intervals.
+/// </summary>
+/// <typeparam name="TValue">The type of the values to be created, which must
+/// be a floating-point type.</typeparam>
+/// <typeparam name="Rows">The number of samples.</typeparam>
+/// <typeparam name="Columns">The number of parameters.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TRng">The type of the random number generator, which must
+/// produce uniformly distributed numbers over the whole range of 64-bit
+/// unsigned integers in a constant expression.</typeparam>
+/// <param name="rng">The random number generator.</param>
+/// <returns>A centred Latin Hypercube sample within [0, 1].</returns>
+template<class TValue,
+    std::size_t Rows,
+    std::size_t Columns,
+    matrix_layout Layout = matrix_layout::row_major,
+    class TRng = splitmix64>
+constexpr std::enable_if_t<std::is_floating_point_v<TValue>,
+    static_matrix<TValue, Rows, Columns, Layout>>
+static_centred(_In_ TRng rng = TRng()) noexcept;
+
+LHS_NAMESPACE_END
+
+#include "visus/lhs/static_random.inl"
+
+#endif /* !defined(_LHS_STATIC_RANDOM_H) */
@@ -0,0 +1,143 @@
+﻿// <copyright file="static_random.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::bounded_random
+ */
+template<class TRng>
+constexpr std::uint64_t LHS_DETAIL_NAMESPACE::bounded_random(
+        _Inout_ TRng& rng,
+        _In_ const std::uint64_t bound) noexcept {
+    static_assert(((TRng::min)() == 0)
+        && ((TRng::max)() == (std::numeric_limits<std::uint64_t>::max)()),
+        "The random number generator must produce numbers over the whole "
+        "range of 64-bit unsigned integers.");
+    assert(bound > 0);
+    // Reject the numbers below 2^64 mod bound, which would otherwise be
+    // returned more often than the others.
+    const auto threshold = (static_cast<std::uint64_t>(0) - bound) % bound;
+
+    while (true) {
+        const auto retval = static_cast<std::uint64_t>(rng());
+        if (retval >= threshold) {
+            return retval % bound;
+        }
+    }
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::unit_random
+ */
+template<class TValue, class TRng>
+constexpr TValue LHS_DETAIL_NAMESPACE::unit_random(
+        _Inout_ TRng& rng) noexcept {
+    static_assert(std::is_floating_point_v<TValue>, "The unit random number "
+        "must be a floating-point number.");
+    static_assert(((TRng::min)() == 0)
+        && ((TRng::max)() == (std::numeric_limits<std::uint64_t>::max)()),
+        "The random number generator must produce numbers over the whole "
+        "range of 64-bit unsigned integers.");
+    // Use as many bits as the mantissa can represent exactly, such that the
+    // result can never be rounded up to one.
+    constexpr auto digits = (std::numeric_limits<TValue>::digits < 64)
+        ? std::numeric_limits<TValue>::digits
+        : 64;
+    const auto bits = static_cast<std::uint64_t>(rng()) >> (64 - digits);
+
+    auto scale = static_cast<TValue>(1);
+    for (int i = 0; i < digits; ++i) {
+        scale /= static_cast<TValue>(2);
+    }
+
+    return static_cast<TValue>(bits) * scale;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::permute_columns
+ */
+template<class TValue, std::size_t Rows, std::size_t Columns,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng>
+constexpr void LHS_DETAIL_NAMESPACE::permute_columns(
+        _Inout_ static_matrix<TValue, Rows, Columns, Layout>& result,
+        _Inout_ TRng& rng) noexcept {
+    for (std::size_t c = 0; c < Columns; ++c) {
+        for (std::size_t r = 0; r < Rows; ++r) {
+            result(r, c) = static_cast<TValue>(r);
+        }
+
+        // Note: std::swap is not constexpr before C++ 20.
+        for (std::size_t r = Rows; r > 1; --r) {
+            const auto s = static_cast<std::size_t>(bounded_random(rng, r));
+            const auto tmp = result(r - 1, c);
+            result(r - 1, c) = result(s, c);
+            result(s, c) = tmp;
+        }
+    }
+}
+
+
+/*
+ * LHS_NAMESPACE::static_random
+ */
+template<class TIndex, std::size_t Rows, std::size_t Columns,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng>
+constexpr std::enable_if_t<LHS_DETAIL_NAMESPACE::is_index_v<TIndex>,
+    LHS_NAMESPACE::static_matrix<TIndex, Rows, Columns, Layout>>
+LHS_NAMESPACE::static_random(_In_ TRng rng) noexcept {
+    static_assert((Rows == 0)
+        || (Rows - 1 <= (std::numeric_limits<TIndex>::max)()),
+        "The index type cannot represent the number of samples.");
+    static_matrix<TIndex, Rows, Columns, Layout> retval;
+    detail::permute_columns(retval, rng);
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::static_random
+ */
+template<class TValue, std::size_t Rows, std::size_t Columns,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng>
+constexpr std::enable_if_t<std::is_floating_point_v<TValue>,
+    LHS_NAMESPACE::static_matrix<TValue, Rows, Columns, Layout>>
+LHS_NAMESPACE::static_random(_In_ TRng rng) noexcept {
+    static_matrix<TValue, Rows, Columns, Layout> retval;
+    detail::permute_columns(retval, rng);
+
+    for (std::size_t c = 0; c < Columns; ++c) {
+        for (std::size_t r = 0; r < Rows; ++r) {
+            retval(r, c) += detail::unit_random<TValue>(rng);
+            retval(r, c) /= static_cast<TValue>(Rows);
+        }
+    }
+
+    return retval;
+}
+
+
+/*
+ * LHS_NAMESPACE::static_centred
+ */
+template<class TValue, std::size_t Rows, std::size_t Columns,
+    LHS_NAMESPACE::matrix_layout Layout, class TRng>
+constexpr std::enable_if_t<std::is_floating_point_v<TValue>,
+    LHS_NAMESPACE::static_matrix<TValue, Rows, Columns, Layout>>
+LHS_NAMESPACE::static_centred(_In_ TRng rng) noexcept {
+    constexpr auto half = static_cast<TValue>(0.5);
+    static_matrix<TValue, Rows, Columns, Layout> retval;
+    detail::permute_columns(retval, rng);
+
+    for (std::size_t c = 0; c < Columns; ++c) {
+        for (std::size_t r = 0; r < Rows; ++r) {
+            retval(r, c) = (retval(r, c) + half) / static_cast<TValue>(Rows);
+        }
+    }
+
+    return retval;
+}
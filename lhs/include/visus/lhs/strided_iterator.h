@@ -0,0 +1,320 @@
+﻿// <copyright file="strided_iterator.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_STRIDED_ITERATOR_H)
+#define _LHS_STRIDED_ITERATOR_H
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+
+#include "visus/lhs/api.h"
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// A random-access iterator over elements that are a constant number of
+/// elements apart in memory.
+/// </summary>
+/// <remarks>
+/// The iterator is the pointer to the first element of the sequence, the
+/// position in the sequence and the stride. A pointer to the current element
+/// is only formed when the iterator is dereferenced, because stepping from
+/// the last element of a strided sequence could point beyond the end of the
+/// allocation, which is undefined behaviour.
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements, which may be
+/// <c>const</c>-qualified.</typeparam>
+template<class TValue> class strided_iterator final {
+
+public:
+
+    /// <summary>
+    /// The type to express the distance between two iterators.
+    /// </summary>
+    typedef std::ptrdiff_t difference_type;
+
+    /// <summary>
+    /// The category of the iterator.
+    /// </summary>
+    typedef std::random_access_iterator_tag iterator_category;
+
+    /// <summary>
+    /// A pointer to an element.
+    /// </summary>
+    typedef TValue *pointer;
+
+    /// <summary>
+    /// A reference to an element.
+    /// </summary>
+    typedef TValue& reference;
+
+    /// <summary>
+    /// The type of the elements.
+    /// </summary>
+    typedef std::remove_const_t<TValue> value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="data">The first element of the sequence.</param>
+    /// <param name="position">The zero-based position in the sequence the
+    /// iterator initially points to.</param>
+    /// <param name="stride">The distance between two consecutive elements in
+    /// memory.</param>
+    inline explicit strided_iterator(_In_opt_ pointer data = nullptr,
+            _In_ const difference_type position = 0,
+            _In_ const difference_type stride = 1) noexcept
+        : _data(data), _position(position), _stride(stride) { }
+
+    /// <summary>
+    /// Converts a writable iterator into a read-only one.
+    /// </summary>
+    /// <typeparam name="T">The type of the elements of the writable iterator.
+    /// </typeparam>
+    /// <param name="it">The iterator to be converted.</param>
+    template<class T, class = std::enable_if_t<std::is_const_v<TValue>
+        && std::is_same_v<const T, TValue>>>
+    inline strided_iterator(_In_ const strided_iterator<T>& it) noexcept
+        : _data(it.data()), _position(it.position()), _stride(it.stride()) { }
+
+    /// <summary>
+    /// Answer the first element of the sequence.
+    /// </summary>
+    /// <returns>A pointer to the first element of the sequence.</returns>
+    inline pointer data(void) const noexcept {
+        return this->_data;
+    }
+
+    /// <summary>
+    /// Answer the position in the sequence the iterator points to.
+    /// </summary>
+    /// <returns>The zero-based position of the current element.</returns>
+    inline difference_type position(void) const noexcept {
+        return this->_position;
+    }
+
+    /// <summary>
+    /// Answer the distance between two consecutive elements in memory.
+    /// </summary>
+    /// <returns>The stride of the iterator.</returns>
+    inline difference_type stride(void) const noexcept {
+        return this->_stride;
+    }
+
+    /// <summary>
+    /// Gets the current element.
+    /// </summary>
+    /// <returns>The current element.</returns>
+    inline reference operator *(void) const noexcept {
+        return this->_data[this->_position * this->_stride];
+    }
+
+    /// <summary>
+    /// Gets a pointer to the current element.
+    /// </summary>
+    /// <returns>A pointer to the current element.</returns>
+    inline pointer operator ->(void) const noexcept {
+        return this->_data + this->_position * this->_stride;
+    }
+
+    /// <summary>
+    /// Gets the element <paramref name="offset" /> positions away from the
+    /// current one.
+    /// </summary>
+    /// <param name="offset">The offset in number of elements.</param>
+    /// <returns>The element at the specified offset.</returns>
+    inline reference operator [](
+            _In_ const difference_type offset) const noexcept {
+        return this->_data[(this->_position + offset) * this->_stride];
+    }
+
+    /// <summary>
+    /// Prefix increment.
+    /// </summary>
+    /// <returns>The iterator after it has been advanced.</returns>
+    inline strided_iterator& operator ++(void) noexcept {
+        ++this->_position;
+        return *this;
+    }
+
+    /// <summary>
+    /// Postfix increment.
+    /// </summary>
+    /// <returns>The iterator before it has been advanced.</returns>
+    inline strided_iterator operator ++(int) noexcept {
+        auto retval = *this;
+        ++(*this);
+        return retval;
+    }
+
+    /// <summary>
+    /// Prefix decrement.
+    /// </summary>
+    /// <returns>The iterator after it has been moved back.</returns>
+    inline strided_iterator& operator --(void) noexcept {
+        --this->_position;
+        return *this;
+    }
+
+    /// <summary>
+    /// Postfix decrement.
+    /// </summary>
+    /// <returns>The iterator before it has been moved back.</returns>
+    inline strided_iterator operator --(int) noexcept {
+        auto retval = *this;
+        --(*this);
+        return retval;
+    }
+
+    /// <summary>
+    /// Advances the iterator by <paramref name="offset" /> elements.
+    /// </summary>
+    /// <param name="offset">The number of elements to advance.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline strided_iterator& operator +=(
+            _In_ const difference_type offset) noexcept {
+        this->_position += offset;
+        return *this;
+    }
+
+    /// <summary>
+    /// Moves the iterator back by <paramref name="offset" /> elements.
+    /// </summary>
+    /// <param name="offset">The number of elements to move back.</param>
+    /// <returns><c>*this</c>.</returns>
+    inline strided_iterator& operator -=(
+            _In_ const difference_type offset) noexcept {
+        this->_position -= offset;
+        return *this;
+    }
+
+    /// <summary>
+    /// Answer an iterator <paramref name="offset" /> elements ahead.
+    /// </summary>
+    /// <param name="offset">The number of elements to advance.</param>
+    /// <returns>The advanced iterator.</returns>
+    inline strided_iterator operator +(
+            _In_ const difference_type offset) const noexcept {
+        auto retval = *this;
+        return (retval += offset);
+    }
+
+    /// <summary>
+    /// Answer an iterator <paramref name="offset" /> elements back.
+    /// </summary>
+    /// <param name="offset">The number of elements to move back.</param>
+    /// <returns>The moved iterator.</returns>
+    inline strided_iterator operator -(
+            _In_ const difference_type offset) const noexcept {
+        auto retval = *this;
+        return (retval -= offset);
+    }
+
+    /// <summary>
+    /// Answer the number of elements between <paramref name="rhs" /> and this
+    /// iterator.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand, which must iterate the
+    /// same sequence.</param>
+    /// <returns>The distance between the iterators in elements.</returns>
+    inline difference_type operator -(
+            _In_ const strided_iterator& rhs) const noexcept {
+        assert(this->_data == rhs._data);
+        assert(this->_stride == rhs._stride);
+        return (this->_position - rhs._position);
+    }
+
+    /// <summary>
+    /// Test for equality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if both iterators designate the same element,
+    /// <c>false</c> otherwise.</returns>
+    inline bool operator ==(_In_ const strided_iterator& rhs) const noexcept {
+        assert(this->_data == rhs._data);
+        return (this->_position == rhs._position);
+    }
+
+    /// <summary>
+    /// Test for inequality.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if the iterators designate different elements,
+    /// <c>false</c> otherwise.</returns>
+    inline bool operator !=(_In_ const strided_iterator& rhs) const noexcept {
+        return !(*this == rhs);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is before <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is before
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator <(_In_ const strided_iterator& rhs) const noexcept {
+        return ((rhs - *this) > 0);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is before or at <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is not after
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator <=(_In_ const strided_iterator& rhs) const noexcept {
+        return !(rhs < *this);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is after <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is after
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator >(_In_ const strided_iterator& rhs) const noexcept {
+        return (rhs < *this);
+    }
+
+    /// <summary>
+    /// Answer whether this iterator is after or at <paramref name="rhs" />.
+    /// </summary>
+    /// <param name="rhs">The right-hand-side operand.</param>
+    /// <returns><c>true</c> if this iterator is not before
+    /// <paramref name="rhs" />, <c>false</c> otherwise.</returns>
+    inline bool operator >=(_In_ const strided_iterator& rhs) const noexcept {
+        return !(*this < rhs);
+    }
+
+private:
+
+    pointer _data;
+    difference_type _position;
+    difference_type _stride;
+};
+
+
+/// <summary>
+/// Answer an iterator <paramref name="offset" /> elements ahead of
+/// <paramref name="it" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements.</typeparam>
+/// <param name="offset">The number of elements to advance.</param>
+/// <param name="it">The iterator to be advanced.</param>
+/// <returns>The advanced iterator.</returns>
+template<class TValue>
+inline strided_iterator<TValue> operator +(
+        _In_ const typename strided_iterator<TValue>::difference_type offset,
+        _In_ const strided_iterator<TValue>& it) noexcept {
+    return (it + offset);
+}
+
+LHS_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_LHS_STRIDED_ITERATOR_H) */
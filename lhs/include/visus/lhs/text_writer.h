@@ -0,0 +1,165 @@
+﻿// <copyright file="text_writer.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_TEXT_WRITER_H)
+#define _LHS_TEXT_WRITER_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <cstdlib>
+#include <iterator>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "visus/lhs/matrix.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/parallel.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Writes <paramref name="lhs" /> as delimiter-separated text, for instance
+/// CSV or TSV, to <paramref name="stream" />.
+/// </summary>
+/// <remarks>
+/// <para>Each row of the matrix is written as one line. The numbers are
+/// formatted using <c>std::to_chars</c>, which yields the shortest
+/// representation that can be parsed back into the same number. The text is
+/// formatted into large blocks, which are written to the stream at once.
+/// </para>
+/// <para>If multiple threads are used, blocks of rows are formatted in
+/// parallel and written in their original order. The memory required for
+/// buffering is proportional to the number of threads, but not to the size
+/// of the matrix.</para>
+/// <para>Errors are reported via the state of <paramref name="stream" />,
+/// which throws if the caller has enabled exceptions on it.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="stream">The stream to write to.</param>
+/// <param name="lhs">The matrix to be written.</param>
+/// <param name="separator">The character separating the columns. This
+/// parameter defaults to a comma.</param>
+/// <param name="threads">The number of threads used for formatting. If this is
+/// zero, the number of hardware threads will be used. This parameter defaults
+/// to one thread.</param>
+/// <returns><paramref name="stream" />.</returns>
+template<class TValue, matrix_layout Layout>
+std::ostream& write_text(_Inout_ std::ostream& stream,
+    _In_ const matrix_view<TValue, Layout> lhs,
+    _In_ const char separator = ',',
+    _In_ const std::size_t threads = 1);
+
+/// <summary>
+/// Writes <paramref name="lhs" /> as delimiter-separated text, for instance
+/// CSV or TSV, to <paramref name="stream" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="stream">The stream to write to.</param>
+/// <param name="lhs">The matrix to be written.</param>
+/// <param name="separator">The character separating the columns. This
+/// parameter defaults to a comma.</param>
+/// <param name="threads">The number of threads used for formatting. If this is
+/// zero, the number of hardware threads will be used. This parameter defaults
+/// to one thread.</param>
+/// <returns><paramref name="stream" />.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline std::ostream& write_text(_Inout_ std::ostream& stream,
+        _In_ const matrix<TValue, Layout, TAllocator>& lhs,
+        _In_ const char separator = ',',
+        _In_ const std::size_t threads = 1) {
+    return write_text(stream, matrix_view<const TValue, Layout>(lhs),
+        separator, threads);
+}
+
+/// <summary>
+/// Writes the samples created by <see cref="sample" /> as delimiter-separated
+/// text, for instance CSV or TSV, to <paramref name="stream" />.
+/// </summary>
+/// <remarks>
+/// <para>Numbers are formatted using <c>std::to_chars</c>. Strings are
+/// quoted if they contain the separator, a quotation mark or a line break.
+/// Any other types are formatted using their stream insertion operator.</para>
+/// <para>If multiple threads are used, blocks of samples are formatted in
+/// parallel and written in their original order.</para>
+/// </remarks>
+/// <typeparam name="TValues">The types of the parameters in the samples.
+/// </typeparam>
+/// <param name="stream">The stream to write to.</param>
+/// <param name="samples">The samples to be written, each of which becomes one
+/// line of text.</param>
+/// <param name="separator">The character separating the parameters. This
+/// parameter defaults to a comma.</param>
+/// <param name="threads">The number of threads used for formatting. If this is
+/// zero, the number of hardware threads will be used. This parameter defaults
+/// to one thread.</param>
+/// <returns><paramref name="stream" />.</returns>
+template<class... TValues>
+std::ostream& write_text(_Inout_ std::ostream& stream,
+    _In_ const std::vector<std::tuple<TValues...>>& samples,
+    _In_ const char separator = ',',
+    _In_ const std::size_t threads = 1);
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The number of bytes that are formatted before they are written to the
+/// stream.
+/// </summary>
+constexpr const std::size_t text_block_size = 1 << 20;
+
+/// <summary>
+/// Appends the text representation of <paramref name="value" /> to
+/// <paramref name="dst" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the value to be formatted.
+/// </typeparam>
+/// <param name="dst">The buffer receiving the text.</param>
+/// <param name="value">The value to be formatted.</param>
+/// <param name="separator">The separator of the fields, which requires
+/// strings containing it to be quoted.</param>
+template<class TValue>
+void format_text(_Inout_ std::string& dst,
+    _In_ const TValue& value,
+    _In_ const char separator);
+
+/// <summary>
+/// Formats <paramref name="rows" /> lines using <paramref name="format" />
+/// in blocks, which are written to <paramref name="stream" /> in order.
+/// </summary>
+/// <typeparam name="TFormat">The type of the formatter, which must accept the
+/// buffer to append to and the zero-based index of the line.</typeparam>
+/// <param name="stream">The stream to write to.</param>
+/// <param name="rows">The number of lines to be written.</param>
+/// <param name="line_hint">The estimated length of a line in bytes, which
+/// is used to determine the number of lines in a block.</param>
+/// <param name="format">The formatter for a single line.</param>
+/// <param name="threads">The number of threads used for formatting.</param>
+template<class TFormat>
+void write_lines(_Inout_ std::ostream& stream,
+    _In_ const std::size_t rows,
+    _In_ const std::size_t line_hint,
+    _In_ TFormat&& format,
+    _In_ const std::size_t threads);
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/text_writer.inl"
+
+#endif /* !defined(_LHS_TEXT_WRITER_H) */
@@ -0,0 +1,151 @@
+﻿// <copyright file="text_writer.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::write_text
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+std::ostream& LHS_NAMESPACE::write_text(_Inout_ std::ostream& stream,
+        _In_ const matrix_view<TValue, Layout> lhs,
+        _In_ const char separator,
+        _In_ const std::size_t threads) {
+    const auto columns = lhs.columns();
+    detail::write_lines(stream,
+        lhs.rows(),
+        columns * 24 + 1,
+        [&lhs, columns, separator](std::string& dst, const std::size_t r) {
+            for (std::size_t c = 0; c < columns; ++c) {
+                if (c > 0) {
+                    dst.push_back(separator);
+                }
+                detail::format_text(dst, lhs(r, c), separator);
+            }
+        },
+        threads);
+    return stream;
+}
+
+
+/*
+ * LHS_NAMESPACE::write_text
+ */
+template<class... TValues>
+std::ostream& LHS_NAMESPACE::write_text(_Inout_ std::ostream& stream,
+        _In_ const std::vector<std::tuple<TValues...>>& samples,
+        _In_ const char separator,
+        _In_ const std::size_t threads) {
+    detail::write_lines(stream,
+        samples.size(),
+        sizeof...(TValues) * 24 + 1,
+        [&samples, separator](std::string& dst, const std::size_t r) {
+            std::apply([&dst, separator](const auto&... values) {
+                std::size_t i = 0;
+                ((i++ > 0 ? dst.push_back(separator) : void(0),
+                    detail::format_text(dst, values, separator)), ...);
+            }, samples[r]);
+        },
+        threads);
+    return stream;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::format_text
+ */
+template<class TValue>
+void LHS_DETAIL_NAMESPACE::format_text(_Inout_ std::string& dst,
+        _In_ const TValue& value,
+        _In_ const char separator) {
+    if constexpr (std::is_same_v<TValue, bool>) {
+        dst.append(value ? "true" : "false");
+
+    } else if constexpr (std::is_same_v<TValue, char>) {
+        format_text(dst, std::string_view(&value, 1), separator);
+
+    } else if constexpr (std::is_arithmetic_v<TValue>) {
+        // Note: this is large enough for the shortest round-trip
+        // representation of any standard floating-point type.
+        char buffer[128];
+        const auto result = std::to_chars(std::begin(buffer),
+            std::end(buffer), value);
+        assert(result.ec == std::errc());
+        dst.append(buffer, result.ptr);
+
+    } else if constexpr (std::is_convertible_v<const TValue&,
+            std::string_view>) {
+        const std::string_view text(value);
+        const auto quote = (text.find_first_of("\"\r\n") != text.npos)
+            || (text.find(separator) != text.npos);
+
+        if (quote) {
+            dst.push_back('"');
+            for (auto c : text) {
+                if (c == '"') {
+                    dst.push_back('"');
+                }
+                dst.push_back(c);
+            }
+            dst.push_back('"');
+
+        } else {
+            dst.append(text);
+        }
+
+    } else {
+        std::ostringstream stream;
+        stream << value;
+        format_text(dst, stream.str(), separator);
+    }
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::write_lines
+ */
+template<class TFormat>
+void LHS_DETAIL_NAMESPACE::write_lines(_Inout_ std::ostream& stream,
+        _In_ const std::size_t rows,
+        _In_ const std::size_t line_hint,
+        _In_ TFormat&& format,
+        _In_ const std::size_t threads) {
+    const auto lines = (std::max)(text_block_size / (std::max)(line_hint,
+        static_cast<std::size_t>(1)), static_cast<std::size_t>(1));
+    const auto blocks = (rows + lines - 1) / lines;
+    const auto cnt = parallelism(blocks, threads);
+
+    // Each thread formats at most a few blocks before all of them are written,
+    // which bounds the memory required independently from the size of the
+    // output.
+    const auto batch = (cnt > 1) ? 4 * cnt : 1;
+    std::vector<std::string> buffers(batch);
+    for (auto& b : buffers) {
+        b.reserve(text_block_size + line_hint);
+    }
+
+    for (std::size_t first = 0; first < blocks; first += batch) {
+        const auto last = (std::min)(first + batch, blocks);
+
+        parallel_for(first, last, [&](const std::size_t begin,
+                const std::size_t end) {
+            for (auto b = begin; b < end; ++b) {
+                auto& buffer = buffers[b - first];
+                buffer.clear();
+
+                const auto row_end = (std::min)((b + 1) * lines, rows);
+                for (auto r = b * lines; r < row_end; ++r) {
+                    format(buffer, r);
+                    buffer.push_back('\n');
+                }
+            }
+        }, cnt);
+
+        for (auto b = first; b < last; ++b) {
+            const auto& buffer = buffers[b - first];
+            stream.write(buffer.data(), buffer.size());
+        }
+    }
+}
@@ -0,0 +1,253 @@
+﻿// <copyright file="transformed_range.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_TRANSFORMED_RANGE_H)
+#define _LHS_TRANSFORMED_RANGE_H
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+#include "visus/lhs/api.h"
+#include "visus/lhs/make_floating_point.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// The identity transform, which makes a
+/// <see cref="transformed_range{TValue, TTransform}" /> behave like a
+/// <see cref="range{TValue}" />.
+/// </summary>
+struct identity_transform final {
+
+    /// <summary>
+    /// Transforms a parameter value into the space in which the parameter is
+    /// sampled uniformly.
+    /// </summary>
+    template<class TValue>
+    inline constexpr TValue forward(_In_ const TValue value) const noexcept {
+        return value;
+    }
+
+    /// <summary>
+    /// Transforms a value from the space in which the parameter is sampled
+    /// uniformly back into a parameter value.
+    /// </summary>
+    template<class TValue>
+    inline constexpr TValue inverse(_In_ const TValue value) const noexcept {
+        return value;
+    }
+};
+
+
+/// <summary>
+/// The logarithmic transform, which samples a parameter uniformly in log
+/// space, i.e. each order of magnitude is equally likely.
+/// </summary>
+struct log_transform final {
+
+    /// <summary>
+    /// Transforms a parameter value into log space.
+    /// </summary>
+    template<class TValue>
+    inline TValue forward(_In_ const TValue value) const noexcept {
+        return std::log(value);
+    }
+
+    /// <summary>
+    /// Transforms a value from log space back into a parameter value.
+    /// </summary>
+    template<class TValue>
+    inline TValue inverse(_In_ const TValue value) const noexcept {
+        return std::exp(value);
+    }
+};
+
+
+/// <summary>
+/// Represents a numeric range that is sampled uniformly after applying a
+/// strictly monotone transform to its values.
+/// </summary>
+/// <remarks>
+/// <para>The bounds of the range are transformed once when the range is
+/// created. Scaling a unit sample value u then interpolates linearly between
+/// the transformed bounds and applies the inverse transform to the result.
+/// The range can be used wherever a <see cref="range{TValue}" /> can be used
+/// to scale a sample, for instance in the range overloads of
+/// <see cref="random" /> and <see cref="centred" /> or as a parameter of
+/// <see cref="sample" />, which apply the inverse transform while writing the
+/// scaled sample rather than in a separate pass.</para>
+/// <para>Values are clamped to the bounds of the range in order to compensate
+/// for rounding errors of the inverse transform. Integral values are rounded
+/// to the nearest integer.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the numbers.</typeparam>
+/// <typeparam name="TTransform">The transform, which must provide the
+/// member functions <c>forward</c> and <c>inverse</c> accepting and
+/// returning <see cref="transformed_type" />. The transform must be strictly
+/// monotone on the range.</typeparam>
+template<class TValue, class TTransform> class transformed_range final {
+
+public:
+
+    /// <summary>
+    /// The type of the transform.
+    /// </summary>
+    typedef TTransform transform_type;
+
+    /// <summary>
+    /// The floating-point type in which the transform is computed.
+    /// </summary>
+    typedef detail::make_floating_point_t<TValue> transformed_type;
+
+    /// <summary>
+    /// The type of the numbers.
+    /// </summary>
+    typedef TValue value_type;
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="begin">The begin of the range. If this is larger than the
+    /// <paramref name="end" />, the values will be swapped.</param>
+    /// <param name="end">The end of the range. if this is smaller than the
+    /// <paramref name="begin" />, the values will be swapped.</param>
+    /// <param name="transform">The transform to be applied.</param>
+    /// <exception cref="std::invalid_argument">If the transformed bounds are
+    /// not finite, for instance if a bound of a logarithmic range is not
+    /// positive.</exception>
+    transformed_range(_In_ const value_type begin,
+        _In_ const value_type end,
+        _In_ const transform_type& transform = transform_type());
+
+    /// <summary>
+    /// Answer the begin of the range.
+    /// </summary>
+    /// <returns>The begin of the range, which is guaranteed to be at most the
+    /// same as <see cref="end" />.</returns>
+    inline constexpr value_type begin(void) const noexcept {
+        return this->_begin;
+    }
+
+    /// <summary>
+    /// Answer whether the range is empty, i.e. the begin and end are the same.
+    /// </summary>
+    /// <returns><c>true</c> if the begin and the end are the same,
+    /// <c>false</c> otherwise.</returns>
+    inline constexpr auto empty(void) const noexcept {
+        return (this->_begin == this->_end);
+    }
+
+    /// <summary>
+    /// Answer the distance between the begin and the end of the range.
+    /// </summary>
+    /// <returns>The distance between the begin and the end of the range.
+    /// </returns>
+    inline constexpr value_type distance(void) const noexcept {
+        return (this->_end - this->_begin);
+    }
+
+    /// <summary>
+    /// Answer the end of the range.
+    /// </summary>
+    /// <returns>The end of the range, which is guaranteed to be at least the
+    /// same as <see cref="begin" />.</returns>
+    inline constexpr value_type end(void) const noexcept {
+        return this->_end;
+    }
+
+    /// <summary>
+    /// Answer the transform applied to the range.
+    /// </summary>
+    /// <returns>The transform.</returns>
+    inline const transform_type& transform(void) const noexcept {
+        return this->_transform;
+    }
+
+    /// <summary>
+    /// Answer the transformed begin of the range.
+    /// </summary>
+    /// <returns>The transformed begin of the range.</returns>
+    inline transformed_type transformed_begin(void) const noexcept {
+        return this->_transformed_begin;
+    }
+
+    /// <summary>
+    /// Answer the distance between the transformed bounds of the range.
+    /// </summary>
+    /// <returns>The transformed distance, which is negative if the transform
+    /// is decreasing.</returns>
+    inline transformed_type transformed_distance(void) const noexcept {
+        return this->_transformed_distance;
+    }
+
+private:
+
+    value_type _begin;
+    value_type _end;
+    transform_type _transform;
+    transformed_type _transformed_begin;
+    transformed_type _transformed_distance;
+};
+
+
+/// <summary>
+/// A range that is sampled uniformly in log space.
+/// </summary>
+/// <typeparam name="TValue">The type of the numbers.</typeparam>
+template<class TValue>
+using log_range = transformed_range<TValue, log_transform>;
+
+
+/// <summary>
+/// Creates a new range from <paramref name="begin" /> to
+/// <paramref name="end" /> that is sampled uniformly in log space.
+/// </summary>
+/// <typeparam name="TValue">The type of the numbers.</typeparam>
+/// <param name="begin">The begin of the range, which must be positive.
+/// </param>
+/// <param name="end">The end of the range, which must be positive.</param>
+/// <returns>The logarithmic range between <paramref name="begin" /> and
+/// <paramref name="end" />.</returns>
+/// <exception cref="std::invalid_argument">If one of the bounds is not
+/// positive.</exception>
+template<class TValue>
+inline log_range<TValue> make_log_range(_In_ const TValue begin,
+        _In_ const TValue end) {
+    return log_range<TValue>(begin, end);
+}
+
+
+/// <summary>
+/// Creates a new range from <paramref name="begin" /> to
+/// <paramref name="end" /> that is sampled uniformly after applying
+/// <paramref name="transform" />.
+/// </summary>
+/// <typeparam name="TValue">The type of the numbers.</typeparam>
+/// <typeparam name="TTransform">The type of the transform.</typeparam>
+/// <param name="begin">The begin of the range.</param>
+/// <param name="end">The end of the range.</param>
+/// <param name="transform">The strictly monotone transform.</param>
+/// <returns>The transformed range between <paramref name="begin" /> and
+/// <paramref name="end" />.</returns>
+/// <exception cref="std::invalid_argument">If the transformed bounds are
+/// not finite.</exception>
+template<class TValue, class TTransform>
+inline transformed_range<TValue, TTransform> make_transformed_range(
+        _In_ const TValue begin,
+        _In_ const TValue end,
+        _In_ const TTransform& transform) {
+    return transformed_range<TValue, TTransform>(begin, end, transform);
+}
+
+LHS_NAMESPACE_END
+
+#include "visus/lhs/transformed_range.inl"
+
+#endif /* !defined(_LHS_TRANSFORMED_RANGE_H) */
@@ -0,0 +1,31 @@
+﻿// <copyright file="transformed_range.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::transformed_range<TValue, TTransform>::transformed_range
+ */
+template<class TValue, class TTransform>
+LHS_NAMESPACE::transformed_range<TValue, TTransform>::transformed_range(
+        _In_ const value_type begin,
+        _In_ const value_type end,
+        _In_ const transform_type& transform)
+        : _begin((std::min)(begin, end)),
+        _end((std::max)(begin, end)),
+        _transform(transform) {
+    const auto b = this->_transform.forward(
+        static_cast<transformed_type>(this->_begin));
+    const auto e = this->_transform.forward(
+        static_cast<transformed_type>(this->_end));
+
+    if (!std::isfinite(b) || !std::isfinite(e)) {
+        throw std::invalid_argument("The bounds of a transformed range must "
+            "be finite after the transform has been applied.");
+    }
+
+    this->_transformed_begin = b;
+    this->_transformed_distance = e - b;
+}
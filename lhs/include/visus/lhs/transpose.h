@@ -0,0 +1,85 @@
+﻿// <copyright file="transpose.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_TRANSPOSE_H)
+#define _LHS_TRANSPOSE_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <utility>
+
+#include "visus/lhs/api.h"
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// The edge length of the square tiles in which matrices are transposed.
+/// </summary>
+/// <remarks>
+/// A tile of 8 x 8 elements touches eight cache lines in the source and eight
+/// in the destination, which fit into the L1 cache even for large types. The
+/// fixed size of the tiles allows the compiler to unroll and vectorise the
+/// micro-transposes.
+/// </remarks>
+constexpr const std::size_t transpose_tile = 8;
+
+/// <summary>
+/// Copies the transposed <paramref name="src" /> into
+/// <paramref name="dst" />.
+/// </summary>
+/// <remarks>
+/// The memory is processed in square tiles of <see cref="transpose_tile" />
+/// elements such that both, the reads and the writes, stay within a small
+/// number of cache lines, which would not be the case when walking one of the
+/// buffers element by element.
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements.</typeparam>
+/// <param name="dst">The buffer to receive <paramref name="columns" /> lines of
+/// <paramref name="rows" /> elements each.</param>
+/// <param name="dst_stride">The distance between two lines of
+/// <paramref name="dst" /> in elements.</param>
+/// <param name="src">The buffer holding <paramref name="rows" /> lines of
+/// <paramref name="columns" /> elements each.</param>
+/// <param name="src_stride">The distance between two lines of
+/// <paramref name="src" /> in elements.</param>
+/// <param name="rows">The number of lines in <paramref name="src" />.</param>
+/// <param name="columns">The number of elements in each line of
+/// <paramref name="src" />.</param>
+template<class TValue>
+void transpose(_Out_ TValue *dst,
+    _In_ const std::size_t dst_stride,
+    _In_ const TValue *src,
+    _In_ const std::size_t src_stride,
+    _In_ const std::size_t rows,
+    _In_ const std::size_t columns);
+
+/// <summary>
+/// Transposes the square matrix <paramref name="data" /> in place.
+/// </summary>
+/// <remarks>
+/// The tiles on the diagonal are transposed within themselves, all other tiles
+/// are swapped with their mirror image while being transposed, wherefore no
+/// additional memory is required.
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements.</typeparam>
+/// <param name="data">The buffer holding <paramref name="size" /> lines of
+/// <paramref name="size" /> elements each.</param>
+/// <param name="stride">The distance between two lines of
+/// <paramref name="data" /> in elements.</param>
+/// <param name="size">The number of rows and columns of the matrix.</param>
+template<class TValue>
+void transpose(_Inout_ TValue *data,
+    _In_ const std::size_t stride,
+    _In_ const std::size_t size);
+
+LHS_DETAIL_NAMESPACE_END
+
+#include "visus/lhs/transpose.inl"
+
+#endif /* !defined(_LHS_TRANSPOSE_H) */
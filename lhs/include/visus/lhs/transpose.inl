@@ -0,0 +1,88 @@
+﻿// <copyright file="transpose.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::transpose
+ */
+template<class TValue>
+void LHS_DETAIL_NAMESPACE::transpose(_Out_ TValue *dst,
+        _In_ const std::size_t dst_stride,
+        _In_ const TValue *src,
+        _In_ const std::size_t src_stride,
+        _In_ const std::size_t rows,
+        _In_ const std::size_t columns) {
+    assert((dst != nullptr) || (rows * columns == 0));
+    assert((src != nullptr) || (rows * columns == 0));
+    assert(dst_stride >= rows);
+    assert(src_stride >= columns);
+    constexpr auto T = transpose_tile;
+
+    for (std::size_t r0 = 0; r0 < rows; r0 += T) {
+        const auto r1 = (std::min)(r0 + T, rows);
+
+        for (std::size_t c0 = 0; c0 < columns; c0 += T) {
+            const auto c1 = (std::min)(c0 + T, columns);
+
+            if ((r1 - r0 == T) && (c1 - c0 == T)) {
+                // Full tile with constant bounds, which the compiler can
+                // unroll into a register-level micro-transpose.
+                for (std::size_t r = 0; r < T; ++r) {
+                    const auto s = src + (r0 + r) * src_stride + c0;
+                    for (std::size_t c = 0; c < T; ++c) {
+                        dst[(c0 + c) * dst_stride + r0 + r] = s[c];
+                    }
+                }
+
+            } else {
+                // Partial tile at the right or bottom edge.
+                for (std::size_t r = r0; r < r1; ++r) {
+                    const auto s = src + r * src_stride;
+                    for (std::size_t c = c0; c < c1; ++c) {
+                        dst[c * dst_stride + r] = s[c];
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::transpose
+ */
+template<class TValue>
+void LHS_DETAIL_NAMESPACE::transpose(_Inout_ TValue *data,
+        _In_ const std::size_t stride,
+        _In_ const std::size_t size) {
+    assert((data != nullptr) || (size == 0));
+    assert(stride >= size);
+    using std::swap;
+    constexpr auto T = transpose_tile;
+
+    for (std::size_t r0 = 0; r0 < size; r0 += T) {
+        const auto r1 = (std::min)(r0 + T, size);
+
+        // Tile on the diagonal: swap the elements above the diagonal with the
+        // ones below it.
+        for (std::size_t r = r0; r < r1; ++r) {
+            for (std::size_t c = r + 1; c < r1; ++c) {
+                swap(data[r * stride + c], data[c * stride + r]);
+            }
+        }
+
+        // Tiles right of the diagonal are swapped with the ones below it.
+        for (std::size_t c0 = r1; c0 < size; c0 += T) {
+            const auto c1 = (std::min)(c0 + T, size);
+
+            for (std::size_t r = r0; r < r1; ++r) {
+                for (std::size_t c = c0; c < c1; ++c) {
+                    swap(data[r * stride + c], data[c * stride + r]);
+                }
+            }
+        }
+    }
+}
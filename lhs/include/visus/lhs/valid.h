@@ -8,83 +8,171 @@
 #define _LHS_VALID_H
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
-#include "visus/lhs/matrix.h"
+#include "visus/lhs/column_validity.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/parallel.h"
+#include "visus/lhs/static_matrix.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// Checks for each column of <paramref name="lhs" /> whether it is an exact
+/// permutation of the strata.
+/// </summary>
+/// <remarks>
+/// <para>For integral samples, each column must contain each of the indices
+/// from zero to the number of rows (exclusive) exactly once. For
+/// floating-point samples, all elements must be within the unit interval and
+/// the strata the elements fall into must form a permutation. Scaled samples
+/// cannot be validated.</para>
+/// <para>The check runs in O(n) per column using a bitset of n bits that is
+/// reused for all columns processed by the same thread. No index matrix is
+/// created for floating-point samples. The columns are processed in
+/// parallel.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the matrix elements, which must be
+/// an integral or a floating-point type.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="lhs">A Latin Hypercube sample.</param>
+/// <param name="threads">The number of threads to use. If this is zero, the
+/// number of hardware threads will be used.</param>
+/// <returns>The diagnostic for each column of the sample.</returns>
+template<class TValue, matrix_layout Layout>
+std::vector<column_validity> validate(
+    _In_ const matrix_view<TValue, Layout> lhs,
+    _In_ const std::size_t threads = 0);
+
+/// <summary>
+/// Checks for each column of <paramref name="lhs" /> whether it is an exact
+/// permutation of the strata.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements, which must be
+/// an integral or a floating-point type.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="lhs">A Latin Hypercube sample.</param>
+/// <param name="threads">The number of threads to use. If this is zero, the
+/// number of hardware threads will be used.</param>
+/// <returns>The diagnostic for each column of the sample.</returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline std::vector<column_validity> validate(
+        _In_ const matrix<TValue, Layout, TAllocator>& lhs,
+        _In_ const std::size_t threads = 0) {
+    return validate(matrix_view<const TValue, Layout>(lhs), threads);
+}
+
+LHS_NAMESPACE_END
 
 
 LHS_DETAIL_NAMESPACE_BEGIN
 
 /// <summary>
-/// Answer whether <paramref name="lhs" /> is (likely) a valid Latin Hypercube
-/// sample based on the heuristic from
-/// https://github.com/bertcarnell/lhslib/blob/557bec455c5bf2d20438bbace2096c2a7e3823ff/src/lhslib/utilityLHS.cpp#L25-L53
+/// Answer whether <paramref name="lhs" /> is a valid Latin Hypercube
+/// sample, i.e. whether every column is a permutation of the indices of the
+/// strata or, for floating-point samples, whether the strata the elements fall
+/// into form a permutation in every column.
 /// </summary>
+/// <typeparam name="TValue">The type of the matrix elements, which must be an
+/// integral or a floating-point type.</typeparam>
 /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
 /// <param name="lhs">A Latin Hypercube sample.</param>
 /// <returns><c>true</c> if the sample is valid, <c>false</c> otherwise.
 /// </returns>
-template<matrix_layout Layout>
-bool valid(_In_ const matrix<std::size_t, Layout>& lhs) noexcept {
-    const auto n = lhs.rows();
-    const auto k = lhs.columns();
-    const auto expected = n * (n + 1) / 2;
-
-    for (std::size_t c = 0; c < k; ++c) {
-        std::size_t sum = 0;
-
-        for (std::size_t r = 0; r < n; ++r) {
-            // Note: we use zero-based indexing, so we need to add one to each
-            // of the elements.
-            sum += (lhs(r, c) + 1);
-        }
-
-        if (sum != expected) {
-            return false;
-        }
-    }
-
-    return true;
+/// <exception cref="std::invalid_argument">If a floating-point sample is not
+/// from a unit hypercube. This method cannot work on scaled samples.
+/// </exception>
+template<class TValue, matrix_layout Layout>
+bool valid(_In_ const matrix_view<TValue, Layout> lhs);
+
+/// <summary>
+/// Answer whether <paramref name="lhs" /> is a valid Latin Hypercube
+/// sample, i.e. whether every column is a permutation of the indices of the
+/// strata.
+/// </summary>
+/// <typeparam name="TValue">The type of the indices, which must be an
+/// integral number.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
+/// <param name="lhs">A Latin Hypercube sample.</param>
+/// <returns><c>true</c> if the sample is valid, <c>false</c> otherwise.
+/// </returns>
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline std::enable_if_t<std::is_integral_v<TValue>, bool> valid(
+        _In_ const matrix<TValue, Layout, TAllocator>& lhs) {
+    return valid(matrix_view<const TValue, Layout>(lhs));
 }
 
 /// <summary>
 /// Answer whether the given matrix is a valid Latin hypercube sample from
-/// a unit hypercube according to the method at
-/// https://github.com/bertcarnell/lhslib/blob/557bec455c5bf2d20438bbace2096c2a7e3823ff/src/lhslib/utilityLHS.cpp#L55-L68
+/// a unit hypercube, i.e. whether the strata the elements fall into form a
+/// permutation in every column.
 /// </summary>
 /// <typeparam name="TValue">The type of the matrix elements, which must be a
 /// floating-point number.</typeparam>
 /// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <typeparam name="TAllocator">The allocator of the matrix.</typeparam>
 /// <param name="lhs">A Latin Hypercube sample.</param>
 /// <returns><c>true</c> if the sample is valid, <c>false</c> otherwise.
 /// </returns>
 /// <exception cref="std::invalid_argument">If the sample is not from a unit
 /// hypercube. This method cannot work on scaled samples.</exception>
-template<class TValue, matrix_layout Layout>
-std::enable_if_t<std::is_floating_point_v<TValue>, bool> valid(
-        _In_ const matrix<TValue, Layout>& lhs) {
-    const auto n = static_cast<TValue>(lhs.rows());
-    matrix<std::size_t, Layout> indices(lhs.rows(), lhs.columns());
-
-    auto oit = indices.begin();
-    for (auto it = lhs.begin(), e = lhs.end(); it != e; ++it) {
-        if ((*it < 0.0) || (*it > 1.0)) {
-            throw std::invalid_argument("The sample must be from a unit "
-                "hypercube.");
-        }
-
-        // Note: we assume zero-based indexing, so the integer variant will
-        // add one for us.
-        *oit++ = static_cast<std::size_t>(floor(n * *it));
-    }
-
-    return valid(indices);
+template<class TValue, matrix_layout Layout, class TAllocator>
+inline std::enable_if_t<std::is_floating_point_v<TValue>, bool> valid(
+        _In_ const matrix<TValue, Layout, TAllocator>& lhs) {
+    return valid(matrix_view<const TValue, Layout>(lhs));
 }
 
+/// <summary>
+/// Answer whether the fixed-size matrix <paramref name="lhs" /> is a valid
+/// Latin hypercube sample.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements, which must be an
+/// integral or a floating-point type.</typeparam>
+/// <typeparam name="Rows">The number of rows in the matrix.</typeparam>
+/// <typeparam name="Columns">The number of columns in the matrix.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="lhs">A Latin Hypercube sample.</param>
+/// <returns><c>true</c> if the sample is valid, <c>false</c> otherwise.
+/// </returns>
+/// <exception cref="std::invalid_argument">If a floating-point sample is not
+/// from a unit hypercube.</exception>
+template<class TValue, std::size_t Rows, std::size_t Columns,
+    matrix_layout Layout>
+inline bool valid(
+        _In_ const static_matrix<TValue, Rows, Columns, Layout>& lhs) {
+    return valid(matrix_view<const TValue, Layout>(lhs));
+}
+
+/// <summary>
+/// Checks whether the given column of <paramref name="lhs" /> is an exact
+/// permutation of the strata.
+/// </summary>
+/// <typeparam name="TValue">The type of the matrix elements.</typeparam>
+/// <typeparam name="Layout">The memory layout of the matrix.</typeparam>
+/// <param name="lhs">A Latin Hypercube sample.</param>
+/// <param name="column">The zero-based index of the column to check.</param>
+/// <param name="bits">Scratch space for a bitset with one bit per row. The
+/// content of the bitset is overwritten.</param>
+/// <returns>The diagnostic for the column.</returns>
+template<class TValue, matrix_layout Layout>
+column_validity validate_column(_In_ const matrix_view<TValue, Layout> lhs,
+    _In_ const std::size_t column,
+    _Inout_ std::vector<std::uint64_t>& bits);
+
 LHS_DETAIL_NAMESPACE_END
 
+#include "visus/lhs/valid.inl"
+
 
 #if (defined(DEBUG) || defined(_DEBUG))
 #define ASSERT_VALID_LHS(lhs) assert(LHS_DETAIL_NAMESPACE::valid(lhs))
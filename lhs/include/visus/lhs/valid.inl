@@ -0,0 +1,118 @@
+﻿// <copyright file="valid.inl" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+
+/*
+ * LHS_NAMESPACE::validate
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+std::vector<LHS_NAMESPACE::column_validity> LHS_NAMESPACE::validate(
+        _In_ const matrix_view<TValue, Layout> lhs,
+        _In_ const std::size_t threads) {
+    typedef std::remove_const_t<TValue> value_type;
+    static_assert(std::is_integral_v<value_type>
+        || std::is_floating_point_v<value_type>,
+        "Only integral and floating-point samples can be validated.");
+    // Each thread should have a reasonable amount of work to do such that we
+    // do not spend more time on starting threads than on checking.
+    static constexpr std::size_t min_elements = 1 << 16;
+    const auto n = lhs.rows();
+    const auto k = lhs.columns();
+    const auto grain = (std::max)(min_elements / (std::max)(n,
+        static_cast<std::size_t>(1)), static_cast<std::size_t>(1));
+
+    std::vector<column_validity> retval(k, column_validity::valid);
+    detail::parallel_for(0, k, [lhs, &retval, n](const std::size_t b,
+            const std::size_t e) {
+        std::vector<std::uint64_t> bits((n + 63) / 64);
+        for (auto c = b; c < e; ++c) {
+            retval[c] = detail::validate_column(lhs, c, bits);
+        }
+    }, threads, grain);
+
+    return retval;
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::valid
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+bool LHS_DETAIL_NAMESPACE::valid(_In_ const matrix_view<TValue, Layout> lhs) {
+    const auto validity = validate(lhs);
+
+    if constexpr (std::is_floating_point_v<std::remove_const_t<TValue>>) {
+        if (std::any_of(validity.begin(), validity.end(),
+                [](const column_validity v) {
+                    return (v == column_validity::out_of_range);
+                })) {
+            throw std::invalid_argument("The sample must be from a unit "
+                "hypercube.");
+        }
+    }
+
+    return std::all_of(validity.begin(), validity.end(),
+        [](const column_validity v) { return (v == column_validity::valid); });
+}
+
+
+/*
+ * LHS_DETAIL_NAMESPACE::validate_column
+ */
+template<class TValue, LHS_NAMESPACE::matrix_layout Layout>
+LHS_NAMESPACE::column_validity LHS_DETAIL_NAMESPACE::validate_column(
+        _In_ const matrix_view<TValue, Layout> lhs,
+        _In_ const std::size_t column,
+        _Inout_ std::vector<std::uint64_t>& bits) {
+    typedef std::remove_const_t<TValue> value_type;
+    assert(column < lhs.columns());
+    const auto n = lhs.rows();
+    bits.resize((n + 63) / 64);
+    std::fill(bits.begin(), bits.end(), static_cast<std::uint64_t>(0));
+
+    for (std::size_t r = 0; r < n; ++r) {
+        const auto value = lhs(r, column);
+        std::size_t index;
+
+        if constexpr (std::is_floating_point_v<value_type>) {
+            // Note: the negated test also catches NaNs.
+            if (!((value >= static_cast<value_type>(0))
+                    && (value <= static_cast<value_type>(1)))) {
+                return column_validity::out_of_range;
+            }
+
+            // Note: we compute the stratum on the fly instead of converting
+            // the whole sample to indices. The upper bound of the unit
+            // interval belongs to the last stratum.
+            index = static_cast<std::size_t>(std::floor(
+                static_cast<value_type>(n) * value));
+            index = (std::min)(index, n - 1);
+
+        } else {
+            if constexpr (std::is_signed_v<value_type>) {
+                if (value < 0) {
+                    return column_validity::out_of_range;
+                }
+            }
+
+            index = static_cast<std::size_t>(value);
+            if (index >= n) {
+                return column_validity::out_of_range;
+            }
+        }
+
+        // As there are exactly n elements, all being within [0, n), the
+        // column is a permutation if there are no duplicates.
+        auto& word = bits[index / 64];
+        const auto bit = static_cast<std::uint64_t>(1) << (index % 64);
+        if ((word & bit) != 0) {
+            return column_validity::duplicate;
+        }
+        word |= bit;
+    }
+
+    return column_validity::valid;
+}
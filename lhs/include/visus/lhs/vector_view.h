@@ -0,0 +1,197 @@
+﻿// <copyright file="vector_view.h" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#if !defined(_LHS_VECTOR_VIEW_H)
+#define _LHS_VECTOR_VIEW_H
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <type_traits>
+
+#include "visus/lhs/strided_iterator.h"
+
+
+LHS_NAMESPACE_BEGIN
+
+/// <summary>
+/// A non-owning view of a single row or column of a matrix, i.e. of elements
+/// that are a constant number of elements apart in memory.
+/// </summary>
+/// <remarks>
+/// <para>Use <see cref="row_view" /> and <see cref="column_view" /> to obtain
+/// a view of a row or column of a matrix without copying its elements. Rows
+/// of row-major matrices and columns of column-major matrices are
+/// <see cref="contiguous" />, in which case algorithms can work on
+/// <see cref="data" /> directly.</para>
+/// <para>Views are lightweight and should be passed by value. Like a pointer,
+/// the constness of the view does not propagate to the elements.</para>
+/// </remarks>
+/// <typeparam name="TValue">The type of the elements, which may be
+/// <c>const</c>-qualified.</typeparam>
+template<class TValue> class vector_view final {
+
+public:
+
+    /// <summary>
+    /// The iterator over the elements of the view.
+    /// </summary>
+    typedef detail::strided_iterator<TValue> iterator;
+
+    /// <summary>
+    /// The return type of an accessor to an element.
+    /// </summary>
+    typedef TValue& return_value_type;
+
+    /// <summary>
+    /// The type of the elements.
+    /// </summary>
+    typedef std::remove_const_t<TValue> value_type;
+
+    /// <summary>
+    /// Initialises a new, empty instance.
+    /// </summary>
+    inline vector_view(void) noexcept
+        : _data(nullptr), _size(0), _stride(1) { }
+
+    /// <summary>
+    /// Initialises a new instance.
+    /// </summary>
+    /// <param name="data">A pointer to the first element. The caller must
+    /// ensure that the memory lives as long as the view.</param>
+    /// <param name="size">The number of elements in the view.</param>
+    /// <param name="stride">The distance between two consecutive elements in
+    /// memory, which must be at least one.</param>
+    inline vector_view(_In_ TValue *data,
+            _In_ const std::size_t size,
+            _In_ const std::size_t stride = 1) noexcept
+            : _data(data), _size(size), _stride(stride) {
+        assert((data != nullptr) || (size == 0));
+        assert(stride > 0);
+    }
+
+    /// <summary>
+    /// Converts a writable view into a read-only one.
+    /// </summary>
+    /// <typeparam name="T">The type of the elements of the writable view.
+    /// </typeparam>
+    /// <param name="view">The view to be converted.</param>
+    template<class T, class = std::enable_if_t<std::is_const_v<TValue>
+        && std::is_same_v<const T, TValue>>>
+    inline vector_view(_In_ const vector_view<T>& view) noexcept
+        : _data(view.data()), _size(view.size()), _stride(view.stride()) { }
+
+    /// <summary>
+    /// Gets an iterator for the first element.
+    /// </summary>
+    /// <returns>An iterator for the first element.</returns>
+    inline iterator begin(void) const noexcept {
+        return iterator(this->_data, 0, this->difference());
+    }
+
+    /// <summary>
+    /// Answer whether the elements are densely packed in memory.
+    /// </summary>
+    /// <returns><c>true</c> if the stride is one, <c>false</c> otherwise.
+    /// </returns>
+    inline bool contiguous(void) const noexcept {
+        return (this->_stride == 1);
+    }
+
+    /// <summary>
+    /// Answer the memory the view is referring to.
+    /// </summary>
+    /// <returns>A pointer to the first element.</returns>
+    inline TValue *data(void) const noexcept {
+        return this->_data;
+    }
+
+    /// <summary>
+    /// Answer whether the view has no elements.
+    /// </summary>
+    /// <returns><c>true</c> if the view is empty, <c>false</c> otherwise.
+    /// </returns>
+    inline bool empty(void) const noexcept {
+        return (this->_size == 0);
+    }
+
+    /// <summary>
+    /// Gets an iterator past the last element.
+    /// </summary>
+    /// <returns>An iterator past the last element.</returns>
+    inline iterator end(void) const noexcept {
+        return iterator(this->_data,
+            static_cast<typename iterator::difference_type>(this->_size),
+            this->difference());
+    }
+
+    /// <summary>
+    /// Answer the number of elements in the view.
+    /// </summary>
+    /// <returns>The number of elements.</returns>
+    inline std::size_t size(void) const noexcept {
+        return this->_size;
+    }
+
+    /// <summary>
+    /// Answer the distance between two consecutive elements in memory.
+    /// </summary>
+    /// <returns>The stride in number of elements.</returns>
+    inline std::size_t stride(void) const noexcept {
+        return this->_stride;
+    }
+
+    /// <summary>
+    /// Answer the element at the specified position.
+    /// </summary>
+    /// <param name="index">The zero-based index of the element.</param>
+    /// <returns>The element at the specified position.</returns>
+    inline return_value_type operator [](
+            _In_ const std::size_t index) const noexcept {
+        assert(index < this->_size);
+        return this->_data[index * this->_stride];
+    }
+
+private:
+
+    inline typename iterator::difference_type difference(
+            void) const noexcept {
+        return static_cast<typename iterator::difference_type>(this->_stride);
+    }
+
+    TValue *_data;
+    std::size_t _size;
+    std::size_t _stride;
+};
+
+LHS_NAMESPACE_END
+
+
+LHS_DETAIL_NAMESPACE_BEGIN
+
+/// <summary>
+/// Copies the elements of <paramref name="src" /> to <paramref name="dst" />,
+/// using a plain memory copy if both views are contiguous.
+/// </summary>
+/// <typeparam name="TValue">The type of the elements.</typeparam>
+/// <param name="dst">The view to receive the elements, which must have the
+/// same size as <paramref name="src" />.</param>
+/// <param name="src">The view to copy the elements from.</param>
+template<class TValue>
+inline void copy(_In_ const vector_view<TValue> dst,
+        _In_ const vector_view<const TValue> src) {
+    assert(dst.size() == src.size());
+    if (dst.contiguous() && src.contiguous()) {
+        std::copy(src.data(), src.data() + src.size(), dst.data());
+    } else {
+        std::copy(src.begin(), src.end(), dst.begin());
+    }
+}
+
+LHS_DETAIL_NAMESPACE_END
+
+#endif /* !defined(_LHS_VECTOR_VIEW_H) */
@@ -0,0 +1,176 @@
+﻿// <copyright file="categorical_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/categorical.h"
+#include "visus/lhs/random.h"
+#include "visus/lhs/sample.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+
+
+namespace test {
+
+    TEST_CLASS(categorical_test) {
+
+        TEST_METHOD(test_construction) {
+            categorical<std::string> names({ "horst", "hugo", "heinz" });
+            Assert::AreEqual(std::size_t(3), names.size(), L"Size", LINE_INFO());
+            Assert::AreEqual(std::string("hugo"), names[1], L"Lookup", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), names.index_of(names[2]), L"Index of", LINE_INFO());
+            Assert::AreEqual(std::ptrdiff_t(3), names.end() - names.begin(), L"Iterators", LINE_INFO());
+
+            const auto from_set = make_categorical(std::set<int>({ 3, 1, 2 }));
+            Assert::AreEqual(std::size_t(3), from_set.size(), L"Size from set", LINE_INFO());
+            Assert::AreEqual(1, from_set[0], L"Set is ordered", LINE_INFO());
+            Assert::AreEqual(3, from_set[2], L"Set is ordered", LINE_INFO());
+
+            const auto from_list = make_categorical(std::list<float>({ 1.0f, 2.0f }));
+            Assert::AreEqual(2.0f, from_list[1], L"Lookup from list", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([]() { make_categorical(std::vector<int>()); }, L"Empty", LINE_INFO());
+        }
+
+        TEST_METHOD(test_sample) {
+            categorical<std::string> names({ "horst", "hugo", "heinz", "hans" });
+            auto lhs = sample([](const std::size_t p) { return random<float>(8, p); }, names, make_range(0, 8));
+            Assert::AreEqual(std::size_t(8), lhs.size(), L"Number of samples", LINE_INFO());
+
+            std::vector<std::size_t> counts(names.size(), 0);
+            for (auto& s : lhs) {
+                const std::string& name = std::get<0>(s);
+                const auto index = names.index_of(name);
+                Assert::IsTrue(&names[index] == &name, L"Reference into dictionary", LINE_INFO());
+                ++counts[index];
+            }
+
+            for (auto c : counts) {
+                Assert::IsTrue(c > 0, L"All categories selected", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_columns) {
+            categorical<std::string> names({ "horst", "hugo" });
+            auto lhs = sample_columns([](const std::size_t p) { return random<float>(6, p); }, names);
+            const auto& column = std::get<0>(lhs);
+            Assert::AreEqual(std::size_t(6), column.size(), L"Number of samples", LINE_INFO());
+            Assert::AreEqual(std::size_t(3), static_cast<std::size_t>(std::count_if(column.begin(), column.end(), [](const std::string& n) { return n == "hugo"; })), L"Stratified categories", LINE_INFO());
+        }
+
+        TEST_METHOD(test_equiprobable) {
+            categorical<int> plain({ 0, 1, 2, 3 });
+            weighted_categorical<int> weighted({ { 0, 1.0 }, { 1, 1.0 }, { 2, 1.0 }, { 3, 1.0 } });
+            auto lhs = sample_columns([](const std::size_t p) { return random<double>(1200, p); }, plain, weighted);
+
+            for (int i = 0; i < 4; ++i) {
+                const auto& p = std::get<0>(lhs);
+                const auto& w = std::get<1>(lhs);
+                Assert::AreEqual(std::size_t(300), static_cast<std::size_t>(std::count_if(p.begin(), p.end(), [i](const int v) { return v == i; })), L"Categories are equally likely", LINE_INFO());
+                Assert::AreEqual(std::size_t(300), static_cast<std::size_t>(std::count_if(w.begin(), w.end(), [i](const int v) { return v == i; })), L"Same as equal weights", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_node_containers) {
+            auto lhs = sample([](const std::size_t p) { return random<float>(4, p); },
+                std::set<int>({ 1, 2 }),
+                std::list<std::string>({ "horst", "hugo" }));
+
+            for (auto& s : lhs) {
+                Assert::IsTrue((std::get<0>(s) == 1) || (std::get<0>(s) == 2), L"Set", LINE_INFO());
+                Assert::IsTrue((std::get<1>(s) == "horst") || (std::get<1>(s) == "hugo"), L"List", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_weighted_construction) {
+            weighted_categorical<std::string> scenarios({ { "base", 7.0 }, { "high", 2.0 }, { "low", 1.0 } });
+            Assert::AreEqual(std::size_t(3), scenarios.size(), L"Size", LINE_INFO());
+            Assert::AreEqual(std::string("high"), scenarios[1], L"Lookup", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), scenarios.index_of(scenarios[2]), L"Index of", LINE_INFO());
+            Assert::AreEqual(0.7, scenarios.probability(0), 0.000000000001, L"Normalised", LINE_INFO());
+            Assert::AreEqual(0.2, scenarios.probability(1), 0.000000000001, L"Normalised", LINE_INFO());
+            Assert::AreEqual(0.1, scenarios.probability(2), 0.000000000001, L"Normalised", LINE_INFO());
+            Assert::AreEqual(std::size_t(16), scenarios.cells(), L"Power of two cells", LINE_INFO());
+
+            Assert::AreEqual(std::size_t(0), scenarios.select(0.0), L"Lower bound", LINE_INFO());
+            Assert::AreEqual(std::size_t(0), scenarios.select(0.69), L"First", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), scenarios.select(0.7), L"Boundary", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), scenarios.select(0.89f), L"Second", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), scenarios.select(0.95), L"Third", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), scenarios.select(1.0), L"Upper bound", LINE_INFO());
+
+            const std::vector<int> values { 1, 2, 3 };
+            const std::vector<float> weights { 0.0f, 1.0f, 0.0f };
+            weighted_categorical<int> single(values.begin(), values.end(), weights.begin());
+            Assert::AreEqual(std::size_t(1), single.select(0.0), L"Zero weight skipped", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), single.select(1.0), L"Zero weight skipped", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([]() { weighted_categorical<int>({ }); }, L"Empty", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { weighted_categorical<int>({ { 1, 0.0 } }); }, L"All zero", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { weighted_categorical<int>({ { 1, 1.0 }, { 2, -1.0 } }); }, L"Negative", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { weighted_categorical<int>({ { 1, 1.0 }, { 2, 1e-300 } }); }, L"Too small", LINE_INFO());
+        }
+
+        TEST_METHOD(test_weighted_select) {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<double> weight(0.0, 1.0);
+            std::uniform_int_distribution<int> zero(0, 4);
+
+            for (std::size_t t = 0; t < 50; ++t) {
+                std::vector<int> values(1 + t % 13);
+                std::vector<double> weights(values.size());
+                for (std::size_t i = 0; i < values.size(); ++i) {
+                    values[i] = static_cast<int>(i);
+                    weights[i] = (zero(rng) == 0) ? 0.0 : weight(rng);
+                }
+                weights[t % weights.size()] += 0.001;
+
+                weighted_categorical<int> parameter(values.begin(), values.end(), weights.begin());
+                std::vector<double> cumulative(weights.size());
+                auto sum = 0.0;
+                for (std::size_t i = 0; i < weights.size(); ++i) {
+                    sum += parameter.probability(i);
+                    cumulative[i] = sum;
+                }
+
+                for (std::size_t i = 0; i <= 10000; ++i) {
+                    const auto u = static_cast<double>(i) / 10000.0;
+                    const auto actual = parameter.select(u);
+                    Assert::IsTrue(weights[actual] > 0.0, L"Only expressions with a weight", LINE_INFO());
+                    if (u < 1.0) {
+                        // Reference is the linear search for the first cumulative probability greater than u.
+                        const auto expected = static_cast<std::size_t>(std::upper_bound(cumulative.begin(), cumulative.end() - 1, u) - cumulative.begin());
+                        if (std::abs(u - cumulative[expected]) > 1e-12 && ((expected == 0) || std::abs(u - cumulative[expected - 1]) > 1e-12)) {
+                            Assert::AreEqual(expected, actual, L"Matches linear search", LINE_INFO());
+                        }
+                    }
+                }
+            }
+        }
+
+        TEST_METHOD(test_weighted_sample) {
+            weighted_categorical<std::string> scenarios({ { "base", 0.7 }, { "high", 0.2 }, { "low", 0.1 } });
+            auto lhs = sample([](const std::size_t p) { return random<double>(100, p); }, scenarios, make_range(0.0, 1.0));
+            Assert::AreEqual(std::size_t(100), lhs.size(), L"Number of samples", LINE_INFO());
+
+            std::vector<std::size_t> counts(scenarios.size(), 0);
+            for (auto& s : lhs) {
+                const std::string& name = std::get<0>(s);
+                const auto index = scenarios.index_of(name);
+                Assert::IsTrue(&scenarios[index] == &name, L"Reference into dictionary", LINE_INFO());
+                ++counts[index];
+            }
+
+            // The strata align with the boundaries of the categories, so the
+            // counts are proportional to the weights.
+            Assert::IsTrue((counts[0] >= 69) && (counts[0] <= 71), L"70 %", LINE_INFO());
+            Assert::IsTrue((counts[1] >= 19) && (counts[1] <= 21), L"20 %", LINE_INFO());
+            Assert::IsTrue((counts[2] >= 9) && (counts[2] <= 11), L"10 %", LINE_INFO());
+        }
+    };
+
+}
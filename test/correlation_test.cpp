@@ -0,0 +1,131 @@
+﻿// <copyright file="correlation_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/correlation.h"
+#include "visus/lhs/random.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(correlation_test) {
+
+        template<class TValue, matrix_layout Layout>
+        static double reference(const matrix<TValue, Layout>& lhs,
+                const std::size_t c, const std::size_t d) {
+            const auto n = static_cast<double>(lhs.rows());
+            double mc = 0.0, md = 0.0;
+            for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                mc += static_cast<double>(lhs(r, c));
+                md += static_cast<double>(lhs(r, d));
+            }
+            mc /= n;
+            md /= n;
+
+            double cov = 0.0, vc = 0.0, vd = 0.0;
+            for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                const auto x = static_cast<double>(lhs(r, c)) - mc;
+                const auto y = static_cast<double>(lhs(r, d)) - md;
+                cov += x * y;
+                vc += x * x;
+                vd += y * y;
+            }
+
+            return ((vc > 0.0) && (vd > 0.0)) ? cov / std::sqrt(vc * vd) : 0.0;
+        }
+
+        template<class TValue, matrix_layout Layout>
+        static double reference_max(const matrix<TValue, Layout>& lhs) {
+            double retval = 0.0;
+            for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                for (std::size_t d = c + 1; d < lhs.columns(); ++d) {
+                    retval = (std::max)(retval, std::abs(reference(lhs, c, d)));
+                }
+            }
+            return retval;
+        }
+
+        TEST_METHOD(test_identity) {
+            matrix<std::size_t> lhs(5, 2, [](const std::size_t r, const std::size_t) { return r + 1; });
+            column_correlation<std::size_t> correlation(lhs);
+            Assert::AreEqual(std::size_t(2), correlation.columns(), L"Number of columns", LINE_INFO());
+            Assert::AreEqual(1.0, correlation(0, 1), 0.000001, L"Perfect correlation", LINE_INFO());
+            Assert::AreEqual(1.0, correlation.maximum(), 0.000001, L"Perfect maximum", LINE_INFO());
+            Assert::AreEqual(1.0, max_correlation(lhs), 0.000001, L"Free function", LINE_INFO());
+        }
+
+        TEST_METHOD(test_anti) {
+            matrix<std::size_t> lhs(5, 2, [](const std::size_t r, const std::size_t c) { return (c == 0) ? r + 1 : 5 - r; });
+            column_correlation<std::size_t> correlation(lhs);
+            Assert::AreEqual(-1.0, correlation(0, 1), 0.000001, L"Perfect anti-correlation", LINE_INFO());
+            Assert::AreEqual(1.0, correlation.maximum(), 0.000001, L"Absolute maximum", LINE_INFO());
+        }
+
+        TEST_METHOD(test_constant) {
+            matrix<float> lhs(4, 2, 0.5f);
+            column_correlation<float> correlation(lhs);
+            Assert::AreEqual(0.0, correlation(0, 1), 0.000001, L"No variance", LINE_INFO());
+            Assert::AreEqual(0.0, correlation.maximum(), 0.000001, L"No variance", LINE_INFO());
+        }
+
+        TEST_METHOD(test_random_indices) {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+            auto lhs = random(20, 4, rng, distribution);
+            column_correlation<std::size_t> correlation(lhs);
+
+            for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                for (std::size_t d = 0; d < lhs.columns(); ++d) {
+                    if (c != d) {
+                        Assert::AreEqual(reference(lhs, c, d), correlation(c, d), 0.000001, L"Initial correlation", LINE_INFO());
+                    }
+                }
+            }
+
+            Assert::AreEqual(reference_max(lhs), correlation.maximum(), 0.000001, L"Initial maximum", LINE_INFO());
+
+            std::uniform_int_distribution<std::size_t> rows(0, lhs.rows() - 1);
+            std::uniform_int_distribution<std::size_t> columns(0, lhs.columns() - 1);
+            for (std::size_t i = 0; i < 100; ++i) {
+                const auto r1 = rows(rng);
+                const auto r2 = rows(rng);
+                const auto c = columns(rng);
+
+                const auto expected = correlation.evaluate(lhs, r1, r2, c);
+                correlation.swap(lhs, r1, r2, c);
+                Assert::IsTrue(valid(lhs), L"Swap preserves the sample", LINE_INFO());
+                Assert::AreEqual(expected, correlation.maximum(c), 0.000001, L"Evaluation matches swap", LINE_INFO());
+                Assert::AreEqual(reference_max(lhs), correlation.maximum(), 0.000001, L"Incremental maximum", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_random_unit) {
+            std::mt19937 rng(7);
+            std::uniform_real_distribution<double> distribution(0.0, 1.0);
+            matrix<double, matrix_layout::column_major> lhs(15, 3);
+            random(lhs, false, rng, distribution);
+            column_correlation<double> correlation(lhs);
+            Assert::AreEqual(reference_max(lhs), correlation.maximum(), 0.000001, L"Initial maximum", LINE_INFO());
+
+            for (std::size_t i = 0; i < 50; ++i) {
+                const auto c = i % lhs.columns();
+                correlation.swap(lhs, i % lhs.rows(), (3 * i + 1) % lhs.rows(), c);
+
+                for (std::size_t d = 0; d < lhs.columns(); ++d) {
+                    if (c != d) {
+                        Assert::AreEqual(reference(lhs, c, d), correlation(c, d), 0.000001, L"Incremental correlation", LINE_INFO());
+                        Assert::AreEqual(correlation(c, d), correlation(d, c), 0.000001, L"Symmetric", LINE_INFO());
+                    }
+                }
+            }
+        }
+    };
+}
@@ -0,0 +1,121 @@
+﻿// <copyright file="design_file_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/design_file.h"
+#include "visus/lhs/random.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(design_file_test) {
+
+        static std::filesystem::path temp_path(const char *name) {
+            return std::filesystem::temp_directory_path() / name;
+        }
+
+        TEST_METHOD(test_element_type) {
+            Assert::IsTrue(element_type::uint8 == element_type_of<std::uint8_t>(), L"uint8", LINE_INFO());
+            Assert::IsTrue(element_type::uint64 == element_type_of<std::uint64_t>(), L"uint64", LINE_INFO());
+            Assert::IsTrue(element_type::int16 == element_type_of<std::int16_t>(), L"int16", LINE_INFO());
+            Assert::IsTrue(element_type::int32 == element_type_of<std::int32_t>(), L"int32", LINE_INFO());
+            Assert::IsTrue(element_type::float32 == element_type_of<float>(), L"float32", LINE_INFO());
+            Assert::IsTrue(element_type::float64 == element_type_of<double>(), L"float64", LINE_INFO());
+        }
+
+        TEST_METHOD(test_round_trip) {
+            const auto path = temp_path("lhs_design_file_test.lhs");
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<double> distribution(0.0, 1.0);
+            matrix<double, matrix_layout::column_major> expected(100, 3);
+            random(expected, false, rng, distribution);
+
+            design_info info;
+            info.generator = "random";
+            info.seed = 42;
+            info.parameters = { range<double>(0.0, 1.0), range<double>(-5.0, 5.0), range<double>(1.0, 2.0) };
+            save_design(path, expected, info);
+
+            {
+                mapped_design<double, matrix_layout::column_major> actual(path);
+                Assert::AreEqual(expected.rows(), actual.rows(), L"Rows", LINE_INFO());
+                Assert::AreEqual(expected.columns(), actual.columns(), L"Columns", LINE_INFO());
+                Assert::AreEqual(std::string("random"), actual.info().generator, L"Generator", LINE_INFO());
+                Assert::AreEqual(std::uint64_t(42), actual.info().seed, L"Seed", LINE_INFO());
+                Assert::AreEqual(std::size_t(3), actual.info().parameters.size(), L"Parameters", LINE_INFO());
+                Assert::AreEqual(-5.0, actual.info().parameters[1].begin(), L"Parameter begin", LINE_INFO());
+                Assert::AreEqual(5.0, actual.info().parameters[1].end(), L"Parameter end", LINE_INFO());
+                Assert::AreEqual(std::size_t(0), reinterpret_cast<std::uintptr_t>(actual.view().data()) % 64, L"Payload is aligned", LINE_INFO());
+
+                for (std::size_t r = 0; r < expected.rows(); ++r) {
+                    for (std::size_t c = 0; c < expected.columns(); ++c) {
+                        Assert::AreEqual(expected(r, c), actual(r, c), L"Element", LINE_INFO());
+                    }
+                }
+
+                Assert::IsTrue(valid(actual.view()), L"Mapped view is valid", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&path]() { mapped_design<float, matrix_layout::column_major> m(path); }, L"Type mismatch", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([&path]() { mapped_design<double> m(path); }, L"Layout mismatch", LINE_INFO());
+
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(test_padded) {
+            const auto path = temp_path("lhs_design_file_padded.lhs");
+            std::vector<std::uint16_t> buffer(10 * 4, 0xffff);
+            matrix_view<std::uint16_t> view(buffer.data(), 10, 3, 4);
+            std::mt19937 rng(1);
+            random(view, rng, std::uniform_real_distribution<float>());
+            save_design(path, matrix_view<const std::uint16_t>(view));
+
+            {
+                mapped_design<std::uint16_t> actual(path);
+                Assert::AreEqual(std::size_t(3), actual.view().stride(), L"Padding dropped", LINE_INFO());
+                Assert::IsTrue(actual.info().generator.empty(), L"No generator", LINE_INFO());
+                Assert::IsTrue(actual.info().parameters.empty(), L"No parameters", LINE_INFO());
+
+                for (std::size_t r = 0; r < view.rows(); ++r) {
+                    for (std::size_t c = 0; c < view.columns(); ++c) {
+                        Assert::AreEqual(view(r, c), actual(r, c), L"Element", LINE_INFO());
+                    }
+                }
+            }
+
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(test_invalid) {
+            const auto path = temp_path("lhs_design_file_invalid.lhs");
+            {
+                std::ofstream stream(path, std::ios::binary);
+                stream << "This is not a design file, but it is long enough to hold a header. "
+                    "This is not a design file, but it is long enough to hold a header.";
+            }
+            Assert::ExpectException<std::invalid_argument>([&path]() { mapped_design<float> m(path); }, L"Wrong magic number", LINE_INFO());
+
+            {
+                matrix<float> lhs(100, 2);
+                save_design(path, lhs);
+                std::filesystem::resize_file(path, 256);
+            }
+            Assert::ExpectException<std::invalid_argument>([&path]() { mapped_design<float> m(path); }, L"Truncated", LINE_INFO());
+
+            std::filesystem::remove(path);
+            Assert::ExpectException<std::system_error>([&path]() { mapped_design<float> m(path); }, L"File not found", LINE_INFO());
+
+            design_info info;
+            info.generator = std::string(64, 'x');
+            Assert::ExpectException<std::invalid_argument>([&]() { save_design(path, matrix<float>(1, 1), info); }, L"Generator too long", LINE_INFO());
+        }
+    };
+}
@@ -0,0 +1,258 @@
+﻿// <copyright file="distributions_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/distributions.h"
+#include "visus/lhs/inverse_cdf.h"
+#include "visus/lhs/random.h"
+#include "visus/lhs/sample.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+
+
+namespace test {
+
+    TEST_CLASS(distributions_test) {
+
+        template<class TDistribution>
+        static void round_trip(const TDistribution& distribution, const double tolerance) {
+            for (std::size_t i = 1; i < 1000; ++i) {
+                const auto p = static_cast<double>(i) / 1000.0;
+                const auto x = distribution.quantile(p);
+                Assert::AreEqual(p, distribution.cdf(x), tolerance, L"cdf(quantile(p)) == p", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_normal) {
+            normal_distribution<double> standard;
+            Assert::AreEqual(0.0, standard.quantile(0.5), 0.0000000000001, L"Median", LINE_INFO());
+            Assert::AreEqual(1.959963984540054, standard.quantile(0.975), 0.0000000000001, L"97.5 %", LINE_INFO());
+            Assert::AreEqual(-1.959963984540054, standard.quantile(0.025), 0.0000000000001, L"2.5 %", LINE_INFO());
+            Assert::AreEqual(-4.753424308822899, standard.quantile(1e-6), 0.000000000001, L"Tail", LINE_INFO());
+            Assert::AreEqual(1e-307, standard.cdf(standard.quantile(1e-307)), 1e-318, L"Far tail", LINE_INFO());
+            Assert::IsTrue(std::isinf(standard.quantile(0.0)), L"Zero probability", LINE_INFO());
+            Assert::IsTrue(standard.quantile(0.0) < 0.0, L"Negative infinity", LINE_INFO());
+            round_trip(standard, 0.0000000000001);
+
+            normal_distribution<double> shifted(10.0, 2.0);
+            Assert::AreEqual(10.0 + 2.0 * 1.959963984540054, shifted.quantile(0.975), 0.000000000001, L"Scaled", LINE_INFO());
+            round_trip(shifted, 0.0000000000001);
+
+            Assert::ExpectException<std::invalid_argument>([]() { normal_distribution<double>(0.0, 0.0); }, L"Zero standard deviation", LINE_INFO());
+        }
+
+        TEST_METHOD(test_lognormal) {
+            lognormal_distribution<double> distribution(1.0, 0.5);
+            Assert::AreEqual(std::exp(1.0), distribution.quantile(0.5), 0.000000000001, L"Median", LINE_INFO());
+            Assert::AreEqual(0.0, distribution.quantile(0.0), 0.0, L"Lower bound", LINE_INFO());
+            Assert::AreEqual(0.0, distribution.cdf(-1.0), 0.0, L"Negative values", LINE_INFO());
+            round_trip(distribution, 0.0000000000001);
+        }
+
+        TEST_METHOD(test_triangular) {
+            triangular_distribution<double> distribution(1.0, 2.0, 5.0);
+            Assert::AreEqual(1.0, distribution.quantile(0.0), 0.0, L"Lower bound", LINE_INFO());
+            Assert::AreEqual(2.0, distribution.quantile(0.25), 0.000000000001, L"Mode", LINE_INFO());
+            Assert::AreEqual(5.0, distribution.quantile(1.0), 0.0, L"Upper bound", LINE_INFO());
+            round_trip(distribution, 0.000000000001);
+
+            triangular_distribution<double> left(0.0, 0.0, 1.0);
+            Assert::AreEqual(1.0 - std::sqrt(0.5), left.quantile(0.5), 0.000000000001, L"Mode at lower bound", LINE_INFO());
+            round_trip(left, 0.000000000001);
+
+            Assert::ExpectException<std::invalid_argument>([]() { triangular_distribution<double>(0.0, 2.0, 1.0); }, L"Mode out of bounds", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { triangular_distribution<double>(1.0, 1.0, 1.0); }, L"Empty", LINE_INFO());
+        }
+
+        TEST_METHOD(test_beta) {
+            beta_distribution<double> uniform(1.0, 1.0);
+            beta_distribution<double> symmetric(2.0, 2.0);
+            beta_distribution<double> square(2.0, 1.0);
+            beta_distribution<double> skewed(0.5, 3.0);
+
+            for (std::size_t i = 1; i < 100; ++i) {
+                const auto p = static_cast<double>(i) / 100.0;
+                Assert::AreEqual(p, uniform.quantile(p), 0.000000000001, L"Uniform", LINE_INFO());
+                Assert::AreEqual(std::sqrt(p), square.quantile(p), 0.000000000001, L"x^2", LINE_INFO());
+            }
+
+            Assert::AreEqual(0.5, symmetric.quantile(0.5), 0.000000000001, L"Symmetric median", LINE_INFO());
+            Assert::AreEqual(0.0, skewed.quantile(0.0), 0.0, L"Lower bound", LINE_INFO());
+            Assert::AreEqual(1.0, skewed.quantile(1.0), 0.0, L"Upper bound", LINE_INFO());
+            round_trip(symmetric, 0.000000000001);
+            round_trip(skewed, 0.000000000001);
+            round_trip(beta_distribution<double>(5.0, 0.7), 0.000000000001);
+
+            Assert::ExpectException<std::invalid_argument>([]() { beta_distribution<double>(0.0, 1.0); }, L"Invalid alpha", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { beta_distribution<double>(1.0, -1.0); }, L"Invalid beta", LINE_INFO());
+        }
+
+        TEST_METHOD(test_empirical) {
+            const std::vector<double> data { 4.0, 1.0, 3.0, 2.0, 0.0 };
+            empirical_distribution<double> distribution(data.begin(), data.end());
+            Assert::AreEqual(std::size_t(5), distribution.quantiles().size(), L"All values retained", LINE_INFO());
+            Assert::IsTrue(std::is_sorted(distribution.quantiles().begin(), distribution.quantiles().end()), L"Table sorted", LINE_INFO());
+            Assert::AreEqual(0.0, distribution.quantile(0.0), 0.0, L"Minimum", LINE_INFO());
+            Assert::AreEqual(2.0, distribution.quantile(0.5), 0.000000000001, L"Median", LINE_INFO());
+            Assert::AreEqual(2.4, distribution.quantile(0.6), 0.000000000001, L"Interpolated", LINE_INFO());
+            Assert::AreEqual(4.0, distribution.quantile(1.0), 0.0, L"Maximum", LINE_INFO());
+            Assert::AreEqual(0.6, distribution.cdf(2.4), 0.000000000001, L"cdf", LINE_INFO());
+            Assert::AreEqual(0.0, distribution.cdf(-1.0), 0.0, L"cdf below", LINE_INFO());
+            Assert::AreEqual(1.0, distribution.cdf(5.0), 0.0, L"cdf above", LINE_INFO());
+            round_trip(distribution, 0.000000000001);
+
+            auto single = make_empirical(std::vector<int> { 3 });
+            Assert::AreEqual(3.0, single.quantile(0.0), 0.0, L"Single value", LINE_INFO());
+            Assert::AreEqual(3.0, single.quantile(1.0), 0.0, L"Single value", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([]() { empirical_distribution<double>(std::vector<double>()); }, L"Empty", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([&data]() { make_empirical(data, 1); }, L"Table too small", LINE_INFO());
+        }
+
+        TEST_METHOD(test_empirical_downsampled) {
+            std::mt19937 rng(42);
+            std::normal_distribution<double> normal(0.0, 1.0);
+            std::vector<double> data(100000);
+            std::generate(data.begin(), data.end(), [&]() { return normal(rng); });
+            const auto minimum = *std::min_element(data.begin(), data.end());
+            const auto maximum = *std::max_element(data.begin(), data.end());
+
+            empirical_distribution<double> full(data.begin(), data.end());
+            auto reduced = make_empirical(data, 1025);
+            Assert::AreEqual(std::size_t(1025), reduced.quantiles().size(), L"Table size", LINE_INFO());
+            Assert::AreEqual(minimum, reduced.quantile(0.0), 0.0, L"Minimum retained", LINE_INFO());
+            Assert::AreEqual(maximum, reduced.quantile(1.0), 0.0, L"Maximum retained", LINE_INFO());
+
+            for (std::size_t i = 0; i <= 1024; ++i) {
+                const auto p = static_cast<double>(i) / 1024.0;
+                Assert::AreEqual(full.quantile(p), reduced.quantile(p), 0.000000000001, L"Knots match full table", LINE_INFO());
+            }
+
+            for (std::size_t i = 1; i < 100; ++i) {
+                const auto p = static_cast<double>(i) / 100.0;
+                Assert::AreEqual(full.quantile(p), reduced.quantile(p), 0.01, L"Interpolation close to full table", LINE_INFO());
+                Assert::AreEqual(normal_distribution<double>().quantile(p), reduced.quantile(p), 0.05, L"Close to population", LINE_INFO());
+            }
+
+            auto lhs = sample(
+                [](const std::size_t p) { return random<double>(1000, p); },
+                reduced);
+            std::vector<bool> strata(lhs.size(), false);
+            for (auto& s : lhs) {
+                const auto stratum = static_cast<std::size_t>(reduced.cdf(std::get<0>(s)) * lhs.size());
+                Assert::IsFalse(strata[(std::min)(stratum, lhs.size() - 1)], L"Stratum hit once", LINE_INFO());
+                strata[(std::min)(stratum, lhs.size() - 1)] = true;
+            }
+        }
+
+        TEST_METHOD(test_truncated) {
+            auto distribution = truncate(normal_distribution<double>(), -1.0, 2.0);
+            Assert::AreEqual(-1.0, distribution.quantile(0.0), 0.000000000001, L"Lower bound", LINE_INFO());
+            Assert::AreEqual(2.0, distribution.quantile(1.0), 0.000000000001, L"Upper bound", LINE_INFO());
+
+            for (std::size_t i = 0; i <= 100; ++i) {
+                const auto x = distribution.quantile(static_cast<double>(i) / 100.0);
+                Assert::IsTrue((x >= -1.0) && (x <= 2.0), L"Within bounds", LINE_INFO());
+            }
+
+            round_trip(distribution, 0.000000000001);
+
+            auto tail = truncate(lognormal_distribution<double>(), 2.0, 3.0);
+            round_trip(tail, 0.000000000001);
+
+            Assert::ExpectException<std::invalid_argument>([]() { truncate(normal_distribution<double>(), 1.0, 1.0); }, L"Empty interval", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { truncate(normal_distribution<double>(), 100.0, 200.0); }, L"Zero probability", LINE_INFO());
+        }
+
+        TEST_METHOD(test_inverse_cdf) {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<double> unit(0.0, 1.0);
+            matrix<double, matrix_layout::row_major> rows(5000, 3);
+            random(rows, false, rng, unit);
+            matrix<double, matrix_layout::column_major> columns(rows.rows(), rows.columns());
+            for (std::size_t r = 0; r < rows.rows(); ++r) {
+                for (std::size_t c = 0; c < rows.columns(); ++c) {
+                    columns(r, c) = rows(r, c);
+                }
+            }
+
+            const normal_distribution<double> normal(1.0, 3.0);
+            const beta_distribution<double> beta(2.0, 5.0);
+            const auto expected = rows;
+
+            inverse_cdf(rows, 0, normal);
+            inverse_cdf(rows, 2, beta, 4);
+            inverse_cdf(columns, 0, normal, 0);
+            inverse_cdf(columns, 2, beta, 3);
+
+            for (std::size_t r = 0; r < rows.rows(); ++r) {
+                Assert::AreEqual(normal.quantile(expected(r, 0)), rows(r, 0), L"Transformed row-major", LINE_INFO());
+                Assert::AreEqual(expected(r, 1), rows(r, 1), L"Unchanged", LINE_INFO());
+                Assert::AreEqual(beta.quantile(expected(r, 2)), rows(r, 2), L"Transformed row-major", LINE_INFO());
+                Assert::AreEqual(rows(r, 0), columns(r, 0), L"Same for column-major", LINE_INFO());
+                Assert::AreEqual(rows(r, 1), columns(r, 1), L"Same for column-major", LINE_INFO());
+                Assert::AreEqual(rows(r, 2), columns(r, 2), L"Same for column-major", LINE_INFO());
+            }
+
+            // Each stratum must map to an interval of the same probability.
+            std::vector<bool> strata(rows.rows(), false);
+            for (std::size_t r = 0; r < rows.rows(); ++r) {
+                const auto p = normal.cdf(rows(r, 0));
+                const auto s = static_cast<std::size_t>(p * rows.rows());
+                Assert::IsFalse(strata[s], L"Stratum hit once", LINE_INFO());
+                strata[s] = true;
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&rows, &normal]() { inverse_cdf(rows, 3, normal); }, L"Invalid column", LINE_INFO());
+        }
+
+        TEST_METHOD(test_bounds) {
+            const normal_distribution<double> normal(5.0, 1.0);
+            const lognormal_distribution<float> lognormal;
+            typedef detail::sample_value_type<normal_distribution<double>> normal_type;
+            typedef detail::sample_value_type<lognormal_distribution<float>> lognormal_type;
+
+            Assert::IsTrue(std::isfinite(normal_type::realise(0.0, normal)), L"p = 0 is finite", LINE_INFO());
+            Assert::IsTrue(std::isfinite(normal_type::realise(1.0f, normal)), L"p = 1 is finite", LINE_INFO());
+            Assert::IsTrue(normal_type::realise(0.0, normal) < normal_type::realise(0.001, normal), L"p = 0 is the lower tail", LINE_INFO());
+            Assert::IsTrue(normal_type::realise(1.0, normal) > normal_type::realise(0.999, normal), L"p = 1 is the upper tail", LINE_INFO());
+            Assert::IsTrue(lognormal_type::realise(0.0, lognormal) > 0.0f, L"Lognormal p = 0 is positive", LINE_INFO());
+            Assert::IsTrue(std::isfinite(lognormal_type::realise(1.0, lognormal)), L"Lognormal p = 1 is finite", LINE_INFO());
+
+            matrix<double> unit(2, 1);
+            unit(0, 0) = 0.0;
+            unit(1, 0) = 1.0;
+            inverse_cdf(unit, 0, normal);
+            Assert::IsTrue(std::isfinite(unit(0, 0)), L"Transformed p = 0 is finite", LINE_INFO());
+            Assert::IsTrue(std::isfinite(unit(1, 0)), L"Transformed p = 1 is finite", LINE_INFO());
+        }
+
+        TEST_METHOD(test_sample) {
+            auto lhs = sample(
+                [](const std::size_t p) { return random<double>(100, p); },
+                normal_distribution<double>(5.0, 1.0),
+                triangular_distribution<float>(0.0f, 1.0f, 2.0f),
+                truncate(lognormal_distribution<double>(), 0.5, 1.5),
+                make_range(1, 10));
+
+            Assert::AreEqual(std::size_t(100), lhs.size(), L"Number of samples", LINE_INFO());
+            static_assert(std::is_same_v<float, std::tuple_element_t<1, decltype(lhs)::value_type>>, "Type of triangular parameter");
+
+            auto mean = 0.0;
+            for (auto& s : lhs) {
+                mean += std::get<0>(s);
+                Assert::IsTrue((std::get<1>(s) >= 0.0f) && (std::get<1>(s) <= 2.0f), L"Triangular within bounds", LINE_INFO());
+                Assert::IsTrue((std::get<2>(s) >= 0.5) && (std::get<2>(s) <= 1.5), L"Truncated within bounds", LINE_INFO());
+            }
+
+            // The sample is stratified, so the mean is very close to the
+            // expected value.
+            Assert::AreEqual(5.0, mean / lhs.size(), 0.05, L"Mean of normal parameter", LINE_INFO());
+        }
+    };
+}
@@ -0,0 +1,90 @@
+﻿// <copyright file="mapped_allocator_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/centred.h"
+#include "visus/lhs/mapped_allocator.h"
+#include "visus/lhs/random.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(mapped_allocator_test) {
+
+        TEST_METHOD(test_allocate) {
+            mapped_allocator<double> allocator;
+            Assert::IsNull(allocator.allocate(0), L"Empty allocation", LINE_INFO());
+
+            auto data = allocator.allocate(1000);
+            Assert::IsNotNull(data, L"Allocation succeeded", LINE_INFO());
+            for (std::size_t i = 0; i < 1000; ++i) {
+                Assert::AreEqual(0.0, data[i], L"Zero-initialised", LINE_INFO());
+            }
+
+            allocator.deallocate(data, 1000);
+
+            // Reused storage must be overwritten even with zero.
+            std::vector<int, mapped_allocator<int>> reused(10, 5);
+            reused.clear();
+            reused.resize(10);
+            for (auto v : reused) {
+                Assert::AreEqual(0, v, L"Reused storage is constructed", LINE_INFO());
+            }
+
+            Assert::IsTrue(mapped_allocator<float>() == mapped_allocator<int>(), L"Interchangable", LINE_INFO());
+        }
+
+        TEST_METHOD(test_matrix) {
+            mapped_matrix<float> lhs(1000, 4, 1.0f);
+            Assert::IsTrue(lhs.column_major(), L"Column-major by default", LINE_INFO());
+            Assert::AreEqual(1.0f, lhs(999, 3), L"Initial value", LINE_INFO());
+
+            auto copy = lhs;
+            copy(0, 0) = 2.0f;
+            Assert::AreEqual(1.0f, lhs(0, 0), L"Copy is independent", LINE_INFO());
+
+            mapped_matrix<int> reassigned(10, 10, 7);
+            reassigned = mapped_matrix<int>(2, 2, 1);
+            reassigned = mapped_matrix<int>(10, 10, 0);
+            for (auto v : reassigned) {
+                Assert::AreEqual(0, v, L"Reassigned to zero", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_random) {
+            for (const auto preserve_draw : { false, true }) {
+                std::mt19937 rng1(42), rng2(42);
+                std::uniform_real_distribution<double> d1, d2;
+                mapped_matrix<double> actual(500, 6);
+                random(actual, preserve_draw, rng1, d1);
+                Assert::IsTrue(valid(actual), L"Mapped sample is valid", LINE_INFO());
+
+                matrix<double, matrix_layout::column_major> expected(500, 6);
+                random(expected, preserve_draw, rng2, d2);
+
+                for (std::size_t r = 0; r < actual.rows(); ++r) {
+                    for (std::size_t c = 0; c < actual.columns(); ++c) {
+                        Assert::AreEqual(expected(r, c), actual(r, c), L"Same as in memory", LINE_INFO());
+                    }
+                }
+            }
+
+            std::mt19937 rng(7);
+            mapped_matrix<std::uint32_t, matrix_layout::row_major, mapping_hints::sequential | mapping_hints::huge_pages> indices(300, 3);
+            random(indices, rng);
+            Assert::IsTrue(valid(indices), L"Mapped indices are valid", LINE_INFO());
+
+            mapped_matrix<float> centre(200, 2);
+            centred(centre, rng, std::uniform_real_distribution<float>());
+            Assert::IsTrue(valid(centre), L"Mapped centred sample is valid", LINE_INFO());
+        }
+    };
+}
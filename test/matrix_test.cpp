@@ -1,1005 +1,1219 @@
-﻿// <copyright file="matrix_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
-// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
-// Licensed under the MIT licence. See LICENCE file for details.
-// </copyright>
-// <author>Christoph Müller</author>
-
-#include <CppUnitTest.h>
-
-#include "visus/lhs/layout.h"
-#include "visus/lhs/matrix.h"
-
-using namespace Microsoft::VisualStudio::CppUnitTestFramework;
-using namespace visus::lhs;
-
-
-namespace test {
-
-    TEST_CLASS(matrix_test) {
-
-        TEST_METHOD(test_dimensions) {
-            {
-                matrix<float, matrix_layout::row_major> m(3, 4);
-                Assert::AreEqual(static_cast<std::size_t>(3), m.rows(), L"rows", LINE_INFO());
-                Assert::AreEqual(static_cast<std::size_t>(4), m.columns(), L"columns", LINE_INFO());
-                Assert::AreEqual(static_cast<std::size_t>(12), m.size(), L"size", LINE_INFO());
-                Assert::IsFalse(m.empty(), L"empty", LINE_INFO());
-                Assert::AreEqual(m.columns(), m.stride(), L"stride", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::row_major> m(4, 3);
-                Assert::AreEqual(static_cast<std::size_t>(4), m.rows(), L"rows", LINE_INFO());
-                Assert::AreEqual(static_cast<std::size_t>(3), m.columns(), L"columns", LINE_INFO());
-                Assert::AreEqual(static_cast<std::size_t>(12), m.size(), L"size", LINE_INFO());
-                Assert::IsFalse(m.empty(), L"empty", LINE_INFO());
-                Assert::AreEqual(m.columns(), m.stride(), L"stride", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> m(3, 4);
-                Assert::AreEqual(static_cast<std::size_t>(3), m.rows(), L"rows", LINE_INFO());
-                Assert::AreEqual(static_cast<std::size_t>(4), m.columns(), L"columns", LINE_INFO());
-                Assert::AreEqual(static_cast<std::size_t>(12), m.size(), L"size", LINE_INFO());
-                Assert::IsFalse(m.empty(), L"empty", LINE_INFO());
-                Assert::AreEqual(m.rows(), m.stride(), L"stride", LINE_INFO());
-            }
-        }
-
-        TEST_METHOD(test_index) {
-            {
-                matrix<float, matrix_layout::row_major> m(3, 3);
-                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(1), m.index(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(2), m.index(0, 2), L"0, 1", LINE_INFO());
-
-                Assert::AreEqual(std::size_t(3), m.index(1, 0), L"1, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(4), m.index(1, 1), L"1, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(5), m.index(1, 2), L"1, 1", LINE_INFO());
-
-                Assert::AreEqual(std::size_t(6), m.index(2, 0), L"2, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(7), m.index(2, 1), L"2, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(8), m.index(2, 2), L"2, 1", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> m(3, 3);
-                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(1), m.index(1, 0), L"1, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(2), m.index(2, 0), L"2, 1", LINE_INFO());
-
-                Assert::AreEqual(std::size_t(3), m.index(0, 1), L"1, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(4), m.index(1, 1), L"1, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(5), m.index(2, 1), L"2, 1", LINE_INFO());
-
-                Assert::AreEqual(std::size_t(6), m.index(0, 2), L"0, 2", LINE_INFO());
-                Assert::AreEqual(std::size_t(7), m.index(1, 2), L"1, 2", LINE_INFO());
-                Assert::AreEqual(std::size_t(8), m.index(2, 2), L"2, 2", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::row_major> m(3, 4);
-                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(1), m.index(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(4), m.index(1, 0), L"1, 0", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::row_major> m(4, 3);
-                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(1), m.index(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(3), m.index(1, 0), L"1, 0", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> m(3, 4);
-                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(std::size_t(3), m.index(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(std::size_t(1), m.index(1, 0), L"1, 0", LINE_INFO());
-            }
-        }
-
-        TEST_METHOD(test_reverse_index) {
-            {
-                matrix<float, matrix_layout::row_major> m(3, 4);
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 0);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 1);
-                    Assert::AreEqual(std::size_t(0), row, L"row 1", LINE_INFO());
-                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 4);
-                    Assert::AreEqual(std::size_t(1), row, L"row 4", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 4", LINE_INFO());
-                }
-            }
-
-            {
-                matrix<float, matrix_layout::row_major> m(4, 3);
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 0);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 1);
-                    Assert::AreEqual(std::size_t(0), row, L"row 1", LINE_INFO());
-                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 3);
-                    Assert::AreEqual(std::size_t(1), row, L"row 3", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 3", LINE_INFO());
-                }
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> m(3, 4);
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 0);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 1);
-                    Assert::AreEqual(std::size_t(1), row, L"row 1", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 1", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 3);
-                    Assert::AreEqual(std::size_t(0), row, L"row 3", LINE_INFO());
-                    Assert::AreEqual(std::size_t(1), col, L"column 3", LINE_INFO());
-                }
-            }
-
-            {
-                matrix<float, matrix_layout::row_major> m(1, 3);
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 0);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 1);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 2);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(2), col, L"column 2", LINE_INFO());
-                }
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> m(1, 3);
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 0);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 1);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 2);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(2), col, L"column 2", LINE_INFO());
-                }
-            }
-
-            {
-                matrix<float, matrix_layout::row_major> m(3, 1);
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 0);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 1);
-                    Assert::AreEqual(std::size_t(1), row, L"row 1", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 2);
-                    Assert::AreEqual(std::size_t(2), row, L"row 2", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> m(3, 1);
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 0);
-                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 1);
-                    Assert::AreEqual(std::size_t(1), row, L"row 1", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-
-                {
-                    std::size_t row = 0;
-                    std::size_t col = 0;
-                    m.index(row, col, 2);
-                    Assert::AreEqual(std::size_t(2), row, L"row 2", LINE_INFO());
-                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
-                }
-            }
-        }
-
-        TEST_METHOD(test_indexers_row_major) {
-            matrix<float, matrix_layout::row_major> m(3, 4);
-
-            m(0, 0) = 0.0f;
-            m(0, 1) = 0.1f;
-            m(0, 2) = 0.2f;
-            m(0, 3) = 0.3f;
-
-            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
-
-            m(1, 0) = 1.0f;
-            m(1, 1) = 1.1f;
-            m(1, 2) = 1.2f;
-            m(1, 3) = 1.3f;
-
-            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
-
-            m(2, 0) = 2.0f;
-            m(2, 1) = 2.1f;
-            m(2, 2) = 2.2f;
-            m(2, 3) = 2.3f;
-
-            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(2.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(2.1f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(2.2f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(2.3f, m(2, 3), L"2, 3", LINE_INFO());
-
-            Assert::AreEqual(int(matrix_layout::row_major), int(m.layout()), L"Matrix layout", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m[0], L"0", LINE_INFO());
-            Assert::AreEqual(0.1f, m[1], L"1", LINE_INFO());
-            Assert::AreEqual(0.2f, m[2], L"2", LINE_INFO());
-            Assert::AreEqual(0.3f, m[3], L"3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, m[4], L"4", LINE_INFO());
-            Assert::AreEqual(1.1f, m[5], L"5", LINE_INFO());
-            Assert::AreEqual(1.2f, m[6], L"6", LINE_INFO());
-            Assert::AreEqual(1.3f, m[7], L"7", LINE_INFO());
-
-            Assert::AreEqual(2.0f, m[8], L"8", LINE_INFO());
-            Assert::AreEqual(2.1f, m[9], L"9", LINE_INFO());
-            Assert::AreEqual(2.2f, m[10], L"10", LINE_INFO());
-            Assert::AreEqual(2.3f, m[11], L"11", LINE_INFO());
-        }
-
-        TEST_METHOD(test_indexers_colum_major) {
-            matrix<float, matrix_layout::column_major> m(3, 4);
-
-            m(0, 0) = 0.0f;
-            m(0, 1) = 0.1f;
-            m(0, 2) = 0.2f;
-            m(0, 3) = 0.3f;
-
-            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
-
-            m(1, 0) = 1.0f;
-            m(1, 1) = 1.1f;
-            m(1, 2) = 1.2f;
-            m(1, 3) = 1.3f;
-
-            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
-
-            m(2, 0) = 2.0f;
-            m(2, 1) = 2.1f;
-            m(2, 2) = 2.2f;
-            m(2, 3) = 2.3f;
-
-            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(2.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(2.1f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(2.2f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(2.3f, m(2, 3), L"2, 3", LINE_INFO());
-
-            Assert::AreEqual(int(matrix_layout::column_major), int(m.layout()), L"Matrix layout", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m[0], L"0", LINE_INFO());
-            Assert::AreEqual(1.0f, m[1], L"1", LINE_INFO());
-            Assert::AreEqual(2.0f, m[2], L"2", LINE_INFO());
-
-            Assert::AreEqual(0.1f, m[3], L"3", LINE_INFO());
-            Assert::AreEqual(1.1f, m[4], L"4", LINE_INFO());
-            Assert::AreEqual(2.1f, m[5], L"5", LINE_INFO());
-
-            Assert::AreEqual(0.2f, m[6], L"6", LINE_INFO());
-            Assert::AreEqual(1.2f, m[7], L"7", LINE_INFO());
-            Assert::AreEqual(2.2f, m[8], L"8", LINE_INFO());
-
-            Assert::AreEqual(0.3f, m[9], L"9", LINE_INFO());
-            Assert::AreEqual(1.3f, m[10], L"10", LINE_INFO());
-            Assert::AreEqual(2.3f, m[11], L"11", LINE_INFO());
-        }
-
-        TEST_METHOD(test_fill) {
-            matrix<float> m(3, 4);
-            m.fill(42.0f);
-
-            Assert::AreEqual(42.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(42.0f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(42.0f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(42.0f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(42.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(42.0f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(42.0f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(42.0f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(42.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(42.0f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(42.0f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(42.0f, m(2, 3), L"2, 3", LINE_INFO());
-
-            m.fill([&m](const std::size_t r, const std::size_t c) {
-                return static_cast<float>(m.index(r, c));
-            });
-
-            Assert::AreEqual(0.0f, m[0], L"0", LINE_INFO());
-            Assert::AreEqual(1.0f, m[1], L"1", LINE_INFO());
-            Assert::AreEqual(2.0f, m[2], L"2", LINE_INFO());
-            Assert::AreEqual(3.0f, m[3], L"3", LINE_INFO());
-
-            Assert::AreEqual(4.0f, m[4], L"4", LINE_INFO());
-            Assert::AreEqual(5.0f, m[5], L"5", LINE_INFO());
-            Assert::AreEqual(6.0f, m[6], L"6", LINE_INFO());
-            Assert::AreEqual(7.0f, m[7], L"7", LINE_INFO());
-
-            Assert::AreEqual(8.0f, m[8], L"8", LINE_INFO());
-            Assert::AreEqual(9.0f, m[9], L"9", LINE_INFO());
-            Assert::AreEqual(10.0f, m[10], L"10", LINE_INFO());
-            Assert::AreEqual(11.0f, m[11], L"11", LINE_INFO());
-        }
-
-        TEST_METHOD(test_equality) {
-            matrix<float> m1(3, 4);
-            m1.fill(42.0f);
-
-            matrix<float> m2(3, 4);
-            Assert::IsFalse(m1 == m2, L"m1 == m2", LINE_INFO());
-
-            m2 = m1;
-            Assert::IsTrue(m1 == m2, L"m1 == m2", LINE_INFO());
-
-            matrix<float> m3(4, 3);
-            m3.fill(42.0f);
-            Assert::IsFalse(m1 == m3, L"m1 == m3", LINE_INFO());
-        }
-
-        TEST_METHOD(test_row) {
-            matrix<float> m(3, 4);
-
-            m(0, 0) = 0.0f;
-            m(0, 1) = 0.1f;
-            m(0, 2) = 0.2f;
-            m(0, 3) = 0.3f;
-
-            m(1, 0) = 1.0f;
-            m(1, 1) = 1.1f;
-            m(1, 2) = 1.2f;
-            m(1, 3) = 1.3f;
-
-            m(2, 0) = 2.0f;
-            m(2, 1) = 2.1f;
-            m(2, 2) = 2.2f;
-            m(2, 3) = 2.3f;
-
-            {
-                matrix<float> r(1, 4);
-                m.row(r, 0);
-                Assert::AreEqual(0.0f, r(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(0.1f, r(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(0.2f, r(0, 2), L"0, 2", LINE_INFO());
-                Assert::AreEqual(0.3f, r(0, 3), L"0, 3", LINE_INFO());
-            }
-
-            {
-                matrix<float> r(1, 4);
-                m.row(r, 1);
-                Assert::AreEqual(1.0f, r(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.1f, r(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(1.2f, r(0, 2), L"0, 2", LINE_INFO());
-                Assert::AreEqual(1.3f, r(0, 3), L"0, 3", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> r(1, 4);
-                m.row(r, 0);
-                Assert::AreEqual(0.0f, r(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(0.1f, r(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(0.2f, r(0, 2), L"0, 2", LINE_INFO());
-                Assert::AreEqual(0.3f, r(0, 3), L"0, 3", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> r(1, 4);
-                m.row(r, 1);
-                Assert::AreEqual(1.0f, r(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.1f, r(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(1.2f, r(0, 2), L"0, 2", LINE_INFO());
-                Assert::AreEqual(1.3f, r(0, 3), L"0, 3", LINE_INFO());
-            }
-
-            {
-                auto r = m.row(0);
-                Assert::AreEqual(0.0f, r(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(0.1f, r(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(0.2f, r(0, 2), L"0, 2", LINE_INFO());
-                Assert::AreEqual(0.3f, r(0, 3), L"0, 3", LINE_INFO());
-            }
-
-            {
-                auto r = m.row(1);
-                Assert::AreEqual(1.0f, r(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.1f, r(0, 1), L"0, 1", LINE_INFO());
-                Assert::AreEqual(1.2f, r(0, 2), L"0, 2", LINE_INFO());
-                Assert::AreEqual(1.3f, r(0, 3), L"0, 3", LINE_INFO());
-            }
-        }
-
-        TEST_METHOD(test_column) {
-            matrix<float> m(3, 4);
-
-            m(0, 0) = 0.0f;
-            m(0, 1) = 0.1f;
-            m(0, 2) = 0.2f;
-            m(0, 3) = 0.3f;
-
-            m(1, 0) = 1.0f;
-            m(1, 1) = 1.1f;
-            m(1, 2) = 1.2f;
-            m(1, 3) = 1.3f;
-
-            m(2, 0) = 2.0f;
-            m(2, 1) = 2.1f;
-            m(2, 2) = 2.2f;
-            m(2, 3) = 2.3f;
-
-            {
-                matrix<float> c(3, 1);
-                m.column(c, 0);
-                Assert::AreEqual(0.0f, c(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.0f, c(1, 0), L"1, 0", LINE_INFO());
-                Assert::AreEqual(2.0f, c(2, 0), L"2, 2", LINE_INFO());
-            }
-
-            {
-                matrix<float> c(3, 1);
-                m.column(c, 1);
-                Assert::AreEqual(0.1f, c(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.1f, c(1, 0), L"1, 0", LINE_INFO());
-                Assert::AreEqual(2.1f, c(2, 0), L"2, 2", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> c(3, 1);
-                m.column(c, 0);
-                Assert::AreEqual(0.0f, c(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.0f, c(1, 0), L"1, 0", LINE_INFO());
-                Assert::AreEqual(2.0f, c(2, 0), L"2, 2", LINE_INFO());
-            }
-
-            {
-                matrix<float, matrix_layout::column_major> c(3, 1);
-                m.column(c, 1);
-                Assert::AreEqual(0.1f, c(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.1f, c(1, 0), L"1, 0", LINE_INFO());
-                Assert::AreEqual(2.1f, c(2, 0), L"2, 2", LINE_INFO());
-            }
-
-            {
-                auto c = m.column(0);
-                Assert::AreEqual(0.0f, c(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.0f, c(1, 0), L"1, 0", LINE_INFO());
-                Assert::AreEqual(2.0f, c(2, 0), L"2, 2", LINE_INFO());
-            }
-
-            {
-                auto c = m.column(1);
-                Assert::AreEqual(0.1f, c(0, 0), L"0, 0", LINE_INFO());
-                Assert::AreEqual(1.1f, c(1, 0), L"1, 0", LINE_INFO());
-                Assert::AreEqual(2.1f, c(2, 0), L"2, 2", LINE_INFO());
-            }
-        }
-
-        TEST_METHOD(test_diagonal) {
-            auto m = matrix<float>::diagonal(4, 42.0f);
-            Assert::AreEqual(42.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(42.0f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(42.0f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(3, 0), L"3, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(3, 1), L"3, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(3, 2), L"3, 2", LINE_INFO());
-            Assert::AreEqual(42.0f, m(3, 3), L"3, 3", LINE_INFO());
-        }
-
-        TEST_METHOD(test_identity) {
-            auto m = matrix<float>::identity(4);
-            Assert::AreEqual(1.0f, m(0, 0), L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(0, 1), L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(0, 2), L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(0, 3), L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.0f, m(1, 1), L"1, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
-            Assert::AreEqual(1.0f, m(2, 2), L"2, 2", LINE_INFO());
-            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
-
-            Assert::AreEqual(0.0f, m(3, 0), L"3, 0", LINE_INFO());
-            Assert::AreEqual(0.0f, m(3, 1), L"3, 1", LINE_INFO());
-            Assert::AreEqual(0.0f, m(3, 2), L"3, 2", LINE_INFO());
-            Assert::AreEqual(1.0f, m(3, 3), L"3, 3", LINE_INFO());
-        }
-
-        TEST_METHOD(test_layout) {
-            {
-                typedef matrix<float, matrix_layout::row_major> type;
-                type m;
-                Assert::AreEqual(int(matrix_layout::row_major), int(m.layout()), L"get", LINE_INFO());
-                Assert::AreEqual(int(matrix_layout::row_major), int(detail::layout_v<type>), L"traits", LINE_INFO());
-            }
-
-            {
-                typedef matrix<float, matrix_layout::column_major> type;
-                type m;
-                Assert::AreEqual(int(matrix_layout::column_major), int(m.layout()), L"get", LINE_INFO());
-                Assert::AreEqual(int(matrix_layout::column_major), int(detail::layout_v<type>), L"traits", LINE_INFO());
-            }
-        }
-
-        TEST_METHOD(test_cm_col_iterator) {
-            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_columns();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_cm_const_col_iterator) {
-            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_columns();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_rm_col_iterator) {
-            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_columns();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_rm_const_col_iterator) {
-            const matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_columns();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_cm_row_iterator) {
-            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_rows();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_cm_const_row_iterator) {
-            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_rows();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_rm_row_iterator) {
-            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_rows();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_rm_const_row_iterator) {
-            const matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_rows();
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_cm_single_col_iterator) {
-            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_column(1);
-
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_column(1), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_cm_single_const_col_iterator) {
-            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_column(1);
-
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_column(1), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_rm_single_col_iterator) {
-            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_column(1);
-
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_column(1), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_rm_single_const_col_iterator) {
-            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_column(2);
-
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_column(2), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_cm_single_row_iterator) {
-            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_row(2);
-
-            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
-            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
-            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
-            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_row(2), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_cm_single_const_row_iterator) {
-            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_row(0);
-
-            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
-            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
-            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
-            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_row(0), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_single_rm_row_iterator) {
-            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_row(1);
-
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_row(1), L"end reached", LINE_INFO());
-        }
-
-        TEST_METHOD(test_rm_single_const_row_iterator) {
-            const matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
-
-            auto it = m.begin_row(1);
-
-            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
-            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
-            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
-            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
-
-            Assert::IsTrue(it == m.end_row(1), L"end reached", LINE_INFO());
-        }
-
-    };
-
-}
+﻿// <copyright file="matrix_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/aligned_allocator.h"
+#include "visus/lhs/layout.h"
+#include "visus/lhs/matrix.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+
+
+namespace test {
+
+    TEST_CLASS(matrix_test) {
+
+        TEST_METHOD(test_dimensions) {
+            {
+                matrix<float, matrix_layout::row_major> m(3, 4);
+                Assert::AreEqual(static_cast<std::size_t>(3), m.rows(), L"rows", LINE_INFO());
+                Assert::AreEqual(static_cast<std::size_t>(4), m.columns(), L"columns", LINE_INFO());
+                Assert::AreEqual(static_cast<std::size_t>(12), m.size(), L"size", LINE_INFO());
+                Assert::IsFalse(m.empty(), L"empty", LINE_INFO());
+                Assert::AreEqual(m.columns(), m.stride(), L"stride", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::row_major> m(4, 3);
+                Assert::AreEqual(static_cast<std::size_t>(4), m.rows(), L"rows", LINE_INFO());
+                Assert::AreEqual(static_cast<std::size_t>(3), m.columns(), L"columns", LINE_INFO());
+                Assert::AreEqual(static_cast<std::size_t>(12), m.size(), L"size", LINE_INFO());
+                Assert::IsFalse(m.empty(), L"empty", LINE_INFO());
+                Assert::AreEqual(m.columns(), m.stride(), L"stride", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> m(3, 4);
+                Assert::AreEqual(static_cast<std::size_t>(3), m.rows(), L"rows", LINE_INFO());
+                Assert::AreEqual(static_cast<std::size_t>(4), m.columns(), L"columns", LINE_INFO());
+                Assert::AreEqual(static_cast<std::size_t>(12), m.size(), L"size", LINE_INFO());
+                Assert::IsFalse(m.empty(), L"empty", LINE_INFO());
+                Assert::AreEqual(m.rows(), m.stride(), L"stride", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_index) {
+            {
+                matrix<float, matrix_layout::row_major> m(3, 3);
+                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(1), m.index(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(2), m.index(0, 2), L"0, 1", LINE_INFO());
+
+                Assert::AreEqual(std::size_t(3), m.index(1, 0), L"1, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(4), m.index(1, 1), L"1, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(5), m.index(1, 2), L"1, 1", LINE_INFO());
+
+                Assert::AreEqual(std::size_t(6), m.index(2, 0), L"2, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(7), m.index(2, 1), L"2, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(8), m.index(2, 2), L"2, 1", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> m(3, 3);
+                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(1), m.index(1, 0), L"1, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(2), m.index(2, 0), L"2, 1", LINE_INFO());
+
+                Assert::AreEqual(std::size_t(3), m.index(0, 1), L"1, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(4), m.index(1, 1), L"1, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(5), m.index(2, 1), L"2, 1", LINE_INFO());
+
+                Assert::AreEqual(std::size_t(6), m.index(0, 2), L"0, 2", LINE_INFO());
+                Assert::AreEqual(std::size_t(7), m.index(1, 2), L"1, 2", LINE_INFO());
+                Assert::AreEqual(std::size_t(8), m.index(2, 2), L"2, 2", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::row_major> m(3, 4);
+                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(1), m.index(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(4), m.index(1, 0), L"1, 0", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::row_major> m(4, 3);
+                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(1), m.index(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(3), m.index(1, 0), L"1, 0", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> m(3, 4);
+                Assert::AreEqual(std::size_t(0), m.index(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(std::size_t(3), m.index(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(std::size_t(1), m.index(1, 0), L"1, 0", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_reverse_index) {
+            {
+                matrix<float, matrix_layout::row_major> m(3, 4);
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 0);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 1);
+                    Assert::AreEqual(std::size_t(0), row, L"row 1", LINE_INFO());
+                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 4);
+                    Assert::AreEqual(std::size_t(1), row, L"row 4", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 4", LINE_INFO());
+                }
+            }
+
+            {
+                matrix<float, matrix_layout::row_major> m(4, 3);
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 0);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 1);
+                    Assert::AreEqual(std::size_t(0), row, L"row 1", LINE_INFO());
+                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 3);
+                    Assert::AreEqual(std::size_t(1), row, L"row 3", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 3", LINE_INFO());
+                }
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> m(3, 4);
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 0);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 1);
+                    Assert::AreEqual(std::size_t(1), row, L"row 1", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 1", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 3);
+                    Assert::AreEqual(std::size_t(0), row, L"row 3", LINE_INFO());
+                    Assert::AreEqual(std::size_t(1), col, L"column 3", LINE_INFO());
+                }
+            }
+
+            {
+                matrix<float, matrix_layout::row_major> m(1, 3);
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 0);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 1);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 2);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(2), col, L"column 2", LINE_INFO());
+                }
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> m(1, 3);
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 0);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 1);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(1), col, L"column 1", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 2);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(2), col, L"column 2", LINE_INFO());
+                }
+            }
+
+            {
+                matrix<float, matrix_layout::row_major> m(3, 1);
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 0);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 1);
+                    Assert::AreEqual(std::size_t(1), row, L"row 1", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 2);
+                    Assert::AreEqual(std::size_t(2), row, L"row 2", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> m(3, 1);
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 0);
+                    Assert::AreEqual(std::size_t(0), row, L"row 0", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 1);
+                    Assert::AreEqual(std::size_t(1), row, L"row 1", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+
+                {
+                    std::size_t row = 0;
+                    std::size_t col = 0;
+                    m.index(row, col, 2);
+                    Assert::AreEqual(std::size_t(2), row, L"row 2", LINE_INFO());
+                    Assert::AreEqual(std::size_t(0), col, L"column 0", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(test_indexers_row_major) {
+            matrix<float, matrix_layout::row_major> m(3, 4);
+
+            m(0, 0) = 0.0f;
+            m(0, 1) = 0.1f;
+            m(0, 2) = 0.2f;
+            m(0, 3) = 0.3f;
+
+            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
+
+            m(1, 0) = 1.0f;
+            m(1, 1) = 1.1f;
+            m(1, 2) = 1.2f;
+            m(1, 3) = 1.3f;
+
+            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
+
+            m(2, 0) = 2.0f;
+            m(2, 1) = 2.1f;
+            m(2, 2) = 2.2f;
+            m(2, 3) = 2.3f;
+
+            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(2.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(2.1f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(2.2f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(2.3f, m(2, 3), L"2, 3", LINE_INFO());
+
+            Assert::AreEqual(int(matrix_layout::row_major), int(m.layout()), L"Matrix layout", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m[0], L"0", LINE_INFO());
+            Assert::AreEqual(0.1f, m[1], L"1", LINE_INFO());
+            Assert::AreEqual(0.2f, m[2], L"2", LINE_INFO());
+            Assert::AreEqual(0.3f, m[3], L"3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, m[4], L"4", LINE_INFO());
+            Assert::AreEqual(1.1f, m[5], L"5", LINE_INFO());
+            Assert::AreEqual(1.2f, m[6], L"6", LINE_INFO());
+            Assert::AreEqual(1.3f, m[7], L"7", LINE_INFO());
+
+            Assert::AreEqual(2.0f, m[8], L"8", LINE_INFO());
+            Assert::AreEqual(2.1f, m[9], L"9", LINE_INFO());
+            Assert::AreEqual(2.2f, m[10], L"10", LINE_INFO());
+            Assert::AreEqual(2.3f, m[11], L"11", LINE_INFO());
+        }
+
+        TEST_METHOD(test_indexers_colum_major) {
+            matrix<float, matrix_layout::column_major> m(3, 4);
+
+            m(0, 0) = 0.0f;
+            m(0, 1) = 0.1f;
+            m(0, 2) = 0.2f;
+            m(0, 3) = 0.3f;
+
+            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
+
+            m(1, 0) = 1.0f;
+            m(1, 1) = 1.1f;
+            m(1, 2) = 1.2f;
+            m(1, 3) = 1.3f;
+
+            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
+
+            m(2, 0) = 2.0f;
+            m(2, 1) = 2.1f;
+            m(2, 2) = 2.2f;
+            m(2, 3) = 2.3f;
+
+            Assert::AreEqual(0.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(2.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(2.1f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(2.2f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(2.3f, m(2, 3), L"2, 3", LINE_INFO());
+
+            Assert::AreEqual(int(matrix_layout::column_major), int(m.layout()), L"Matrix layout", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m[0], L"0", LINE_INFO());
+            Assert::AreEqual(1.0f, m[1], L"1", LINE_INFO());
+            Assert::AreEqual(2.0f, m[2], L"2", LINE_INFO());
+
+            Assert::AreEqual(0.1f, m[3], L"3", LINE_INFO());
+            Assert::AreEqual(1.1f, m[4], L"4", LINE_INFO());
+            Assert::AreEqual(2.1f, m[5], L"5", LINE_INFO());
+
+            Assert::AreEqual(0.2f, m[6], L"6", LINE_INFO());
+            Assert::AreEqual(1.2f, m[7], L"7", LINE_INFO());
+            Assert::AreEqual(2.2f, m[8], L"8", LINE_INFO());
+
+            Assert::AreEqual(0.3f, m[9], L"9", LINE_INFO());
+            Assert::AreEqual(1.3f, m[10], L"10", LINE_INFO());
+            Assert::AreEqual(2.3f, m[11], L"11", LINE_INFO());
+        }
+
+        TEST_METHOD(test_fill) {
+            matrix<float> m(3, 4);
+            m.fill(42.0f);
+
+            Assert::AreEqual(42.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(42.0f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(42.0f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(42.0f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(42.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(42.0f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(42.0f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(42.0f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(42.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(42.0f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(42.0f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(42.0f, m(2, 3), L"2, 3", LINE_INFO());
+
+            m.fill([&m](const std::size_t r, const std::size_t c) {
+                return static_cast<float>(m.index(r, c));
+            });
+
+            Assert::AreEqual(0.0f, m[0], L"0", LINE_INFO());
+            Assert::AreEqual(1.0f, m[1], L"1", LINE_INFO());
+            Assert::AreEqual(2.0f, m[2], L"2", LINE_INFO());
+            Assert::AreEqual(3.0f, m[3], L"3", LINE_INFO());
+
+            Assert::AreEqual(4.0f, m[4], L"4", LINE_INFO());
+            Assert::AreEqual(5.0f, m[5], L"5", LINE_INFO());
+            Assert::AreEqual(6.0f, m[6], L"6", LINE_INFO());
+            Assert::AreEqual(7.0f, m[7], L"7", LINE_INFO());
+
+            Assert::AreEqual(8.0f, m[8], L"8", LINE_INFO());
+            Assert::AreEqual(9.0f, m[9], L"9", LINE_INFO());
+            Assert::AreEqual(10.0f, m[10], L"10", LINE_INFO());
+            Assert::AreEqual(11.0f, m[11], L"11", LINE_INFO());
+        }
+
+        TEST_METHOD(test_equality) {
+            matrix<float> m1(3, 4);
+            m1.fill(42.0f);
+
+            matrix<float> m2(3, 4);
+            Assert::IsFalse(m1 == m2, L"m1 == m2", LINE_INFO());
+
+            m2 = m1;
+            Assert::IsTrue(m1 == m2, L"m1 == m2", LINE_INFO());
+
+            matrix<float> m3(4, 3);
+            m3.fill(42.0f);
+            Assert::IsFalse(m1 == m3, L"m1 == m3", LINE_INFO());
+        }
+
+        TEST_METHOD(test_row) {
+            matrix<float> m(3, 4);
+
+            m(0, 0) = 0.0f;
+            m(0, 1) = 0.1f;
+            m(0, 2) = 0.2f;
+            m(0, 3) = 0.3f;
+
+            m(1, 0) = 1.0f;
+            m(1, 1) = 1.1f;
+            m(1, 2) = 1.2f;
+            m(1, 3) = 1.3f;
+
+            m(2, 0) = 2.0f;
+            m(2, 1) = 2.1f;
+            m(2, 2) = 2.2f;
+            m(2, 3) = 2.3f;
+
+            {
+                matrix<float> r(1, 4);
+                m.row(r, 0);
+                Assert::AreEqual(0.0f, r(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(0.1f, r(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(0.2f, r(0, 2), L"0, 2", LINE_INFO());
+                Assert::AreEqual(0.3f, r(0, 3), L"0, 3", LINE_INFO());
+            }
+
+            {
+                matrix<float> r(1, 4);
+                m.row(r, 1);
+                Assert::AreEqual(1.0f, r(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.1f, r(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(1.2f, r(0, 2), L"0, 2", LINE_INFO());
+                Assert::AreEqual(1.3f, r(0, 3), L"0, 3", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> r(1, 4);
+                m.row(r, 0);
+                Assert::AreEqual(0.0f, r(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(0.1f, r(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(0.2f, r(0, 2), L"0, 2", LINE_INFO());
+                Assert::AreEqual(0.3f, r(0, 3), L"0, 3", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> r(1, 4);
+                m.row(r, 1);
+                Assert::AreEqual(1.0f, r(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.1f, r(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(1.2f, r(0, 2), L"0, 2", LINE_INFO());
+                Assert::AreEqual(1.3f, r(0, 3), L"0, 3", LINE_INFO());
+            }
+
+            {
+                auto r = m.row(0);
+                Assert::AreEqual(0.0f, r(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(0.1f, r(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(0.2f, r(0, 2), L"0, 2", LINE_INFO());
+                Assert::AreEqual(0.3f, r(0, 3), L"0, 3", LINE_INFO());
+            }
+
+            {
+                auto r = m.row(1);
+                Assert::AreEqual(1.0f, r(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.1f, r(0, 1), L"0, 1", LINE_INFO());
+                Assert::AreEqual(1.2f, r(0, 2), L"0, 2", LINE_INFO());
+                Assert::AreEqual(1.3f, r(0, 3), L"0, 3", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_column) {
+            matrix<float> m(3, 4);
+
+            m(0, 0) = 0.0f;
+            m(0, 1) = 0.1f;
+            m(0, 2) = 0.2f;
+            m(0, 3) = 0.3f;
+
+            m(1, 0) = 1.0f;
+            m(1, 1) = 1.1f;
+            m(1, 2) = 1.2f;
+            m(1, 3) = 1.3f;
+
+            m(2, 0) = 2.0f;
+            m(2, 1) = 2.1f;
+            m(2, 2) = 2.2f;
+            m(2, 3) = 2.3f;
+
+            {
+                matrix<float> c(3, 1);
+                m.column(c, 0);
+                Assert::AreEqual(0.0f, c(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.0f, c(1, 0), L"1, 0", LINE_INFO());
+                Assert::AreEqual(2.0f, c(2, 0), L"2, 2", LINE_INFO());
+            }
+
+            {
+                matrix<float> c(3, 1);
+                m.column(c, 1);
+                Assert::AreEqual(0.1f, c(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.1f, c(1, 0), L"1, 0", LINE_INFO());
+                Assert::AreEqual(2.1f, c(2, 0), L"2, 2", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> c(3, 1);
+                m.column(c, 0);
+                Assert::AreEqual(0.0f, c(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.0f, c(1, 0), L"1, 0", LINE_INFO());
+                Assert::AreEqual(2.0f, c(2, 0), L"2, 2", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> c(3, 1);
+                m.column(c, 1);
+                Assert::AreEqual(0.1f, c(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.1f, c(1, 0), L"1, 0", LINE_INFO());
+                Assert::AreEqual(2.1f, c(2, 0), L"2, 2", LINE_INFO());
+            }
+
+            {
+                auto c = m.column(0);
+                Assert::AreEqual(0.0f, c(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.0f, c(1, 0), L"1, 0", LINE_INFO());
+                Assert::AreEqual(2.0f, c(2, 0), L"2, 2", LINE_INFO());
+            }
+
+            {
+                auto c = m.column(1);
+                Assert::AreEqual(0.1f, c(0, 0), L"0, 0", LINE_INFO());
+                Assert::AreEqual(1.1f, c(1, 0), L"1, 0", LINE_INFO());
+                Assert::AreEqual(2.1f, c(2, 0), L"2, 2", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_diagonal) {
+            auto m = matrix<float>::diagonal(4, 42.0f);
+            Assert::AreEqual(42.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(42.0f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(42.0f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(3, 0), L"3, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(3, 1), L"3, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(3, 2), L"3, 2", LINE_INFO());
+            Assert::AreEqual(42.0f, m(3, 3), L"3, 3", LINE_INFO());
+        }
+
+        TEST_METHOD(test_identity) {
+            auto m = matrix<float>::identity(4);
+            Assert::AreEqual(1.0f, m(0, 0), L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(0, 1), L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(0, 2), L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(0, 3), L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(1, 0), L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.0f, m(1, 1), L"1, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 2), L"1, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(1, 3), L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(2, 0), L"2, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 1), L"2, 1", LINE_INFO());
+            Assert::AreEqual(1.0f, m(2, 2), L"2, 2", LINE_INFO());
+            Assert::AreEqual(0.0f, m(2, 3), L"2, 3", LINE_INFO());
+
+            Assert::AreEqual(0.0f, m(3, 0), L"3, 0", LINE_INFO());
+            Assert::AreEqual(0.0f, m(3, 1), L"3, 1", LINE_INFO());
+            Assert::AreEqual(0.0f, m(3, 2), L"3, 2", LINE_INFO());
+            Assert::AreEqual(1.0f, m(3, 3), L"3, 3", LINE_INFO());
+        }
+
+        TEST_METHOD(test_layout) {
+            {
+                typedef matrix<float, matrix_layout::row_major> type;
+                type m;
+                Assert::AreEqual(int(matrix_layout::row_major), int(m.layout()), L"get", LINE_INFO());
+                Assert::AreEqual(int(matrix_layout::row_major), int(detail::layout_v<type>), L"traits", LINE_INFO());
+            }
+
+            {
+                typedef matrix<float, matrix_layout::column_major> type;
+                type m;
+                Assert::AreEqual(int(matrix_layout::column_major), int(m.layout()), L"get", LINE_INFO());
+                Assert::AreEqual(int(matrix_layout::column_major), int(detail::layout_v<type>), L"traits", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_cm_col_iterator) {
+            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_columns();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_cm_const_col_iterator) {
+            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_columns();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_rm_col_iterator) {
+            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_columns();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_rm_const_col_iterator) {
+            const matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_columns();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_columns(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_cm_row_iterator) {
+            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_rows();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_cm_const_row_iterator) {
+            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_rows();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_rm_row_iterator) {
+            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_rows();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_rm_const_row_iterator) {
+            const matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_rows();
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_rows(), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_cm_single_col_iterator) {
+            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_column(1);
+
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_column(1), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_cm_single_const_col_iterator) {
+            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_column(1);
+
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_column(1), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_rm_single_col_iterator) {
+            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_column(1);
+
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_column(1), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_rm_single_const_col_iterator) {
+            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_column(2);
+
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_column(2), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_cm_single_row_iterator) {
+            matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_row(2);
+
+            Assert::AreEqual(2.0f, *it++, L"2, 0", LINE_INFO());
+            Assert::AreEqual(2.1f, *it++, L"2, 1", LINE_INFO());
+            Assert::AreEqual(2.2f, *it++, L"2, 2", LINE_INFO());
+            Assert::AreEqual(2.3f, *it++, L"2, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_row(2), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_cm_single_const_row_iterator) {
+            const matrix<float, matrix_layout::column_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_row(0);
+
+            Assert::AreEqual(0.0f, *it++, L"0, 0", LINE_INFO());
+            Assert::AreEqual(0.1f, *it++, L"0, 1", LINE_INFO());
+            Assert::AreEqual(0.2f, *it++, L"0, 2", LINE_INFO());
+            Assert::AreEqual(0.3f, *it++, L"0, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_row(0), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_single_rm_row_iterator) {
+            matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_row(1);
+
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_row(1), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_rm_single_const_row_iterator) {
+            const matrix<float, matrix_layout::row_major> m(3, 4, [](std::size_t r, std::size_t c) { return float(r) + 0.1f * c; });
+
+            auto it = m.begin_row(1);
+
+            Assert::AreEqual(1.0f, *it++, L"1, 0", LINE_INFO());
+            Assert::AreEqual(1.1f, *it++, L"1, 1", LINE_INFO());
+            Assert::AreEqual(1.2f, *it++, L"1, 2", LINE_INFO());
+            Assert::AreEqual(1.3f, *it++, L"1, 3", LINE_INFO());
+
+            Assert::IsTrue(it == m.end_row(1), L"end reached", LINE_INFO());
+        }
+
+        TEST_METHOD(test_aligned_allocator) {
+            aligned_allocator<float, 64> allocator;
+            auto p = allocator.allocate(3);
+            Assert::AreEqual(std::uintptr_t(0), reinterpret_cast<std::uintptr_t>(p) % 64, L"Aligned", LINE_INFO());
+            allocator.deallocate(p, 3);
+
+            Assert::AreEqual(std::size_t(16), detail::padding_v<aligned_allocator<float, 64>>, L"Padding for float", LINE_INFO());
+            Assert::AreEqual(std::size_t(4), detail::padding_v<aligned_allocator<double, 32>>, L"Padding for double", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), detail::padding_v<std::allocator<float>>, L"No padding by default", LINE_INFO());
+        }
+
+        TEST_METHOD(test_padded_row_major) {
+            typedef matrix<float, matrix_layout::row_major, aligned_allocator<float, 64>> matrix_type;
+            matrix_type m(3, 5, [](const std::size_t r, const std::size_t c) { return static_cast<float>(r * 5 + c); });
+            Assert::AreEqual(std::size_t(3), m.rows(), L"rows", LINE_INFO());
+            Assert::AreEqual(std::size_t(5), m.columns(), L"columns", LINE_INFO());
+            Assert::AreEqual(std::size_t(15), m.size(), L"size", LINE_INFO());
+            Assert::AreEqual(std::size_t(16), m.stride(), L"stride", LINE_INFO());
+
+            for (std::size_t r = 0; r < m.rows(); ++r) {
+                const auto row = reinterpret_cast<std::uintptr_t>(m.data() + r * m.stride());
+                Assert::AreEqual(std::uintptr_t(0), row % 64, L"Row aligned", LINE_INFO());
+            }
+
+            for (std::size_t i = 0; i < m.size(); ++i) {
+                Assert::AreEqual(static_cast<float>(i), m[i], L"Flat index skips padding", LINE_INFO());
+            }
+
+            {
+                std::size_t i = 0;
+                for (auto v : m) {
+                    Assert::AreEqual(static_cast<float>(i++), v, L"Iteration skips padding", LINE_INFO());
+                }
+                Assert::AreEqual(m.size(), i, L"Iterated all", LINE_INFO());
+            }
+
+            {
+                const auto row = m.row(1);
+                Assert::AreEqual(std::size_t(5), row.columns(), L"Row size", LINE_INFO());
+                Assert::AreEqual(7.0f, row(0, 2), L"Row element", LINE_INFO());
+            }
+
+            {
+                const auto column = m.column(4);
+                Assert::AreEqual(std::size_t(3), column.rows(), L"Column size", LINE_INFO());
+                Assert::AreEqual(14.0f, column(2, 0), L"Column element", LINE_INFO());
+            }
+
+            {
+                std::vector<float> expected { 2.0f, 7.0f, 12.0f };
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), m.begin_column(2)), L"Column iterator", LINE_INFO());
+            }
+
+            matrix_type n(3, 5);
+            Assert::IsFalse(m == n, L"Not equal", LINE_INFO());
+            n.fill([](const std::size_t r, const std::size_t c) { return static_cast<float>(r * 5 + c); });
+            Assert::IsTrue(m == n, L"Equal", LINE_INFO());
+
+            // Padded matrices compare bitwise like unpadded ones.
+            m(1, 1) = n(1, 1) = std::numeric_limits<float>::quiet_NaN();
+            Assert::IsTrue(m == n, L"NaN is bitwise equal", LINE_INFO());
+            m(2, 4) = 0.0f;
+            n(2, 4) = -0.0f;
+            Assert::IsFalse(m == n, L"Signed zeros differ", LINE_INFO());
+        }
+
+        TEST_METHOD(test_padded_column_major) {
+            typedef matrix<double, matrix_layout::column_major, aligned_allocator<double, 32>> matrix_type;
+            matrix_type m(3, 2, [](const std::size_t r, const std::size_t c) { return static_cast<double>(c * 3 + r); });
+            Assert::AreEqual(std::size_t(4), m.stride(), L"stride", LINE_INFO());
+            Assert::AreEqual(std::size_t(6), m.size(), L"size", LINE_INFO());
+
+            for (std::size_t i = 0; i < m.size(); ++i) {
+                Assert::AreEqual(static_cast<double>(i), m[i], L"Flat index skips padding", LINE_INFO());
+            }
+
+            Assert::AreEqual(4.0, m(1, 1), L"Element", LINE_INFO());
+            Assert::AreEqual(4.0, m.data()[5], L"Storage includes padding", LINE_INFO());
+        }
+
+        TEST_METHOD(test_random_access_iterator) {
+            typedef matrix<int, matrix_layout::row_major> matrix_type;
+            static_assert(std::is_same_v<std::random_access_iterator_tag, std::iterator_traits<matrix_type::column_iterator>::iterator_category>, "Random-access column iterator");
+            static_assert(std::is_same_v<std::random_access_iterator_tag, std::iterator_traits<matrix_type::const_row_iterator>::iterator_category>, "Random-access row iterator");
+            static_assert(std::is_nothrow_default_constructible_v<matrix_type::column_iterator>, "Default-constructible column iterator");
+            static_assert(std::is_nothrow_default_constructible_v<matrix_type::const_row_iterator>, "Default-constructible row iterator");
+            matrix_type m(4, 3, [](const std::size_t r, const std::size_t c) { return static_cast<int>(r * 10 + c); });
+
+            {
+                auto it = m.begin_columns();
+                Assert::AreEqual(std::ptrdiff_t(12), m.end_columns() - it, L"Distance", LINE_INFO());
+                Assert::AreEqual(21, it[6], L"Subscript crosses columns", LINE_INFO());
+                it += 5;
+                Assert::AreEqual(11, *it, L"Advance", LINE_INFO());
+                it -= 2;
+                Assert::AreEqual(30, *it, L"Move back across columns", LINE_INFO());
+                ++it;
+                Assert::AreEqual(1, *it, L"Increment across columns", LINE_INFO());
+                --it;
+                Assert::AreEqual(30, *it, L"Decrement across columns", LINE_INFO());
+                Assert::IsTrue(m.begin_columns() < it, L"Ordering", LINE_INFO());
+                Assert::AreEqual(2, *(2 + m.begin_row(0)), L"Offset plus iterator", LINE_INFO());
+            }
+
+            {
+                std::sort(m.begin_column(1), m.end_column(1), std::greater<int>());
+                Assert::AreEqual(31, m(0, 1), L"Sort strided column", LINE_INFO());
+                Assert::AreEqual(1, m(3, 1), L"Sort strided column", LINE_INFO());
+                Assert::AreEqual(30, m(3, 0), L"Other columns untouched", LINE_INFO());
+            }
+
+            {
+                std::vector<int> reversed(m.size());
+                std::copy(std::make_reverse_iterator(m.end_rows()), std::make_reverse_iterator(m.begin_rows()), reversed.begin());
+                Assert::AreEqual(m(3, 2), reversed.front(), L"Reverse iteration", LINE_INFO());
+                Assert::AreEqual(m(0, 0), reversed.back(), L"Reverse iteration", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_padded_random_access_iterator) {
+            typedef matrix<float, matrix_layout::column_major, aligned_allocator<float, 32>> matrix_type;
+            matrix_type m(3, 4, [](const std::size_t r, const std::size_t c) { return static_cast<float>(c * 3 + r); });
+            Assert::AreEqual(std::ptrdiff_t(12), std::distance(m.begin(), m.end()), L"Padding skipped", LINE_INFO());
+
+            for (std::size_t i = 0; i < m.size(); ++i) {
+                Assert::AreEqual(static_cast<float>(i), m.begin()[i], L"Random access over padded matrix", LINE_INFO());
+            }
+
+            auto mid = m.begin_rows() + 6;
+            std::nth_element(m.begin_rows(), mid, m.end_rows());
+            Assert::AreEqual(6.0f, *mid, L"nth_element over rows", LINE_INFO());
+        }
+
+        TEST_METHOD(test_layout_conversion) {
+            auto generator = [](const std::size_t r, const std::size_t c) { return static_cast<int>(r * 100 + c); };
+
+            {
+                matrix<int, matrix_layout::row_major> rm(13, 21, generator);
+                matrix<int, matrix_layout::column_major> cm(rm);
+                Assert::AreEqual(rm.rows(), cm.rows(), L"Rows preserved", LINE_INFO());
+                Assert::AreEqual(rm.columns(), cm.columns(), L"Columns preserved", LINE_INFO());
+                for (std::size_t r = 0; r < rm.rows(); ++r) {
+                    for (std::size_t c = 0; c < rm.columns(); ++c) {
+                        Assert::AreEqual(rm(r, c), cm(r, c), L"Row-major to column-major", LINE_INFO());
+                    }
+                }
+
+                matrix<int, matrix_layout::row_major> back(cm);
+                Assert::IsTrue(rm == back, L"Round trip", LINE_INFO());
+            }
+
+            {
+                typedef matrix<int, matrix_layout::column_major, aligned_allocator<int, 64>> padded_type;
+                matrix<int, matrix_layout::row_major> rm(9, 17, generator);
+                padded_type cm(rm);
+                Assert::AreEqual(std::size_t(16), cm.stride(), L"Destination padded", LINE_INFO());
+                matrix<int, matrix_layout::row_major, aligned_allocator<int, 64>> pm(cm);
+                Assert::AreEqual(std::size_t(32), pm.stride(), L"Destination padded", LINE_INFO());
+                for (std::size_t r = 0; r < rm.rows(); ++r) {
+                    for (std::size_t c = 0; c < rm.columns(); ++c) {
+                        Assert::AreEqual(rm(r, c), cm(r, c), L"Padded column-major", LINE_INFO());
+                        Assert::AreEqual(rm(r, c), pm(r, c), L"Padded row-major", LINE_INFO());
+                    }
+                }
+            }
+
+            {
+                matrix<int, matrix_layout::row_major> rm;
+                matrix<int, matrix_layout::column_major> cm(rm);
+                Assert::IsTrue(cm.empty(), L"Empty conversion", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_transpose) {
+            auto generator = [](const std::size_t r, const std::size_t c) { return static_cast<float>(r * 100 + c); };
+
+            {
+                matrix<float> m(19, 19, generator);
+                m.transpose();
+                for (std::size_t r = 0; r < m.rows(); ++r) {
+                    for (std::size_t c = 0; c < m.columns(); ++c) {
+                        Assert::AreEqual(generator(c, r), m(r, c), L"Square in place", LINE_INFO());
+                    }
+                }
+            }
+
+            {
+                matrix<float, matrix_layout::column_major> m(5, 11, generator);
+                m.transpose();
+                Assert::AreEqual(std::size_t(11), m.rows(), L"Rows swapped", LINE_INFO());
+                Assert::AreEqual(std::size_t(5), m.columns(), L"Columns swapped", LINE_INFO());
+                for (std::size_t r = 0; r < m.rows(); ++r) {
+                    for (std::size_t c = 0; c < m.columns(); ++c) {
+                        Assert::AreEqual(generator(c, r), m(r, c), L"Rectangular", LINE_INFO());
+                    }
+                }
+            }
+
+            {
+                typedef matrix<float, matrix_layout::row_major, aligned_allocator<float, 32>> padded_type;
+                padded_type m(3, 10, generator);
+                m.transpose();
+                Assert::AreEqual(std::size_t(8), m.stride(), L"Stride follows new shape", LINE_INFO());
+                for (std::size_t r = 0; r < m.rows(); ++r) {
+                    for (std::size_t c = 0; c < m.columns(); ++c) {
+                        Assert::AreEqual(generator(c, r), m(r, c), L"Padded", LINE_INFO());
+                    }
+                }
+                m.transpose();
+                Assert::IsTrue(m == padded_type(3, 10, generator), L"Involution", LINE_INFO());
+            }
+        }
+
+    };
+
+}
@@ -0,0 +1,154 @@
+﻿// <copyright file="matrix_view_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include <vector>
+
+#include "visus/lhs/centred.h"
+#include "visus/lhs/matrix_view.h"
+#include "visus/lhs/maximin.h"
+#include "visus/lhs/random.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(matrix_view_test) {
+
+        TEST_METHOD(test_external) {
+            std::vector<int> buffer(3 * 5, -1);
+            matrix_view<int> view(buffer.data(), 3, 4, 5);
+            Assert::AreEqual(std::size_t(3), view.rows(), L"Rows", LINE_INFO());
+            Assert::AreEqual(std::size_t(4), view.columns(), L"Columns", LINE_INFO());
+            Assert::AreEqual(std::size_t(5), view.stride(), L"Stride", LINE_INFO());
+            Assert::AreEqual(std::size_t(12), view.size(), L"Size", LINE_INFO());
+
+            for (std::size_t r = 0; r < view.rows(); ++r) {
+                for (std::size_t c = 0; c < view.columns(); ++c) {
+                    view(r, c) = static_cast<int>(view.index(r, c));
+                }
+            }
+
+            Assert::AreEqual(0, buffer[0], L"(0, 0)", LINE_INFO());
+            Assert::AreEqual(3, buffer[3], L"(0, 3)", LINE_INFO());
+            Assert::AreEqual(-1, buffer[4], L"Padding untouched", LINE_INFO());
+            Assert::AreEqual(4, buffer[5], L"(1, 0)", LINE_INFO());
+            Assert::AreEqual(-1, buffer[14], L"Padding untouched", LINE_INFO());
+            Assert::AreEqual(4, view[4], L"Flattened index skips padding", LINE_INFO());
+            Assert::AreEqual(11, view[11], L"Flattened index skips padding", LINE_INFO());
+
+            matrix_view<int, matrix_layout::column_major> cm(buffer.data(), 4, 2, 7);
+            Assert::AreEqual(buffer[7], cm(0, 1), L"Column-major stride", LINE_INFO());
+            Assert::AreEqual(buffer[10], cm(3, 1), L"Column-major stride", LINE_INFO());
+
+            matrix_view<const int> ro(view);
+            Assert::AreEqual(view(2, 3), ro(2, 3), L"Const view", LINE_INFO());
+        }
+
+        TEST_METHOD(test_matrix) {
+            matrix<float> m(4, 3, [](const std::size_t r, const std::size_t c) { return static_cast<float>(r * 3 + c); });
+            matrix_view<float> view(m);
+            Assert::AreEqual(m.rows(), view.rows(), L"Rows", LINE_INFO());
+            Assert::AreEqual(m.columns(), view.columns(), L"Columns", LINE_INFO());
+            Assert::IsTrue(view.data() == m.data(), L"Same memory", LINE_INFO());
+
+            view(1, 2) = 42.0f;
+            Assert::AreEqual(42.0f, m(1, 2), L"Write through", LINE_INFO());
+
+            const auto& cref = m;
+            matrix_view<const float> cview(cref);
+            Assert::AreEqual(42.0f, cview(1, 2), L"Read-only view", LINE_INFO());
+        }
+
+        TEST_METHOD(test_exceptions) {
+            Assert::ExpectException<std::invalid_argument>([]() {
+                matrix_view<float> view(nullptr, 2, 2);
+            }, L"nullptr", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([]() {
+                std::vector<float> buffer(8);
+                matrix_view<float> view(buffer.data(), 2, 4, 3);
+            }, L"Stride too small", LINE_INFO());
+
+            {
+                matrix_view<float> view(nullptr, 0, 0);
+                Assert::IsTrue(view.empty(), L"Empty view of nullptr", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_generators) {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+            {
+                std::vector<std::size_t> buffer(10 * 4);
+                matrix_view<std::size_t> view(buffer.data(), 10, 3, 4);
+                random(view, rng, distribution);
+                Assert::IsTrue(valid(view), L"Random indices in view", LINE_INFO());
+            }
+
+            {
+                std::vector<float> buffer(10 * 3);
+                matrix_view<float, matrix_layout::column_major> view(buffer.data(), 10, 3);
+                random(view, true, rng, distribution);
+                Assert::IsTrue(valid(view), L"Random sample in view", LINE_INFO());
+
+                std::mt19937 rng1(7), rng2(7);
+                matrix<float, matrix_layout::column_major> expected(10, 3);
+                random(expected, false, rng1, distribution);
+                random(view, false, rng2, distribution);
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), buffer.begin()), L"View and matrix give same draw", LINE_INFO());
+            }
+
+            {
+                std::vector<double> buffer(8 * 2);
+                matrix_view<double> view(buffer.data(), 8, 2);
+                std::uniform_real_distribution<double> dist(0.0, 1.0);
+                centred(view, rng, dist);
+                Assert::IsTrue(valid(view), L"Centred sample in view", LINE_INFO());
+            }
+
+            {
+                std::vector<std::size_t> buffer(6 * 2);
+                matrix_view<std::size_t> view(buffer.data(), 6, 2);
+                maximin(view, 3, rng, distribution);
+                Assert::IsTrue(valid(view), L"Maximin sample in view", LINE_INFO());
+
+                random(view, rng, distribution);
+                maximin(view, std::size_t(1), std::size_t(4));
+                Assert::IsTrue(valid(view), L"Optimised sample in view", LINE_INFO());
+            }
+
+            {
+                std::vector<float> buffer(5 * 2);
+                matrix_view<float> view(buffer.data(), 5, 2);
+                random(view, false, rng, distribution);
+                std::initializer_list<range<float>> scales = { make_range(0.0f, 10.0f), make_range(-1.0f, 1.0f) };
+                scale(view, scales.begin(), scales.end());
+
+                for (std::size_t r = 0; r < view.rows(); ++r) {
+                    Assert::IsTrue((view(r, 0) >= 0.0f) && (view(r, 0) <= 10.0f), L"Scaled first parameter", LINE_INFO());
+                    Assert::IsTrue((view(r, 1) >= -1.0f) && (view(r, 1) <= 1.0f), L"Scaled second parameter", LINE_INFO());
+                }
+            }
+
+            {
+                matrix<float> unit(5, 2);
+                random(unit, false, rng, distribution);
+                std::vector<std::size_t> buffer(5 * 2);
+                matrix_view<std::size_t> view(buffer.data(), 5, 2);
+                std::initializer_list<std::size_t> sizes = { 5, 10 };
+                scale(view, matrix_view<const float>(unit), sizes.begin(), sizes.end());
+                const auto expected = scale(unit, sizes.begin(), sizes.end());
+                Assert::IsTrue(std::equal(expected.begin(), expected.end(), buffer.begin()), L"Integral scaling into view", LINE_INFO());
+            }
+        }
+    };
+}
@@ -104,6 +104,27 @@ namespace test {
             Assert::AreEqual(std::size_t(1), lhs[10], L"10", LINE_INFO());
             Assert::AreEqual(std::size_t(1), lhs[11], L"11", LINE_INFO());
         }
+
+        TEST_METHOD(test_build_narrow) {
+            {
+                reference_distribution dist(1976, 1968);
+                matrix<std::uint16_t> lhs(4, 3);
+                maximin(lhs, 5, std::mt19937(42), dist);
+                Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+
+                // Same expected values as in test_build_against_r.
+                const std::uint16_t expected[] = { 3, 0, 2, 1, 3, 0, 0, 2, 3, 2, 1, 1 };
+                for (std::size_t i = 0; i < lhs.size(); ++i) {
+                    Assert::AreEqual(expected[i], lhs[i], L"Matches R", LINE_INFO());
+                }
+            }
+
+            {
+                auto lhs = maximin<std::uint32_t>(20, 3, 5, std::mt19937(42));
+                Assert::IsTrue(std::is_same_v<matrix<std::uint32_t>, decltype(lhs)>, L"Narrow matrix", LINE_INFO());
+                Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+            }
+        }
     };
 
 }
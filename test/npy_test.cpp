@@ -0,0 +1,173 @@
+﻿// <copyright file="npy_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/npy.h"
+#include "visus/lhs/random.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(npy_test) {
+
+        static std::filesystem::path temp_path(const char *name) {
+            return std::filesystem::temp_directory_path() / name;
+        }
+
+        static void write_file(const std::filesystem::path& path, const std::string& content) {
+            std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+            stream.write(content.data(), content.size());
+        }
+
+        TEST_METHOD(test_descr) {
+            const std::string order = is_little_endian() ? "<" : ">";
+            Assert::AreEqual(order + "f8", npy_descr<double>(), L"double", LINE_INFO());
+            Assert::AreEqual(order + "f4", npy_descr<float>(), L"float", LINE_INFO());
+            Assert::AreEqual(order + "u2", npy_descr<std::uint16_t>(), L"uint16", LINE_INFO());
+            Assert::AreEqual(order + "i4", npy_descr<std::int32_t>(), L"int32", LINE_INFO());
+            Assert::AreEqual(std::string("|u1"), npy_descr<std::uint8_t>(), L"uint8", LINE_INFO());
+            Assert::AreEqual(std::string("|i1"), npy_descr<std::int8_t>(), L"int8", LINE_INFO());
+        }
+
+        TEST_METHOD(test_header) {
+            const auto header = npy_header("<f8", false, 10, 3);
+            Assert::AreEqual(std::size_t(0), header.size() % npy_alignment, L"Header is aligned", LINE_INFO());
+            Assert::IsTrue(header.compare(0, 6, npy_magic()) == 0, L"Magic", LINE_INFO());
+            Assert::AreEqual(char(1), header[6], L"Major version", LINE_INFO());
+            Assert::AreEqual(char(0), header[7], L"Minor version", LINE_INFO());
+            Assert::AreEqual(header.size() - 10, static_cast<std::size_t>(static_cast<unsigned char>(header[8])) + (static_cast<std::size_t>(static_cast<unsigned char>(header[9])) << 8), L"Header length", LINE_INFO());
+            Assert::AreEqual('\n', header.back(), L"Line break", LINE_INFO());
+            Assert::AreNotEqual(std::string::npos, header.find("{'descr': '<f8', 'fortran_order': False, 'shape': (10, 3), }"), L"Dictionary", LINE_INFO());
+        }
+
+        TEST_METHOD(test_round_trip_row_major) {
+            const auto path = temp_path("lhs_npy_row_major.npy");
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<double> distribution(0.0, 1.0);
+            matrix<double> expected(50, 4);
+            random(expected, false, rng, distribution);
+            save_npy(path, expected);
+
+            {
+                mapped_npy<double> actual(path);
+                Assert::AreEqual(expected.rows(), actual.rows(), L"Rows", LINE_INFO());
+                Assert::AreEqual(expected.columns(), actual.columns(), L"Columns", LINE_INFO());
+                Assert::AreEqual(std::size_t(0), reinterpret_cast<std::uintptr_t>(actual.view().data()) % npy_alignment, L"Data are aligned", LINE_INFO());
+
+                for (std::size_t r = 0; r < expected.rows(); ++r) {
+                    for (std::size_t c = 0; c < expected.columns(); ++c) {
+                        Assert::AreEqual(expected(r, c), actual(r, c), L"Element", LINE_INFO());
+                    }
+                }
+
+                Assert::IsTrue(valid(actual.view()), L"Mapped view is valid", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&path]() { mapped_npy<float> m(path); }, L"Type mismatch", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([&path]() { mapped_npy<double, matrix_layout::column_major> m(path); }, L"Layout mismatch", LINE_INFO());
+
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(test_round_trip_column_major) {
+            const auto path = temp_path("lhs_npy_column_major.npy");
+            std::mt19937 rng(7);
+            matrix<std::uint32_t, matrix_layout::column_major> expected(30, 5);
+            random(expected, rng, std::uniform_real_distribution<float>());
+            save_npy(path, expected);
+
+            {
+                mapped_npy<std::uint32_t, matrix_layout::column_major> actual(path);
+                Assert::AreEqual(expected.rows(), actual.rows(), L"Rows", LINE_INFO());
+                Assert::AreEqual(expected.columns(), actual.columns(), L"Columns", LINE_INFO());
+
+                for (std::size_t r = 0; r < expected.rows(); ++r) {
+                    for (std::size_t c = 0; c < expected.columns(); ++c) {
+                        Assert::AreEqual(expected(r, c), actual(r, c), L"Element", LINE_INFO());
+                    }
+                }
+            }
+
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(test_padded) {
+            const auto path = temp_path("lhs_npy_padded.npy");
+            std::vector<std::uint16_t> buffer(10 * 4, 0xffff);
+            matrix_view<std::uint16_t> view(buffer.data(), 10, 3, 4);
+            std::mt19937 rng(1);
+            random(view, rng, std::uniform_real_distribution<float>());
+            save_npy(path, matrix_view<const std::uint16_t>(view));
+
+            {
+                mapped_npy<std::uint16_t> actual(path);
+                Assert::AreEqual(actual.columns(), actual.view().stride(), L"Padding removed", LINE_INFO());
+
+                for (std::size_t r = 0; r < view.rows(); ++r) {
+                    for (std::size_t c = 0; c < view.columns(); ++c) {
+                        Assert::AreEqual(view(r, c), actual(r, c), L"Element", LINE_INFO());
+                    }
+                }
+            }
+
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(test_one_dimensional) {
+            const auto path = temp_path("lhs_npy_one_dimensional.npy");
+            const std::int32_t data[] = { 3, 1, 2 };
+            const std::string dict = "{\"descr\": \"" + npy_descr<std::int32_t>() + "\", \"fortran_order\": False, \"shape\": (3,)}";
+            std::string content(npy_magic());
+            content += std::string("\x01\x00", 2);
+            content.push_back(static_cast<char>(118));
+            content.push_back(0);
+            content += dict;
+            content.append(118 - dict.size() - 1, ' ');
+            content.push_back('\n');
+            content.append(reinterpret_cast<const char *>(data), sizeof(data));
+            write_file(path, content);
+
+            {
+                mapped_npy<std::int32_t> actual(path);
+                Assert::AreEqual(std::size_t(3), actual.rows(), L"Rows", LINE_INFO());
+                Assert::AreEqual(std::size_t(1), actual.columns(), L"Single column", LINE_INFO());
+                Assert::AreEqual(3, actual(0, 0), L"Element 0", LINE_INFO());
+                Assert::AreEqual(1, actual(1, 0), L"Element 1", LINE_INFO());
+                Assert::AreEqual(2, actual(2, 0), L"Element 2", LINE_INFO());
+            }
+
+            std::filesystem::remove(path);
+        }
+
+        TEST_METHOD(test_invalid) {
+            const auto path = temp_path("lhs_npy_invalid.npy");
+
+            write_file(path, "not a numpy file");
+            Assert::ExpectException<std::invalid_argument>([&path]() { mapped_npy<double> m(path); }, L"Wrong magic", LINE_INFO());
+
+            {
+                auto header = npy_header(npy_descr<double>(), false, 1000, 3);
+                write_file(path, header);
+                Assert::ExpectException<std::invalid_argument>([&path]() { mapped_npy<double> m(path); }, L"Truncated", LINE_INFO());
+            }
+
+            {
+                auto header = npy_header(npy_descr<double>(), false, 2, 3);
+                const auto position = header.find("(2, 3)");
+                header.replace(position, 6, "(1,2,3");
+                write_file(path, header + std::string(6 * sizeof(double), '\0'));
+                Assert::ExpectException<std::invalid_argument>([&path]() { mapped_npy<double> m(path); }, L"Three dimensions", LINE_INFO());
+            }
+
+            std::filesystem::remove(path);
+        }
+    };
+}
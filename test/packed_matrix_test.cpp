@@ -0,0 +1,161 @@
+﻿// <copyright file="packed_matrix_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/packed_matrix.h"
+#include "visus/lhs/random.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(packed_matrix_test) {
+
+        TEST_METHOD(test_bits) {
+            Assert::AreEqual(std::size_t(1), packed_matrix<>::bits_for(0), L"Empty", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), packed_matrix<>::bits_for(1), L"Single sample", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), packed_matrix<>::bits_for(2), L"Two samples", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), packed_matrix<>::bits_for(3), L"Three samples", LINE_INFO());
+            Assert::AreEqual(std::size_t(10), packed_matrix<>::bits_for(1000), L"1000 samples", LINE_INFO());
+            Assert::AreEqual(std::size_t(10), packed_matrix<>::bits_for(1024), L"1024 samples", LINE_INFO());
+            Assert::AreEqual(std::size_t(11), packed_matrix<>::bits_for(1025), L"1025 samples", LINE_INFO());
+
+            packed_matrix<> m(1000, 7);
+            Assert::AreEqual(std::size_t(1000), m.rows(), L"Rows", LINE_INFO());
+            Assert::AreEqual(std::size_t(7), m.columns(), L"Columns", LINE_INFO());
+            Assert::AreEqual(std::size_t(10), m.bits(), L"Bits per element", LINE_INFO());
+            Assert::AreEqual(std::size_t(1094), m.words(), L"Words for 70,000 bits", LINE_INFO());
+            Assert::AreEqual(std::size_t(0), m(999, 6), L"Zero-initialised", LINE_INFO());
+            Assert::IsTrue(packed_matrix<>().empty(), L"Default is empty", LINE_INFO());
+        }
+
+        TEST_METHOD(test_set_get) {
+            packed_matrix<matrix_layout::column_major> m(37, 5);
+            Assert::AreEqual(std::size_t(6), m.bits(), L"Bits per element", LINE_INFO());
+
+            for (std::size_t r = 0; r < m.rows(); ++r) {
+                for (std::size_t c = 0; c < m.columns(); ++c) {
+                    m.set(r, c, (r * 7 + c) % m.rows());
+                }
+            }
+
+            // Overwriting must not affect the neighbours, which share words.
+            m.set(10, 2, 36);
+            m.set(10, 2, (10 * 7 + 2) % m.rows());
+
+            for (std::size_t r = 0; r < m.rows(); ++r) {
+                for (std::size_t c = 0; c < m.columns(); ++c) {
+                    Assert::AreEqual((r * 7 + c) % m.rows(), m(r, c), L"Random access", LINE_INFO());
+                }
+            }
+
+            Assert::AreEqual(m(1, 0), m[1], L"Flattened column-major", LINE_INFO());
+            Assert::AreEqual(m(0, 1), m[37], L"Flattened column-major", LINE_INFO());
+        }
+
+        TEST_METHOD(test_round_trip) {
+            std::mt19937 rng(42);
+
+            {
+                auto lhs = random(1000, 6, rng);
+                packed_matrix<> packed(lhs);
+                Assert::AreEqual(std::size_t(10), packed.bits(), L"Bits per element", LINE_INFO());
+
+                for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                    for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                        Assert::AreEqual(lhs(r, c), packed(r, c), L"Random access", LINE_INFO());
+                    }
+                }
+
+                Assert::IsTrue(lhs == packed.unpack(), L"Unpack into std::size_t", LINE_INFO());
+
+                auto narrow = packed.unpack<std::uint16_t>();
+                Assert::IsTrue(valid(narrow), L"Unpack into std::uint16_t", LINE_INFO());
+
+                matrix<std::uint32_t, matrix_layout::column_major> cm(lhs.rows(), lhs.columns());
+                packed.unpack(matrix_view<std::uint32_t, matrix_layout::column_major>(cm));
+                for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                    for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                        Assert::AreEqual(lhs(r, c), static_cast<std::size_t>(cm(r, c)), L"Unpack into other layout", LINE_INFO());
+                    }
+                }
+            }
+
+            {
+                // 17 bits per element, many of which straddle two words.
+                const std::size_t n = 70000;
+                auto lhs = random<std::uint32_t>(n, 1, rng);
+                packed_matrix<matrix_layout::column_major> packed(lhs);
+                Assert::AreEqual(std::size_t(17), packed.bits(), L"Bits per element", LINE_INFO());
+                auto unpacked = packed.unpack<std::uint32_t>();
+                for (std::size_t r = 0; r < n; ++r) {
+                    Assert::AreEqual(lhs(r, 0), unpacked(r, 0), L"Unpack 17 bits", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(test_unpack_strided) {
+            std::mt19937 rng(42);
+            auto lhs = random(50, 4, rng);
+            packed_matrix<> packed(lhs);
+
+            {
+                // Dense and in the same layout, which decodes sequentially.
+                std::vector<std::size_t> dense(lhs.size(), 99);
+                auto view = packed.unpack(matrix_view<std::size_t>(dense.data(), lhs.rows(), lhs.columns()));
+                Assert::AreEqual(lhs.columns(), view.stride(), L"Dense stride", LINE_INFO());
+                for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                    for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                        Assert::AreEqual(lhs(r, c), dense[r * lhs.columns() + c], L"Dense unpack", LINE_INFO());
+                    }
+                }
+            }
+
+            {
+                // Padded rows must be addressed element by element.
+                const std::size_t stride = lhs.columns() + 3;
+                std::vector<std::size_t> padded(lhs.rows() * stride, 99);
+                packed.unpack(matrix_view<std::size_t>(padded.data(), lhs.rows(), lhs.columns(), stride));
+                for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                    for (std::size_t c = 0; c < stride; ++c) {
+                        const auto expected = (c < lhs.columns()) ? lhs(r, c) : std::size_t(99);
+                        Assert::AreEqual(expected, padded[r * stride + c], L"Padded unpack", LINE_INFO());
+                    }
+                }
+            }
+        }
+
+        TEST_METHOD(test_unit) {
+            std::mt19937 rng(42);
+            auto lhs = random(8, 3, rng);
+            packed_matrix<> packed(lhs);
+            auto unit = packed.unpack_unit<double>();
+            Assert::IsTrue(valid(unit), L"Valid unit sample", LINE_INFO());
+
+            for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                    Assert::AreEqual((lhs(r, c) + 0.5) / 8.0, unit(r, c), 0.000001, L"Centre of stratum", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(test_exceptions) {
+            matrix<std::size_t> invalid(4, 2, static_cast<std::size_t>(4));
+            Assert::ExpectException<std::invalid_argument>([&invalid]() { packed_matrix<> packed(invalid); }, L"Index out of range", LINE_INFO());
+
+            packed_matrix<> packed(300, 2);
+            Assert::ExpectException<std::invalid_argument>([&packed]() { packed.unpack<std::uint8_t>(); }, L"Type too narrow", LINE_INFO());
+
+            matrix<std::size_t> wrong(2, 300);
+            Assert::ExpectException<std::invalid_argument>([&packed, &wrong]() { packed.unpack(matrix_view<std::size_t>(wrong)); }, L"Wrong dimensions", LINE_INFO());
+        }
+    };
+
+}
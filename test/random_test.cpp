@@ -273,6 +273,111 @@ namespace test {
             }
         }
 
+        TEST_METHOD(test_aligned) {
+            std::mt19937 rng(0);
+            std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+            {
+                matrix<std::size_t, matrix_layout::row_major, aligned_allocator<std::size_t>> lhs(10, 3);
+                random(lhs, rng, distribution);
+                Assert::IsTrue(lhs.stride() > lhs.columns(), L"Padded", LINE_INFO());
+                Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+            }
+
+            {
+                matrix<float, matrix_layout::column_major, aligned_allocator<float>> lhs(10, 3);
+                random(lhs, false, rng, distribution);
+                Assert::IsTrue(lhs.stride() > lhs.rows(), L"Padded", LINE_INFO());
+                Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_narrow_indices) {
+            std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+
+            {
+                std::mt19937 rng(42);
+                auto lhs = random<std::uint16_t>(100, 4, rng, distribution);
+                Assert::IsTrue(std::is_same_v<matrix<std::uint16_t>, decltype(lhs)>, L"Narrow matrix", LINE_INFO());
+                Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+
+                std::mt19937 rng2(42);
+                auto wide = random(100, 4, rng2, distribution);
+                for (std::size_t i = 0; i < wide.size(); ++i) {
+                    Assert::AreEqual(wide[i], static_cast<std::size_t>(lhs[i]), L"Same draw as std::size_t", LINE_INFO());
+                }
+            }
+
+            {
+                std::mt19937 rng(42);
+                matrix<std::uint32_t, matrix_layout::column_major> lhs(50, 3);
+                random(lhs, rng, distribution);
+                Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+            }
+
+            {
+                std::mt19937 rng(42);
+                std::vector<std::uint8_t> buffer(300 * 2);
+                matrix_view<std::uint8_t> view(buffer.data(), 300, 2);
+                Assert::ExpectException<std::invalid_argument>([&]() { random(view, rng, distribution); }, L"Too many samples", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_automatic_index_type) {
+            Assert::IsTrue(std::is_same_v<std::uint16_t, index_type_t<65536>>, L"16 bits", LINE_INFO());
+            Assert::IsTrue(std::is_same_v<std::uint32_t, index_type_t<65537>>, L"32 bits", LINE_INFO());
+
+            auto size = [](auto tag) { return sizeof(typename decltype(tag)::type); };
+            Assert::AreEqual(std::size_t(2), with_index_type(1000, size), L"16 bits", LINE_INFO());
+            Assert::AreEqual(std::size_t(4), with_index_type(70000, size), L"32 bits", LINE_INFO());
+
+            auto lhs = with_index_type(1000, [](auto tag) {
+                typedef typename decltype(tag)::type index_type;
+                std::mt19937 rng(42);
+                auto lhs = random<index_type>(1000, 2, rng);
+                return valid(lhs);
+            });
+            Assert::IsTrue(lhs, L"Sample is valid", LINE_INFO());
+        }
+
+        TEST_METHOD(test_fused_scaling) {
+            std::uniform_real_distribution<float> distribution;
+
+            for (const bool preserve_draw : { false, true }) {
+                {
+                    std::initializer_list<range<float>> ranges = { make_range(0.0f, 10.0f), make_range(-1.0f, 1.0f) };
+                    std::mt19937 rng1(42), rng2(42);
+                    matrix<float> unit(50, 2);
+                    random(unit, preserve_draw, rng1, distribution);
+                    scale(unit, ranges.begin(), ranges.end());
+                    auto actual = random(50, ranges.begin(), ranges.end(), preserve_draw, rng2, distribution);
+                    Assert::IsTrue(unit == actual, L"Floating-point ranges", LINE_INFO());
+                }
+
+                {
+                    std::initializer_list<range<int>> ranges = { make_range(0, 10), make_range(5, 100) };
+                    std::mt19937 rng1(42), rng2(42);
+                    matrix<float> unit(50, 2);
+                    random(unit, preserve_draw, rng1, distribution);
+                    auto expected = scale(unit, ranges.begin(), ranges.end());
+                    auto actual = random(50, ranges.begin(), ranges.end(), preserve_draw, rng2, distribution);
+                    Assert::IsTrue(expected == actual, L"Integer ranges", LINE_INFO());
+                }
+
+                {
+                    // 300 rows do not fit into std::uint8_t, so the ranks
+                    // cannot be stored in the result.
+                    std::initializer_list<std::uint8_t> sizes = { 3, 200 };
+                    std::mt19937 rng1(42), rng2(42);
+                    matrix<float> unit(300, 2);
+                    random(unit, preserve_draw, rng1, distribution);
+                    auto expected = scale(unit, sizes.begin(), sizes.end());
+                    auto actual = random(300, sizes.begin(), sizes.end(), preserve_draw, rng2, distribution);
+                    Assert::IsTrue(expected == actual, L"Integer sizes", LINE_INFO());
+                }
+            }
+        }
+
     };
 
 }
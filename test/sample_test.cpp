@@ -6,6 +6,7 @@
 
 #include <CppUnitTest.h>
 
+#include "visus/lhs/categorical.h"
 #include "visus/lhs/random.h"
 #include "visus/lhs/sample.h"
 
@@ -70,6 +71,97 @@ namespace test {
             Assert::IsTrue((std::get<1>(lhs[1]) >= 1.0f) && (std::get<1>(lhs[1]) <= 3.0f), L"1, 1", LINE_INFO());
             Assert::IsTrue(std::get<2>(lhs[1]) || !std::get<2>(lhs[1]), L"1, 2", LINE_INFO());
         }
+
+        TEST_METHOD(test_columns) {
+            const auto unit = random<float>(16, 3);
+            const std::vector<std::string> names({ "horst", "hugo", "heinz" });
+            const auto generator = [&unit](const std::size_t) { return unit; };
+
+            const auto rows = sample(generator, names, make_range(1, 100), make_range(0.0f, 1.0f));
+            const auto columns = sample_columns(generator, names, make_range(1, 100), make_range(0.0f, 1.0f));
+
+            Assert::AreEqual(rows.size(), std::get<0>(columns).size(), L"Rows of column 0", LINE_INFO());
+            Assert::AreEqual(rows.size(), std::get<1>(columns).size(), L"Rows of column 1", LINE_INFO());
+            Assert::AreEqual(rows.size(), std::get<2>(columns).size(), L"Rows of column 2", LINE_INFO());
+
+            for (std::size_t r = 0; r < rows.size(); ++r) {
+                Assert::AreEqual(std::get<0>(rows[r]), std::get<0>(columns)[r], L"Categorical parameter", LINE_INFO());
+                Assert::AreEqual(std::get<1>(rows[r]), std::get<1>(columns)[r], L"Integer parameter", LINE_INFO());
+                Assert::AreEqual(std::get<2>(rows[r]), std::get<2>(columns)[r], L"Floating-point parameter", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&generator]() { sample_columns(generator, make_range(1, 100)); }, L"Column mismatch", LINE_INFO());
+        }
+
+        TEST_METHOD(test_parallel) {
+            const auto unit = random<double>(10000, 4);
+            const std::vector<std::string> names({ "horst", "hugo", "heinz" });
+            const auto generator = [&unit](const std::size_t) { return unit; };
+
+            const auto expected = sample(generator, names, make_range(1, 100), make_range(0.0f, 1.0f), std::vector<bool>({ true, false }));
+            const auto actual = parallel_sample(4, generator, names, make_range(1, 100), make_range(0.0f, 1.0f), std::vector<bool>({ true, false }));
+            Assert::AreEqual(expected.size(), actual.size(), L"Number of rows", LINE_INFO());
+            Assert::IsTrue(expected == actual, L"Rows match serial sample", LINE_INFO());
+
+            const auto columns = parallel_sample_columns(4, generator, names, make_range(1, 100), make_range(0.0f, 1.0f), std::vector<bool>({ true, false }));
+            Assert::AreEqual(expected.size(), std::get<3>(columns).size(), L"Number of rows in columns", LINE_INFO());
+            for (std::size_t r = 0; r < expected.size(); ++r) {
+                Assert::IsTrue(std::get<0>(expected[r]) == std::get<0>(columns)[r], L"Column 0", LINE_INFO());
+                Assert::IsTrue(std::get<1>(expected[r]) == std::get<1>(columns)[r], L"Column 1", LINE_INFO());
+                Assert::IsTrue(std::get<2>(expected[r]) == std::get<2>(columns)[r], L"Column 2", LINE_INFO());
+                Assert::IsTrue(std::get<3>(expected[r]) == std::get<3>(columns)[r], L"Column 3", LINE_INFO());
+            }
+
+            Assert::ExpectException<std::invalid_argument>([&generator]() { parallel_sample(2, generator, make_range(1, 100)); }, L"Column mismatch", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([&generator]() { parallel_sample_columns(2, generator, make_range(1, 100)); }, L"Column mismatch", LINE_INFO());
+        }
+
+        TEST_METHOD(test_sample_into) {
+            const auto unit = random<float>(10, 2);
+            const auto generator = [&unit](const std::size_t) { return unit; };
+            const std::vector<std::string> names({ "horst", "hugo" });
+            const auto expected = sample(generator, names, make_range(1, 100));
+
+            std::vector<std::size_t> batches;
+            std::vector<std::tuple<std::string, int>> actual;
+            const auto cnt = sample_into([&](vector_view<std::tuple<std::string, int>> batch) {
+                batches.push_back(batch.size());
+                for (auto& s : batch) {
+                    actual.push_back(std::move(s));
+                }
+            }, 4, generator, names, make_range(1, 100));
+
+            Assert::AreEqual(std::size_t(10), cnt, L"Number of samples", LINE_INFO());
+            Assert::AreEqual(std::size_t(3), batches.size(), L"Number of batches", LINE_INFO());
+            Assert::AreEqual(std::size_t(4), batches[0], L"Full batch", LINE_INFO());
+            Assert::AreEqual(std::size_t(4), batches[1], L"Full batch", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), batches[2], L"Remainder", LINE_INFO());
+            Assert::IsTrue(expected == actual, L"Samples match sample", LINE_INFO());
+
+            std::size_t calls = 0;
+            sample_into([&calls](vector_view<std::tuple<int>>) { ++calls; }, 100, [](const std::size_t p) { return matrix<float>(0, p); }, make_range(1, 100));
+            Assert::AreEqual(std::size_t(0), calls, L"No batch for empty sample", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([&generator]() { sample_into([](vector_view<std::tuple<int, int>>) {}, 0, generator, make_range(1, 100), make_range(1, 100)); }, L"Empty batch", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([&generator]() { sample_into([](vector_view<std::tuple<int>>) {}, 1, generator, make_range(1, 100)); }, L"Column mismatch", LINE_INFO());
+        }
+
+        TEST_METHOD(test_parallel_categorical) {
+            const categorical<std::string> names({ "horst", "hugo", "heinz" });
+            const auto generator = [](const std::size_t p) { return random<double>(5000, p); };
+
+            const auto rows = parallel_sample(0, generator, names);
+            Assert::AreEqual(std::size_t(5000), rows.size(), L"Number of rows", LINE_INFO());
+            for (auto& r : rows) {
+                Assert::IsTrue(names.index_of(std::get<0>(r)) < names.size(), L"Reference into dictionary", LINE_INFO());
+            }
+
+            const auto columns = parallel_sample_columns(3, generator, names);
+            Assert::AreEqual(std::size_t(5000), std::get<0>(columns).size(), L"Number of rows", LINE_INFO());
+
+            const auto empty = parallel_sample(2, [](const std::size_t p) { return matrix<float>(0, p); }, names);
+            Assert::IsTrue(empty.empty(), L"Empty sample", LINE_INFO());
+        }
     };
 
 }
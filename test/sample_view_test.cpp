@@ -0,0 +1,82 @@
+﻿// <copyright file="sample_view_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/random.h"
+#include "visus/lhs/sample_view.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+
+
+namespace test {
+
+    TEST_CLASS(sample_view_test) {
+
+        TEST_METHOD(test_matches_sample) {
+            const auto unit = random<float>(20, 2);
+            const auto generator = [&unit](const std::size_t) { return unit; };
+            const std::vector<std::string> names({ "horst", "hugo" });
+
+            const auto expected = sample(generator, names, make_range(1, 100));
+            const auto actual = lazy_sample(generator, names, make_range(1, 100));
+
+            Assert::AreEqual(expected.size(), actual.size(), L"Size", LINE_INFO());
+            Assert::IsFalse(actual.empty(), L"Not empty", LINE_INFO());
+            Assert::AreEqual(std::ptrdiff_t(20), actual.end() - actual.begin(), L"Distance", LINE_INFO());
+
+            std::size_t i = 0;
+            for (auto s : actual) {
+                Assert::IsTrue(expected[i] == s, L"Iterated sample", LINE_INFO());
+                Assert::IsTrue(expected[i] == actual[i], L"Indexed sample", LINE_INFO());
+                ++i;
+            }
+
+            Assert::AreEqual(expected.size(), i, L"Number of iterations", LINE_INFO());
+        }
+
+        TEST_METHOD(test_random_access) {
+            const auto actual = lazy_sample(
+                [](const std::size_t p) { return random<double>(10, p); },
+                make_range(0.0, 1.0),
+                make_range(0, 10));
+
+            auto it = actual.begin();
+            Assert::IsTrue(actual[3] == it[3], L"Subscript", LINE_INFO());
+            Assert::IsTrue(actual[3] == *(it + 3), L"Addition", LINE_INFO());
+            Assert::IsTrue(actual[3] == *(3 + it), L"Commutative addition", LINE_INFO());
+
+            it += 5;
+            Assert::AreEqual(std::size_t(5), it.position(), L"Position", LINE_INFO());
+            Assert::IsTrue(actual[4] == *(it - 1), L"Subtraction", LINE_INFO());
+            Assert::IsTrue(actual.begin() < it, L"Less", LINE_INFO());
+            Assert::IsTrue(actual.end() > it, L"Greater", LINE_INFO());
+
+            // Disjoint slices cover the whole view.
+            std::vector<int> values;
+            const auto middle = actual.begin() + actual.size() / 2;
+            for (auto i = actual.begin(); i != middle; ++i) {
+                values.push_back(std::get<1>(*i));
+            }
+            for (auto i = middle; i != actual.end(); ++i) {
+                values.push_back(std::get<1>(*i));
+            }
+
+            std::sort(values.begin(), values.end());
+            for (int v = 0; v < 10; ++v) {
+                Assert::AreEqual(v, values[v], L"Each stratum once", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_column_mismatch) {
+            Assert::ExpectException<std::invalid_argument>([]() {
+                lazy_sample([](const std::size_t) { return random<float>(4, 3); }, make_range(0.0f, 1.0f));
+            }, L"Column mismatch", LINE_INFO());
+        }
+    };
+
+}
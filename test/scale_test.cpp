@@ -86,6 +86,20 @@ namespace test {
                 Assert::AreEqual(std::uint64_t(99), m(0, 1), L"m(1, 1)", LINE_INFO());
             }
         }
+
+        TEST_METHOD(test_scale_index) {
+            Assert::AreEqual(std::size_t(0), scale(0.0f, 1), L"Single element", LINE_INFO());
+            Assert::AreEqual(std::size_t(0), scale(1.0f, 1), L"Single element", LINE_INFO());
+            Assert::AreEqual(std::size_t(0), scale(0.0f, 4), L"Lower bound", LINE_INFO());
+            Assert::AreEqual(std::size_t(0), scale(0.2, 4), L"Inner value", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), scale(0.25, 4), L"Interval boundary", LINE_INFO());
+            Assert::AreEqual(std::size_t(1), scale(0.4, 4), L"Inner value", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), scale(0.6, 4), L"Inner value", LINE_INFO());
+            Assert::AreEqual(std::size_t(3), scale(0.8, 4), L"Inner value", LINE_INFO());
+            Assert::AreEqual(std::size_t(3), scale(1.0f, 4), L"Upper bound", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { scale(0.5f, 0); }, L"No elements", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { scale(1.5f, 4); }, L"Out of range", LINE_INFO());
+        }
     };
 
 }
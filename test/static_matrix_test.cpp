@@ -0,0 +1,153 @@
+﻿// <copyright file="static_matrix_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/centred.h"
+#include "visus/lhs/correlation.h"
+#include "visus/lhs/maximin.h"
+#include "visus/lhs/random.h"
+#include "visus/lhs/static_matrix.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(static_matrix_test) {
+
+        TEST_METHOD(test_basics) {
+            constexpr static_matrix<int, 3, 2> zero;
+            static_assert(zero.rows() == 3, "Rows at compile time");
+            static_assert(zero.columns() == 2, "Columns at compile time");
+            static_assert(zero.size() == 6, "Size at compile time");
+            static_assert(zero(2, 1) == 0, "Zero-initialised");
+            static_assert(sizeof(static_matrix<float, 4, 4>) == 16 * sizeof(float), "Inline storage");
+
+            static_matrix<int, 3, 2> rm;
+            static_matrix<int, 3, 2, matrix_layout::column_major> cm(7);
+            Assert::IsTrue(rm.row_major(), L"Row-major", LINE_INFO());
+            Assert::IsTrue(cm.column_major(), L"Column-major", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), rm.stride(), L"Row-major stride", LINE_INFO());
+            Assert::AreEqual(std::size_t(3), cm.stride(), L"Column-major stride", LINE_INFO());
+            Assert::AreEqual(7, cm(2, 1), L"Fill constructor", LINE_INFO());
+
+            for (std::size_t r = 0; r < rm.rows(); ++r) {
+                for (std::size_t c = 0; c < rm.columns(); ++c) {
+                    rm(r, c) = static_cast<int>(r * 10 + c);
+                    cm(r, c) = static_cast<int>(r * 10 + c);
+                }
+            }
+
+            Assert::AreEqual(1, rm[1], L"Row-major order", LINE_INFO());
+            Assert::AreEqual(10, cm[1], L"Column-major order", LINE_INFO());
+
+            matrix_view<int> view = rm;
+            Assert::AreEqual(std::size_t(3), view.rows(), L"View rows", LINE_INFO());
+            Assert::AreEqual(21, view(2, 1), L"View element", LINE_INFO());
+            view(0, 0) = 42;
+            Assert::AreEqual(42, rm(0, 0), L"View writes through", LINE_INFO());
+
+            auto copy = rm;
+            Assert::IsTrue(copy == rm, L"Copy equals original", LINE_INFO());
+            copy.fill(1);
+            Assert::IsTrue(copy != rm, L"Fill", LINE_INFO());
+        }
+
+        TEST_METHOD(test_random_indices) {
+            std::mt19937 rng1(42), rng2(42);
+            static_matrix<std::size_t, 10, 3> actual;
+            random(actual, rng1);
+            Assert::IsTrue(valid(actual), L"Static sample is valid", LINE_INFO());
+
+            matrix<std::size_t> expected(10, 3);
+            random(expected, rng2);
+
+            for (std::size_t r = 0; r < actual.rows(); ++r) {
+                for (std::size_t c = 0; c < actual.columns(); ++c) {
+                    Assert::AreEqual(expected(r, c), actual(r, c), L"Same draw as dynamic matrix", LINE_INFO());
+                }
+            }
+
+            static_matrix<std::uint8_t, 200, 2, matrix_layout::column_major> narrow;
+            random(narrow, rng1);
+            Assert::IsTrue(valid(narrow), L"Narrow static sample is valid", LINE_INFO());
+
+            static_matrix<std::uint8_t, 300, 1> overflow;
+            Assert::ExpectException<std::invalid_argument>([&]() { random(overflow, rng1); }, L"Index type too narrow", LINE_INFO());
+        }
+
+        TEST_METHOD(test_random_unit) {
+            for (const auto preserve_draw : { false, true }) {
+                std::mt19937 rng1(7), rng2(7);
+                std::uniform_real_distribution<double> d1, d2;
+                static_matrix<double, 8, 4, matrix_layout::column_major> actual;
+                random(actual, preserve_draw, rng1, d1);
+                Assert::IsTrue(valid(actual), L"Static sample is valid", LINE_INFO());
+
+                matrix<double, matrix_layout::column_major> expected(8, 4);
+                random(expected, preserve_draw, rng2, d2);
+
+                for (std::size_t r = 0; r < actual.rows(); ++r) {
+                    for (std::size_t c = 0; c < actual.columns(); ++c) {
+                        Assert::AreEqual(expected(r, c), actual(r, c), L"Same draw as dynamic matrix", LINE_INFO());
+                    }
+                }
+            }
+        }
+
+        TEST_METHOD(test_centred) {
+            std::mt19937 rng1(3), rng2(3);
+            std::uniform_real_distribution<float> d1, d2;
+            static_matrix<float, 5, 3> actual;
+            centred(actual, rng1, d1);
+            Assert::IsTrue(valid(actual), L"Static sample is valid", LINE_INFO());
+
+            matrix<float> expected(5, 3);
+            centred(expected, rng2, d2);
+
+            for (std::size_t r = 0; r < actual.rows(); ++r) {
+                for (std::size_t c = 0; c < actual.columns(); ++c) {
+                    Assert::AreEqual(expected(r, c), actual(r, c), L"Same draw as dynamic matrix", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(test_maximin) {
+            std::mt19937 rng(5);
+            std::uniform_real_distribution<float> distribution;
+            static_matrix<std::size_t, 8, 3> indices;
+            maximin(indices, 5, rng, distribution);
+            Assert::IsTrue(valid(indices), L"Maximin indices are valid", LINE_INFO());
+
+            static_matrix<float, 8, 3> unit;
+            random(unit, true, rng, distribution);
+            maximin(unit, 0.01f, 10);
+            Assert::IsTrue(valid(unit), L"Optimised sample is valid", LINE_INFO());
+        }
+
+        TEST_METHOD(test_correlation) {
+            std::mt19937 rng(11);
+            static_matrix<std::size_t, 12, 3> actual;
+            random(actual, rng);
+
+            matrix<std::size_t> expected(12, 3);
+            std::copy(actual.begin(), actual.end(), expected.begin());
+
+            column_correlation<std::size_t> correlation(actual);
+            Assert::AreEqual(max_correlation(expected), correlation.maximum(), 0.000001, L"Same as dynamic matrix", LINE_INFO());
+            Assert::AreEqual(max_correlation(expected), max_correlation(actual), 0.000001, L"Metric on static matrix", LINE_INFO());
+            Assert::AreEqual(max_correlation(expected), max_correlation(matrix_view<std::size_t>(actual)), 0.000001, L"Metric on writable view", LINE_INFO());
+
+            const auto predicted = correlation.evaluate(actual, 0, 1, 2);
+            correlation.swap(actual, 0, 1, 2);
+            Assert::AreEqual(predicted, correlation.maximum(2), 0.000001, L"Swap in static matrix", LINE_INFO());
+            Assert::AreEqual(column_correlation<std::size_t>(actual).maximum(2), correlation.maximum(2), 0.000001, L"Updated statistics", LINE_INFO());
+        }
+    };
+}
@@ -0,0 +1,90 @@
+﻿// <copyright file="static_random_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <random>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/static_random.h"
+#include "visus/lhs/valid.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(static_random_test) {
+
+        template<class TMatrix>
+        static constexpr bool is_permutation(const TMatrix& lhs) {
+            for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                for (std::size_t i = 0; i < lhs.rows(); ++i) {
+                    std::size_t cnt = 0;
+                    for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                        if (static_cast<std::size_t>(lhs(r, c) * (std::is_integral_v<typename TMatrix::value_type> ? 1 : lhs.rows())) == i) {
+                            ++cnt;
+                        }
+                    }
+                    if (cnt != 1) {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+
+        TEST_METHOD(test_splitmix) {
+            splitmix64 rng;
+            Assert::AreEqual(std::uint64_t(0xe220a8397b1dcdafull), rng(), L"Reference sequence", LINE_INFO());
+            Assert::AreEqual(std::uint64_t(0x6e789e6aa1b965f4ull), rng(), L"Reference sequence", LINE_INFO());
+
+            splitmix64 skipped;
+            skipped.discard(2);
+            Assert::IsTrue(rng == skipped, L"Discard", LINE_INFO());
+
+            static_assert(splitmix64(42)() == splitmix64(42)(), "Usable in constant expressions");
+            std::uniform_real_distribution<float> distribution;
+            const auto value = distribution(rng);
+            Assert::IsTrue((value >= 0.0f) && (value < 1.0f), L"Usable with STL distributions", LINE_INFO());
+        }
+
+        TEST_METHOD(test_indices) {
+            constexpr auto lhs = static_random<std::uint8_t, 16, 4>(splitmix64(42));
+            static_assert(is_permutation(lhs), "Compile-time sample is valid");
+            Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+
+            constexpr auto same = static_random<std::uint8_t, 16, 4>(splitmix64(42));
+            static_assert(lhs == same, "Deterministic");
+            constexpr auto other = static_random<std::uint8_t, 16, 4>(splitmix64(43));
+            static_assert(lhs != other, "Depends on seed");
+
+            constexpr auto cm = static_random<std::size_t, 7, 3, matrix_layout::column_major>();
+            Assert::IsTrue(valid(cm), L"Column-major sample is valid", LINE_INFO());
+        }
+
+        TEST_METHOD(test_unit) {
+            constexpr auto lhs = static_random<double, 10, 3>(splitmix64(7));
+            static_assert(is_permutation(lhs), "Compile-time sample is valid");
+            Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+
+            constexpr auto lhsf = static_random<float, 10, 3>(splitmix64(7));
+            Assert::IsTrue(valid(lhsf), L"Float sample is valid", LINE_INFO());
+        }
+
+        TEST_METHOD(test_centred) {
+            constexpr auto lhs = static_centred<float, 5, 2>(splitmix64(1));
+            static_assert(is_permutation(lhs), "Compile-time sample is valid");
+            Assert::IsTrue(valid(lhs), L"Sample is valid", LINE_INFO());
+
+            for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                const auto stratum = static_cast<std::size_t>(lhs(r, 0) * lhs.rows());
+                Assert::AreEqual((stratum + 0.5f) / 5.0f, lhs(r, 0), 0.00001f, L"Centre of stratum", LINE_INFO());
+            }
+        }
+    };
+}
@@ -0,0 +1,103 @@
+﻿// <copyright file="text_writer_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/random.h"
+#include "visus/lhs/sample.h"
+#include "visus/lhs/text_writer.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(text_writer_test) {
+
+        TEST_METHOD(test_indices) {
+            matrix<std::size_t> lhs(3, 2, [](const std::size_t r, const std::size_t c) { return r * 10 + c; });
+            std::ostringstream stream;
+            write_text(stream, lhs);
+            Assert::AreEqual(std::string("0,1\n10,11\n20,21\n"), stream.str(), L"CSV", LINE_INFO());
+
+            std::ostringstream tsv;
+            write_text(tsv, matrix_view<const std::size_t>(lhs), '\t');
+            Assert::AreEqual(std::string("0\t1\n10\t11\n20\t21\n"), tsv.str(), L"TSV", LINE_INFO());
+
+            std::ostringstream empty;
+            write_text(empty, matrix<float>());
+            Assert::IsTrue(empty.str().empty(), L"Empty matrix", LINE_INFO());
+        }
+
+        TEST_METHOD(test_round_trip) {
+            std::mt19937 rng(42);
+            std::uniform_real_distribution<double> distribution;
+            matrix<double, matrix_layout::column_major> lhs(1000, 3);
+            random(lhs, false, rng, distribution);
+
+            std::ostringstream stream;
+            write_text(stream, lhs);
+
+            std::istringstream input(stream.str());
+            for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                    std::string field;
+                    std::getline(input, field, (c + 1 < lhs.columns()) ? ',' : '\n');
+                    Assert::AreEqual(lhs(r, c), std::strtod(field.c_str(), nullptr), L"Exact round trip", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(test_parallel) {
+            std::mt19937 rng(1);
+            std::uniform_real_distribution<double> distribution;
+            matrix<double> lhs(200000, 4);
+            random(lhs, false, rng, distribution);
+
+            std::ostringstream sequential;
+            write_text(sequential, lhs, ',', 1);
+            std::ostringstream parallel;
+            write_text(parallel, lhs, ',', 4);
+            const auto text = parallel.str();
+            Assert::IsTrue(sequential.str() == text, L"Parallel output matches", LINE_INFO());
+            Assert::AreEqual(lhs.rows(), static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')), L"One line per row", LINE_INFO());
+        }
+
+        TEST_METHOD(test_tuples) {
+            std::vector<std::tuple<int, std::string, float, bool, char>> samples {
+                { 1, "plain", 0.5f, true, 'a' },
+                { -2, "with,comma", 0.25f, false, ',' },
+                { 3, "with \"quote\"", 1.0f, true, 'b' }
+            };
+
+            std::ostringstream stream;
+            write_text(stream, samples);
+            Assert::AreEqual(std::string("1,plain,0.5,true,a\n"
+                "-2,\"with,comma\",0.25,false,\",\"\n"
+                "3,\"with \"\"quote\"\"\",1,true,b\n"), stream.str(), L"Quoted CSV", LINE_INFO());
+
+            std::ostringstream tsv;
+            write_text(tsv, samples, '\t');
+            Assert::AreEqual(std::string("-2\twith,comma\t0.25\tfalse\t,"), tsv.str().substr(19, 26), L"No quotes needed for TSV", LINE_INFO());
+        }
+
+        TEST_METHOD(test_sample) {
+            auto samples = sample([](const std::size_t parameters) {
+                    std::mt19937 rng(3);
+                    return random(10, parameters, false, rng, std::uniform_real_distribution<float>());
+                },
+                range<float>(0.0f, 1.0f),
+                std::vector<std::string> { "red", "green", "blue" });
+
+            std::ostringstream stream;
+            write_text(stream, samples, ';', 0);
+            const auto text = stream.str();
+            Assert::AreEqual(std::size_t(10), static_cast<std::size_t>(std::count(text.begin(), text.end(), '\n')), L"One line per sample", LINE_INFO());
+        }
+    };
+}
@@ -0,0 +1,148 @@
+﻿// <copyright file="transformed_range_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include "visus/lhs/centred.h"
+#include "visus/lhs/random.h"
+#include "visus/lhs/sample.h"
+#include "visus/lhs/transformed_range.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+
+
+namespace test {
+
+    /// <summary>
+    /// A user-defined monotone transform, which samples uniformly in the
+    /// square root of the values.
+    /// </summary>
+    struct sqrt_transform {
+        template<class TValue> TValue forward(const TValue v) const { return std::sqrt(v); }
+        template<class TValue> TValue inverse(const TValue v) const { return v * v; }
+    };
+
+    TEST_CLASS(transformed_range_test) {
+
+        TEST_METHOD(test_construction) {
+            const auto range = make_log_range(1000.0, 1.0);
+            Assert::AreEqual(1.0, range.begin(), L"Swapped begin", LINE_INFO());
+            Assert::AreEqual(1000.0, range.end(), L"Swapped end", LINE_INFO());
+            Assert::AreEqual(0.0, range.transformed_begin(), 0.000000000001, L"Transformed begin", LINE_INFO());
+            Assert::AreEqual(std::log(1000.0), range.transformed_distance(), 0.000000000001, L"Transformed distance", LINE_INFO());
+            Assert::IsFalse(range.empty(), L"Not empty", LINE_INFO());
+
+            Assert::ExpectException<std::invalid_argument>([]() { make_log_range(0.0, 1.0); }, L"Zero in log range", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([]() { make_log_range(-1.0f, 1.0f); }, L"Negative in log range", LINE_INFO());
+        }
+
+        TEST_METHOD(test_identity_matches_range) {
+            std::vector<range<double>> plain { make_range(0.0, 1.0), make_range(-5.0, 10.0) };
+            std::vector<transformed_range<double, identity_transform>> identity {
+                make_transformed_range(0.0, 1.0, identity_transform()),
+                make_transformed_range(-5.0, 10.0, identity_transform())
+            };
+
+            const auto expected = random(50, plain.begin(), plain.end(), false, std::mt19937(7), std::uniform_real_distribution<double>(0.0, 1.0));
+            const auto actual = random(50, identity.begin(), identity.end(), false, std::mt19937(7), std::uniform_real_distribution<double>(0.0, 1.0));
+
+            for (std::size_t r = 0; r < expected.rows(); ++r) {
+                for (std::size_t c = 0; c < expected.columns(); ++c) {
+                    Assert::AreEqual(expected(r, c), actual(r, c), L"Same as linear range", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(test_random_log) {
+            std::vector<log_range<double>> parameters { make_log_range(1.0, 1e6), make_log_range(1e-3, 1e3) };
+            const auto lhs = random(100, parameters.begin(), parameters.end(), false, std::mt19937(42), std::uniform_real_distribution<double>(0.0, 1.0));
+            matrix<double> unit(100, 2);
+            random(unit, false, std::mt19937(42), std::uniform_real_distribution<double>(0.0, 1.0));
+
+            for (std::size_t c = 0; c < lhs.columns(); ++c) {
+                const auto lower = std::log(parameters[c].begin());
+                const auto distance = std::log(parameters[c].end()) - lower;
+                std::vector<bool> strata(lhs.rows(), false);
+
+                for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                    const auto v = lhs(r, c);
+                    Assert::IsTrue((v >= parameters[c].begin()) && (v <= parameters[c].end()), L"Within range", LINE_INFO());
+                    Assert::AreEqual(std::exp(lower + distance * unit(r, c)), v, v * 0.000000000001, L"Same as post-processing", LINE_INFO());
+
+                    const auto s = static_cast<std::size_t>((std::log(v) - lower) / distance * lhs.rows());
+                    Assert::IsFalse(strata[s], L"Stratified in log space", LINE_INFO());
+                    strata[s] = true;
+                }
+            }
+        }
+
+        TEST_METHOD(test_random_log_integral) {
+            std::vector<log_range<int>> parameters { make_log_range(1, 100000) };
+            const auto lhs = random(1000, parameters.begin(), parameters.end(), true, std::mt19937(3), std::uniform_real_distribution<float>(0.0f, 1.0f));
+
+            std::size_t small = 0;
+            for (std::size_t r = 0; r < lhs.rows(); ++r) {
+                Assert::IsTrue((lhs(r, 0) >= 1) && (lhs(r, 0) <= 100000), L"Within range", LINE_INFO());
+                if (lhs(r, 0) <= 10) {
+                    ++small;
+                }
+            }
+
+            // One fifth of the orders of magnitude is below ten.
+            Assert::IsTrue((small >= 195) && (small <= 205), L"Uniform in log space", LINE_INFO());
+        }
+
+        TEST_METHOD(test_centred_log) {
+            std::vector<log_range<double>> parameters { make_log_range(1.0, 10000.0) };
+            const auto lhs = centred(4, parameters.begin(), parameters.end(), std::mt19937(0), std::uniform_real_distribution<double>(0.0, 1.0));
+
+            std::vector<double> values(lhs.begin(), lhs.end());
+            std::sort(values.begin(), values.end());
+            Assert::AreEqual(std::pow(10.0, 0.5), values[0], 0.000000001, L"Geometric centre", LINE_INFO());
+            Assert::AreEqual(std::pow(10.0, 1.5), values[1], 0.000000001, L"Geometric centre", LINE_INFO());
+            Assert::AreEqual(std::pow(10.0, 2.5), values[2], 0.000000001, L"Geometric centre", LINE_INFO());
+            Assert::AreEqual(std::pow(10.0, 3.5), values[3], 0.000000001, L"Geometric centre", LINE_INFO());
+        }
+
+        TEST_METHOD(test_scale) {
+            matrix<float> m(3, 2);
+            m(0, 0) = 0.0f; m(1, 0) = 0.5f; m(2, 0) = 1.0f;
+            m(0, 1) = 0.0f; m(1, 1) = 0.5f; m(2, 1) = 1.0f;
+            std::vector<transformed_range<float, sqrt_transform>> scales {
+                make_transformed_range(0.0f, 4.0f, sqrt_transform()),
+                make_transformed_range(1.0f, 9.0f, sqrt_transform())
+            };
+            detail::scale(m, scales.begin(), scales.end());
+            Assert::AreEqual(0.0f, m(0, 0), 0.00001f, L"m(0, 0)", LINE_INFO());
+            Assert::AreEqual(1.0f, m(1, 0), 0.00001f, L"m(1, 0)", LINE_INFO());
+            Assert::AreEqual(4.0f, m(2, 0), 0.00001f, L"m(2, 0)", LINE_INFO());
+            Assert::AreEqual(1.0f, m(0, 1), 0.00001f, L"m(0, 1)", LINE_INFO());
+            Assert::AreEqual(4.0f, m(1, 1), 0.00001f, L"m(1, 1)", LINE_INFO());
+            Assert::AreEqual(9.0f, m(2, 1), 0.00001f, L"m(2, 1)", LINE_INFO());
+        }
+
+        TEST_METHOD(test_sample) {
+            auto lhs = sample(
+                [](const std::size_t p) { return random<double>(10, p); },
+                make_log_range(1e-6, 1.0),
+                make_log_range(1, 1000),
+                make_range(0.0, 1.0));
+
+            Assert::AreEqual(std::size_t(10), lhs.size(), L"Number of samples", LINE_INFO());
+            std::vector<bool> strata(lhs.size(), false);
+            for (auto& s : lhs) {
+                const auto v = std::get<0>(s);
+                Assert::IsTrue((v >= 1e-6) && (v <= 1.0), L"Within log range", LINE_INFO());
+                Assert::IsTrue((std::get<1>(s) >= 1) && (std::get<1>(s) <= 1000), L"Within integral log range", LINE_INFO());
+
+                const auto stratum = static_cast<std::size_t>((std::log10(v) + 6.0) / 6.0 * lhs.size());
+                Assert::IsFalse(strata[stratum], L"Stratified in log space", LINE_INFO());
+                strata[stratum] = true;
+            }
+        }
+    };
+}
@@ -0,0 +1,107 @@
+﻿// <copyright file="valid_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include <atomic>
+
+#include "visus/lhs/parallel.h"
+#include "visus/lhs/random.h"
+#include "visus/lhs/valid.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(valid_test) {
+
+        TEST_METHOD(test_parallel_for) {
+            std::vector<int> visited(1000, 0);
+            parallel_for(0, visited.size(), [&visited](const std::size_t b, const std::size_t e) {
+                for (auto i = b; i < e; ++i) {
+                    ++visited[i];
+                }
+            }, 4);
+            Assert::IsTrue(std::all_of(visited.begin(), visited.end(), [](const int v) { return v == 1; }), L"Each item visited once", LINE_INFO());
+
+            std::atomic<std::size_t> chunks(0);
+            parallel_for(0, 10, [&chunks](const std::size_t, const std::size_t) { ++chunks; }, 4, 100);
+            Assert::AreEqual(std::size_t(1), chunks.load(), L"Grain prevents splitting", LINE_INFO());
+
+            Assert::ExpectException<std::runtime_error>([]() {
+                parallel_for(0, 100, [](const std::size_t b, const std::size_t) {
+                    if (b == 0) {
+                        throw std::runtime_error("test");
+                    }
+                }, 4);
+            }, L"Exception propagated", LINE_INFO());
+        }
+
+        TEST_METHOD(test_parallelism) {
+            Assert::AreEqual(std::size_t(1), parallelism(0, 4), L"No work", LINE_INFO());
+            Assert::AreEqual(std::size_t(4), parallelism(100, 4), L"Requested threads", LINE_INFO());
+            Assert::AreEqual(std::size_t(2), parallelism(100, 4, 50), L"Grain limits threads", LINE_INFO());
+            Assert::IsTrue(parallelism(1000, 0) >= 1, L"Hardware threads", LINE_INFO());
+        }
+
+        TEST_METHOD(test_valid_indices) {
+            matrix<std::size_t> lhs(4, 3, [](const std::size_t r, const std::size_t c) { return (r + c) % 4; });
+            const auto validity = validate(lhs);
+            Assert::AreEqual(std::size_t(3), validity.size(), L"One diagnostic per column", LINE_INFO());
+            Assert::IsTrue(validity[0] == column_validity::valid, L"Column 0 valid", LINE_INFO());
+            Assert::IsTrue(validity[1] == column_validity::valid, L"Column 1 valid", LINE_INFO());
+            Assert::IsTrue(validity[2] == column_validity::valid, L"Column 2 valid", LINE_INFO());
+            Assert::IsTrue(valid(lhs), L"Sample valid", LINE_INFO());
+        }
+
+        TEST_METHOD(test_invalid_indices) {
+            // Column 0 has the right sum, which the old heuristic would have
+            // accepted, but it is not a permutation.
+            matrix<std::size_t> lhs(4, 3);
+            lhs(0, 0) = 0; lhs(1, 0) = 0; lhs(2, 0) = 3; lhs(3, 0) = 3;
+            lhs(0, 1) = 0; lhs(1, 1) = 1; lhs(2, 1) = 2; lhs(3, 1) = 4;
+            lhs(0, 2) = 3; lhs(1, 2) = 2; lhs(2, 2) = 1; lhs(3, 2) = 0;
+
+            const auto validity = validate(lhs, 1);
+            Assert::IsTrue(validity[0] == column_validity::duplicate, L"Duplicate", LINE_INFO());
+            Assert::IsTrue(validity[1] == column_validity::out_of_range, L"Out of range", LINE_INFO());
+            Assert::IsTrue(validity[2] == column_validity::valid, L"Valid", LINE_INFO());
+            Assert::IsFalse(valid(lhs), L"Sample invalid", LINE_INFO());
+        }
+
+        TEST_METHOD(test_unit) {
+            std::mt19937 rng(0);
+            std::uniform_real_distribution<float> distribution(0.0f, 1.0f);
+            auto lhs = random(200, 5, false, rng, distribution);
+            Assert::IsTrue(valid(lhs), L"Sample valid", LINE_INFO());
+
+            const auto validity = validate(lhs, 3);
+            Assert::IsTrue(std::all_of(validity.begin(), validity.end(), [](const column_validity v) { return v == column_validity::valid; }), L"All valid", LINE_INFO());
+
+            lhs(0, 1) = lhs(1, 1);
+            Assert::IsTrue(validate(lhs)[1] == column_validity::duplicate, L"Duplicate stratum", LINE_INFO());
+            Assert::IsFalse(valid(lhs), L"Sample invalid", LINE_INFO());
+
+            lhs(0, 2) = 2.0f;
+            Assert::IsTrue(validate(lhs)[2] == column_validity::out_of_range, L"Not in unit interval", LINE_INFO());
+            Assert::ExpectException<std::invalid_argument>([&lhs]() { valid(lhs); }, L"Scaled sample", LINE_INFO());
+        }
+
+        TEST_METHOD(test_large) {
+            std::mt19937 rng(1);
+            auto lhs = random(5000, 40, rng);
+            Assert::IsTrue(valid(lhs), L"Sample valid", LINE_INFO());
+
+            lhs(10, 20) = lhs(11, 20);
+            const auto validity = validate(lhs);
+            Assert::IsTrue(validity[20] == column_validity::duplicate, L"Column 20 broken", LINE_INFO());
+            Assert::IsTrue(validity[0] == column_validity::valid, L"Column 0 untouched", LINE_INFO());
+        }
+    };
+}
@@ -0,0 +1,126 @@
+﻿// <copyright file="vector_view_test.cpp" company="Visualisierungsinstitut der Universität Stuttgart">
+// Copyright © 2025 Visualisierungsinstitut der Universität Stuttgart.
+// Licensed under the MIT licence. See LICENCE file for details.
+// </copyright>
+// <author>Christoph Müller</author>
+
+#include <CppUnitTest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "visus/lhs/distance.h"
+#include "visus/lhs/matrix_view.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace visus::lhs;
+using namespace visus::lhs::detail;
+
+
+namespace test {
+
+    TEST_CLASS(vector_view_test) {
+
+        template<matrix_layout Layout, class TAllocator>
+        static void check_views(matrix<int, Layout, TAllocator>& m) {
+            for (std::size_t r = 0; r < m.rows(); ++r) {
+                const auto row = row_view(m, r);
+                Assert::AreEqual(m.columns(), row.size(), L"Row size", LINE_INFO());
+                Assert::AreEqual(Layout == matrix_layout::row_major, row.contiguous(), L"Row contiguity", LINE_INFO());
+
+                std::size_t c = 0;
+                for (auto v : row) {
+                    Assert::AreEqual(m(r, c), v, L"Row element", LINE_INFO());
+                    Assert::AreEqual(m(r, c), row[c], L"Row element by index", LINE_INFO());
+                    ++c;
+                }
+                Assert::AreEqual(m.columns(), c, L"Row iteration", LINE_INFO());
+            }
+
+            for (std::size_t c = 0; c < m.columns(); ++c) {
+                const auto column = column_view(m, c);
+                Assert::AreEqual(m.rows(), column.size(), L"Column size", LINE_INFO());
+                Assert::AreEqual(Layout == matrix_layout::column_major, column.contiguous(), L"Column contiguity", LINE_INFO());
+                Assert::AreEqual(std::ptrdiff_t(m.rows()), column.end() - column.begin(), L"Iterator distance", LINE_INFO());
+                Assert::IsTrue(column.data() == column.end().data(), L"End does not point past the allocation", LINE_INFO());
+                Assert::AreEqual(std::ptrdiff_t(m.rows()), column.end().position(), L"End position", LINE_INFO());
+                Assert::AreEqual(m(m.rows() - 1, c), *std::make_reverse_iterator(column.end()), L"Reverse from end", LINE_INFO());
+
+                for (std::size_t r = 0; r < m.rows(); ++r) {
+                    Assert::AreEqual(m(r, c), column[r], L"Column element", LINE_INFO());
+                    Assert::AreEqual(m(r, c), column.begin()[r], L"Random access", LINE_INFO());
+                }
+            }
+
+            {
+                const auto column = column_view(m, 1);
+                std::sort(column.begin(), column.end(), std::greater<int>());
+                Assert::IsTrue(std::is_sorted(column.begin(), column.end(), std::greater<int>()), L"Sort through strided view", LINE_INFO());
+                Assert::AreEqual(column[0], m(0, 1), L"Sort writes through", LINE_INFO());
+            }
+
+            {
+                const auto& cm = m;
+                const auto row = row_view(cm, 0);
+                auto it = row.begin();
+                it += 2;
+                Assert::AreEqual(m(0, 2), *it, L"Advance", LINE_INFO());
+                Assert::IsTrue(row.begin() < it, L"Ordering", LINE_INFO());
+                Assert::AreEqual(m(0, 1), *(--it), L"Decrement", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(test_row_major) {
+            matrix<int> m(4, 3, [](const std::size_t r, const std::size_t c) { return static_cast<int>(r * 10 + c); });
+            check_views(m);
+        }
+
+        TEST_METHOD(test_column_major) {
+            matrix<int, matrix_layout::column_major> m(4, 3, [](const std::size_t r, const std::size_t c) { return static_cast<int>(r * 10 + c); });
+            check_views(m);
+        }
+
+        TEST_METHOD(test_padded) {
+            matrix<int, matrix_layout::row_major, aligned_allocator<int, 64>> rm(5, 3, [](const std::size_t r, const std::size_t c) { return static_cast<int>(r * 10 + c); });
+            check_views(rm);
+
+            matrix<int, matrix_layout::column_major, aligned_allocator<int, 64>> cm(5, 3, [](const std::size_t r, const std::size_t c) { return static_cast<int>(r * 10 + c); });
+            check_views(cm);
+        }
+
+        TEST_METHOD(test_external) {
+            std::vector<float> buffer = { 1.0f, 2.0f, -1.0f, 3.0f, 4.0f, -1.0f };
+            matrix_view<float> view(buffer.data(), 2, 2, 3);
+            Assert::AreEqual(3.0f, row_view(view, 1)[0], L"Row of external buffer", LINE_INFO());
+            Assert::AreEqual(4.0f, column_view(view, 1)[1], L"Column of external buffer", LINE_INFO());
+            Assert::AreEqual(std::size_t(3), column_view(view, 0).stride(), L"Column stride", LINE_INFO());
+        }
+
+        TEST_METHOD(test_distance) {
+            matrix<float> rm(3, 4, [](const std::size_t r, const std::size_t c) { return static_cast<float>(r * c); });
+            matrix<float, matrix_layout::column_major> cm(3, 4, [](const std::size_t r, const std::size_t c) { return static_cast<float>(r * c); });
+
+            std::vector<float> expected, actual;
+            square_row_distances(expected, rm);
+            square_row_distances(actual, cm);
+            Assert::IsTrue(expected == actual, L"Contiguous and strided distances match", LINE_INFO());
+            Assert::AreEqual(14.0f, square_distance(row_view(rm, 0), row_view(rm, 1)), L"Contiguous distance", LINE_INFO());
+            Assert::AreEqual(14.0f, square_distance(row_view(cm, 0), row_view(cm, 1)), L"Strided distance", LINE_INFO());
+        }
+
+        TEST_METHOD(test_copy) {
+            matrix<int, matrix_layout::column_major, aligned_allocator<int, 64>> m(3, 5, [](const std::size_t r, const std::size_t c) { return static_cast<int>(r * 10 + c); });
+
+            matrix<int, matrix_layout::row_major, aligned_allocator<int, 64>> column(3, 1);
+            m.column(column, 2);
+            for (std::size_t r = 0; r < m.rows(); ++r) {
+                Assert::AreEqual(m(r, 2), column(r, 0), L"Padded column extraction", LINE_INFO());
+            }
+
+            const auto row = m.row(1);
+            for (std::size_t c = 0; c < m.columns(); ++c) {
+                Assert::AreEqual(m(1, c), row(0, c), L"Strided row extraction", LINE_INFO());
+            }
+        }
+    };
+}